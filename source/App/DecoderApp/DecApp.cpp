@@ -803,6 +803,9 @@ uint32_t DecApp::decode()
 
   xFlushOutput( pcListPic );
 
+  m_cDecLib.printConversionCacheStatistics();
+  g_mmProfiler.close();
+
 #if JVET_Z0120_SII_SEI_PROCESSING
   if (!m_shutterIntervalPostFileName.empty() && getShutterFilterFlag())
   {
@@ -893,6 +896,7 @@ void DecApp::xCreateDecLib()
   // Multi-model
   m_cDecLib.setMMCodingDepth(9);
   m_cDecLib.setMMPredType(0);
+  m_cDecLib.setMMProfileFile(m_MMProfileFile);
 }
 
 void DecApp::xDestroyDecLib()
@@ -104,6 +104,7 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
   ("SEIFGSFilename",            m_SEIFGSFileName,                      string(""), "FGS YUV output file name. If empty, no film grain is applied (ignore SEI message)\n")
   ("SEIAnnotatedRegionsInfoFilename",  m_annotatedRegionsSEIFileName,   string(""), "Annotated regions output file name. If empty, no object information will be saved (ignore SEI message)\n")
   ("OutputDecodedSEIMessagesFilename",  m_outputDecodedSEIMessagesFilename,    string(""), "When non empty, output decoded SEI messages to the indicated file. If file is '-', then output to stdout\n")
+  ("MMProfileFile",             m_MMProfileFile,                       string(""), "Per motion model runtime profile per picture and sequence, JSON if the name ends with .json, CSV otherwise (empty: off)\n")
 #if JVET_S0257_DUMP_360SEI_MESSAGE
   ("360DumpFile",  m_outputDecoded360SEIMessagesFilename, string(""), "When non empty, output decoded 360 SEI messages to the indicated file.\n")
 #endif
@@ -270,6 +271,7 @@ DecAppCfg::DecAppCfg()
 , m_annotatedRegionsSEIFileName()
 , m_targetDecLayerIdSet()
 , m_outputDecodedSEIMessagesFilename()
+, m_MMProfileFile()
 #if JVET_S0257_DUMP_360SEI_MESSAGE
 , m_outputDecoded360SEIMessagesFilename()
 #endif
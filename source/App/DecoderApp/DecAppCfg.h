@@ -77,6 +77,7 @@ protected:
   std::string   m_annotatedRegionsSEIFileName;        ///< annotated regions file name
   std::vector<int> m_targetDecLayerIdSet;             ///< set of LayerIds to be included in the sub-bitstream extraction process.
   std::string   m_outputDecodedSEIMessagesFilename;   ///< filename to output decoded SEI messages to. If '-', then use stdout. If empty, do not output details.
+  std::string   m_MMProfileFile;                      ///< output file of the per motion model runtime profile. If empty, profiling is off.
 #if JVET_S0257_DUMP_360SEI_MESSAGE
   std::string   m_outputDecoded360SEIMessagesFilename;   ///< filename to output decoded 360 SEI messages to.
 #endif
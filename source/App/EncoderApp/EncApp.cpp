@@ -755,6 +755,13 @@ void EncApp::xInitLibCfg()
     m_cEncLib.setGEDFlavor(GeodesicMotionModel::Flavor::VISHWANATH_MODULATED);
     m_cEncLib.setMMSizeConstraint(0);
     m_cEncLib.setUseMMMVP(m_MMMVP);
+    m_cEncLib.setUseMMFixedPoint(m_MMFixedPoint);
+    m_cEncLib.setUseMMDMVRWindow(m_MMDMVRWindow);
+    m_cEncLib.setUseMMLinearizedSearch(m_MMLinearizedSearch);
+    m_cEncLib.setMMSearchThreads(m_MMSearchThreads);
+    m_cEncLib.setMMPreselectTopK(m_MMPreselectTopK);
+    m_cEncLib.setMMPreselectThreshold(m_MMPreselectThreshold);
+    m_cEncLib.setMMProfileFile(m_MMProfileFile);
     m_cEncLib.setMMOffset4x4(1);
     m_cEncLib.setMMCodingDepth(9);
     m_cEncLib.setMMPredType(0);
@@ -1468,6 +1475,10 @@ void EncApp::createLib( const int layerIdx )
 
 void EncApp::destroyLib()
 {
+#if EXTENSION_360_VIDEO && SVIDEO_ASYNC_METRICS
+  // print the outstanding per picture 360 metrics before the summary
+  m_cEncLib.getGOPEncoder()->getExt360Data().waitForAsyncMetrics();
+#endif
   printf( "\nLayerId %2d", m_cEncLib.getLayerId() );
 
   m_cEncLib.printSummary( m_isField );
@@ -1018,6 +1018,13 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("GEDA",                                            m_GEDA,                                           false, "Enable geodesic-adaptive motion model (0:off, 1:on)")
   ("Epipole", [this](po::Options &opts, const string &argv, po::ErrorReporter &er) { this->parseEpipole(opts, argv, er); }, "Epipole list entry as (-1, -1, x, y, z).")
   ("MMMVP",                                           m_MMMVP,                                           true, "Enable multi-model motion vector prediction (0:off, 1:on)")
+  ("MMFixedPoint",                                    m_MMFixedPoint,                                   false, "Integer-only reprojection of the tangential, rotational and geodesic motion models, ERP only, requires MMMVP=0, MPA=0 and 3DT=0 (0:off, 1:on)")
+  ("MMDMVRWindow",                                    m_MMDMVRWindow,                                   false, "Projected DMVR evaluates the integer refinement offsets on one padded prediction window per sub-PU (0:off, 1:on)")
+  ("MMLinearizedSearch",                              m_MMLinearizedSearch,                             false, "Linearize the reprojection of tangential, rotational and geodesic models in the integer motion search, these models are not searched with MMSearchThreads (0:off, 1:on)")
+  ("MMSearchThreads",                                 m_MMSearchThreads,                                    1, "Number of threads evaluating motion search candidates of non-classic motion models (1: serial)")
+  ("MMPreselectTopK",                                 m_MMPreselectTopK,                                    0, "Number of non-classic motion models kept by the pre-selection of each CU (0: off, all models are searched)")
+  ("MMPreselectThreshold",                            m_MMPreselectThreshold,                             0.0, "Drop non-classic motion models whose screening distortion exceeds this factor times the best one (0: off)")
+  ("MMProfileFile",                                   m_MMProfileFile,                             string(""), "Per motion model runtime profile per picture and sequence, JSON if the name ends with .json, CSV otherwise (empty: off)")
   ("Projection",                                      m_projectionFct,                                      2, "Projection function for MM (2: ERP)")
 
   ("AllowDisFracMMVD",                                m_allowDisFracMMVD,                               false, "Disable fractional MVD in MMVD mode adaptively")
@@ -3728,6 +3735,11 @@ bool EncAppCfg::xCheckParameter()
   {
     xConfirmPara(m_projectionFct < 0 || m_projectionFct >= NUM_PROJECTIONS, ("Projection function with id '" + std::to_string(m_projectionFct) + "' does not exist.").c_str());
   }
+  xConfirmPara(m_MMFixedPoint && m_projectionFct != EQUIRECTANGULAR, "MMFixedPoint requires the equirectangular projection");
+  xConfirmPara(m_MMFixedPoint && (m_MMMVP || m_MPA || m_3DT), "MMFixedPoint requires MMMVP=0, MPA=0 and 3DT=0, the motion vector conversion and these models are only defined in floating point");
+  xConfirmPara(m_MMSearchThreads < 1, "MMSearchThreads must be at least 1");
+  xConfirmPara(m_MMPreselectTopK < 0, "MMPreselectTopK must not be negative");
+  xConfirmPara(m_MMPreselectThreshold != 0.0 && m_MMPreselectThreshold < 1.0, "MMPreselectThreshold must be 0 or at least 1");
 
   if (m_GED)
   {
@@ -5091,6 +5103,14 @@ void EncAppCfg::xPrintParameter()
     msg( VERBOSE, "GED:%d ", m_GED );
     msg( VERBOSE, "GEDA:%d ", m_GEDA );
     msg( VERBOSE, "MM-MVP:%d ", m_MMMVP );
+    msg( VERBOSE, "MM-FixedPoint:%d ", m_MMFixedPoint );
+    msg( VERBOSE, "MM-DMVRWindow:%d ", m_MMDMVRWindow );
+    msg( VERBOSE, "MM-LinSearch:%d ", m_MMLinearizedSearch );
+    msg( VERBOSE, "MM-SearchThreads:%d ", m_MMSearchThreads );
+    msg( VERBOSE, "MM-Preselect:%d,%.2f ", m_MMPreselectTopK, m_MMPreselectThreshold );
+    if (!m_MMProfileFile.empty()) {
+      msg( VERBOSE, "MM-Profile:%s ", m_MMProfileFile.c_str() );
+    }
     msg( VERBOSE, "Projection:%d ", m_projectionFct );
     if (m_GED && m_epipoleList.count() > 0) {
       m_epipoleList.printSummary();
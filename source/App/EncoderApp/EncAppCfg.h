@@ -387,6 +387,13 @@ protected:
   bool      m_GEDA; ///< Use geodesic-adaptive motion model
   EpipoleList m_epipoleList;  ///< Epipole list
   bool      m_MMMVP;  ///< Employ multi-model motion vector prediction
+  bool      m_MMFixedPoint;  ///< Integer-only reprojection of the tangential, rotational and geodesic models
+  bool      m_MMDMVRWindow;  ///< Projected DMVR searches the integer offsets in one padded prediction window
+  bool      m_MMLinearizedSearch;  ///< Linearize the reprojection in the integer motion search
+  int       m_MMSearchThreads;  ///< Number of threads evaluating motion search candidates of non-classic models
+  int       m_MMPreselectTopK;  ///< Number of non-classic motion models kept by the per-CU pre-selection (0: off)
+  double    m_MMPreselectThreshold;  ///< Maximum screening distortion relative to the best model (0: off)
+  std::string m_MMProfileFile;  ///< Output file of the per motion model runtime profile (empty: off)
   int       m_projectionFct;  ///< Projection function
 
   bool      m_allowDisFracMMVD;
@@ -41,6 +41,7 @@
 #include <ctime>
 
 #include "EncoderLib/EncLibCommon.h"
+#include "CommonLib/MMProfiler.h"
 #include "EncApp.h"
 #include "Utilities/program_options_lite.h"
 
@@ -69,6 +70,7 @@ static void printMacroSettings()
     PRINT_CONSTANT( RExt__DECODER_DEBUG_BIT_STATISTICS,                         settingNameWidth, settingValueWidth );
     PRINT_CONSTANT( RExt__HIGH_BIT_DEPTH_SUPPORT,                               settingNameWidth, settingValueWidth );
     PRINT_CONSTANT( RExt__HIGH_PRECISION_FORWARD_TRANSFORM,                     settingNameWidth, settingValueWidth );
+    PRINT_CONSTANT( MM_FAST_TRIG,                                               settingNameWidth, settingValueWidth );
 
     //------------------------------------------------
 
@@ -307,6 +309,9 @@ int main(int argc, char* argv[])
     delete encApp;
   }
 
+  // write the MM profile of all layers
+  g_mmProfiler.close();
+
   // destroy ROM
   destroyROM();
 
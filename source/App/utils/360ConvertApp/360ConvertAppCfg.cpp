@@ -532,6 +532,15 @@ Bool TApp360ConvertCfg::parseCfg( Int argc, TChar* argv[] )
     ("OutputFile,o",                                    cfg_OutputFile,                              string(""), "Converted YUV output file name")
     ("RefFile,r",                                       cfg_RefFile,                                 string(""), "Ref YUV file name for PSNR calculation")
     ("SphFile",                                         cfg_SphFile,                                 string(""), "Spherical points data file name for S-PSNR-NN/S-PSNR-I calculation")
+#if SVIDEO_BINARY_SPHERE_POINTS && SVIDEO_SPSNR_NN
+    ("SphTableCacheDir",                                m_sphTableCacheDir,                          string(""), "Directory of the cached S-PSNR-NN sampling position tables (empty: no cache)")
+#endif
+#if SVIDEO_PARALLEL_GEOCONVERT
+    ("GeoConvertThreads",                               m_geoConvertThreads,                                 1u, "Number of threads converting the input geometry to the coding geometry (1: serial)")
+#endif
+#if SVIDEO_GEOMAP_CACHE
+    ("GeoMapCacheDir",                                  m_geoMapCacheDir,                            string(""), "Directory of the cached geometry mapping tables (empty: no cache)")
+#endif
     ("ViewPortFile,v",                                  cfg_ViewFile,                                string(""), "Viewport paramete file name for dynamic viewport generation")
 #if SVIDEO_DYNAMIC_VIEWPORT_PSNR
     ("DynamicViewPortFile,-dynvp",                      cfg_Dynamic_ViewFile,                        string(""), "Viewport parameter file name for sequential dynamic viewport generation")
@@ -2257,6 +2266,9 @@ Void TApp360ConvertCfg::xCheckParameter()
   xConfirmPara( m_framesToBeConverted <= 0,                                                   "Total Number Of Frames encoded must be more than 0" );
   xConfirmPara( m_temporalSubsampleRatio < 1,                                               "Temporal subsample rate must be no less than 1" );
   xConfirmPara( m_faceSizeAlignment <= 0,                                                   "m_faceSizeAlignment must be greater than zero");
+#if SVIDEO_PARALLEL_GEOCONVERT
+  xConfirmPara( m_geoConvertThreads < 1,                                                    "GeoConvertThreads must be at least 1");
+#endif
   /*
   xConfirmPara( m_iSourceWidth  % TComSPS::getWinUnitX(m_OutputChromaFormatIDC) != 0, "Picture width must be an integer multiple of the specified chroma subsampling");
   xConfirmPara( m_iSourceHeight % TComSPS::getWinUnitY(m_OutputChromaFormatIDC) != 0, "Picture height must be an integer multiple of the specified chroma subsampling");
@@ -2822,6 +2834,14 @@ Void TApp360ConvertCfg::xPrintParameter()
 #endif
   if(isGeoConvertSkipped())
     printf("\nGeometry conversion is skipped!");
+#if SVIDEO_PARALLEL_GEOCONVERT
+  else if(m_geoConvertThreads > 1)
+    printf("\nGeometry conversion threads: %u", m_geoConvertThreads);
+#endif
+#if SVIDEO_GEOMAP_CACHE
+  if(!isGeoConvertSkipped() && !m_geoMapCacheDir.empty())
+    printf("\nGeometry mapping tables are cached in %s", m_geoMapCacheDir.c_str());
+#endif
   printf("\n\n");
 
   fflush(stdout);
@@ -3133,6 +3153,12 @@ Void  TApp360ConvertCfg::convert()
 
   pcInputGeometry = TGeometry::create(m_sourceSVideoInfo, &m_inputGeoParam); 
   pcCodingGeometry = TGeometry::create(m_codingSVideoInfo, &m_inputGeoParam);
+#if SVIDEO_PARALLEL_GEOCONVERT
+  pcCodingGeometry->setNumGeoConvertThreads(m_geoConvertThreads);
+#endif
+#if SVIDEO_GEOMAP_CACHE
+  pcCodingGeometry->setGeoMapCacheDir(m_geoMapCacheDir);
+#endif
 #if SVIDEO_CPPPSNR
   //pcReferenceGeometry = TGeometry::create(m_referenceSVideoInfo, &m_inputGeoParam);
 #endif
@@ -3166,6 +3192,9 @@ Void  TApp360ConvertCfg::convert()
   if( m_psnrEnabled[METRIC_SPSNR_NN])
   {
     cSPSNRCalc.sphSampoints(m_pchSphData);
+#if SVIDEO_BINARY_SPHERE_POINTS
+    cSPSNRCalc.setTableCacheDir(m_sphTableCacheDir);
+#endif
     cSPSNRCalc.createTable(pcCodingGeometry);
   }
 #endif
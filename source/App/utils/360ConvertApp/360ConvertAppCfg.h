@@ -124,6 +124,15 @@ protected:
   UInt      m_uiMaxCUWidth;                                   ///< max. CU width in pixel
   UInt      m_uiMaxCUHeight;                                  ///< max. CU height in pixel
 
+#if SVIDEO_BINARY_SPHERE_POINTS && SVIDEO_SPSNR_NN
+  std::string m_sphTableCacheDir;                             ///< directory of the cached S-PSNR-NN sampling position tables
+#endif
+#if SVIDEO_PARALLEL_GEOCONVERT
+  UInt        m_geoConvertThreads;                            ///< threads generating and applying the geometry mapping
+#endif
+#if SVIDEO_GEOMAP_CACHE
+  std::string m_geoMapCacheDir;                               ///< directory of the cached geometry mapping tables
+#endif
   std::string m_summaryOutFilename;                           ///< filename to use for producing summary output file.
   std::string m_summaryPicFilenameBase;                       ///< Base filename to use for producing summary picture output files. The actual filenames used will have I.txt, P.txt and B.txt appended.
   UInt        m_summaryVerboseness;                           ///< Specifies the level of the verboseness of the text output.
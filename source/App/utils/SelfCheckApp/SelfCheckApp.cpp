@@ -0,0 +1,567 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2022, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SelfCheckApp.cpp
+    \brief    checks the optimized kernels of the multi-model extension against their reference implementations
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "CommonLib/CommonDef.h"
+#include "CommonLib/Coordinate.h"
+#include "CommonLib/MVReprojection.h"
+#include "CommonLib/Slice.h"
+#include "CommonLib/Unit.h"
+
+static bool reportCheck(const char* name, bool passed)
+{
+  printf("%-60s %s\n", name, passed ? "OK" : "FAILED");
+  return passed;
+}
+
+// ====================================================================================================================
+// Coordinate conversion
+// ====================================================================================================================
+
+/// Maximum absolute errors of FastTrig against double precision, as documented in Coordinate.h
+static const double FAST_SINCOS_MAX_ERROR = 1.0e-7;
+static const double FAST_ATAN2_MAX_ERROR  = 3.0e-7;
+static const double FAST_ACOS_MAX_ERROR   = 3.0e-7;
+
+static bool checkFastTrigErrors()
+{
+  double maxSinCos = 0, maxAtan2 = 0, maxAcos = 0;
+  int    numDiffLibm = 0, numValues = 0;
+  const int steps = 1 << 20;
+  for (int i = 0; i <= steps; i++)
+  {
+    const TCoord x = TCoord(-M_PI + 2 * M_PI * i / steps);
+    TCoord s, c;
+    FastTrig::sincos(x, s, c);
+    maxSinCos = std::max(maxSinCos, std::max(std::abs(s - std::sin(double(x))), std::abs(c - std::cos(double(x)))));
+    numDiffLibm += (s != std::sin(x)) || (c != std::cos(x));
+
+    const TCoord a = TCoord(-1 + 2.0 * i / steps);
+    const TCoord ac = FastTrig::acos(a);
+    maxAcos = std::max(maxAcos, std::abs(ac - std::acos(double(a))));
+    numDiffLibm += ac != std::acos(a);
+
+    const TCoord y = TCoord(std::sin(double(x)) * (1 + i % 7)), xx = TCoord(std::cos(double(x)) * (1 + i % 5));
+    const TCoord at = FastTrig::atan2(y, xx);
+    maxAtan2 = std::max(maxAtan2, std::abs(at - std::atan2(double(y), double(xx))));
+    numDiffLibm += at != std::atan2(y, xx);
+    numValues += 4;
+  }
+  for (int i = 0; i <= steps; i++)
+  {
+    // Large arguments as they occur for unnormalized angles
+    const TCoord x = TCoord(-8192.0 + 16384.0 * i / steps);
+    TCoord s, c;
+    FastTrig::sincos(x, s, c);
+    maxSinCos = std::max(maxSinCos, std::max(std::abs(s - std::sin(double(x))), std::abs(c - std::cos(double(x)))));
+  }
+  printf("FastTrig max. abs. error: sin/cos %.3g, atan2 %.3g, acos %.3g; differs from the C library in %.1f%% of the results\n",
+         maxSinCos, maxAtan2, maxAcos, 100.0 * numDiffLibm / numValues);
+  return maxSinCos <= FAST_SINCOS_MAX_ERROR && maxAtan2 <= FAST_ATAN2_MAX_ERROR && maxAcos <= FAST_ACOS_MAX_ERROR;
+}
+
+struct CoordinateTestData
+{
+  std::vector<TCoord> in[3];
+  std::vector<TCoord> out[3];
+
+  void resize(int n)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      in[i].resize(n);
+      out[i].assign(n, TCoord(0));
+    }
+  }
+};
+
+static void fillCoordinateTestData(CoordinateTestData &data, int n, std::mt19937 &rng)
+{
+  std::uniform_real_distribution<TCoord> dist(TCoord(-4), TCoord(4));
+  data.resize(n);
+  for (int i = 0; i < n; i++)
+  {
+    for (int c = 0; c < 3; c++)
+    {
+      data.in[c][i] = dist(rng);
+    }
+  }
+  // Special values: zero vectors, axes and non-finite values
+  const TCoord specials[] = { TCoord(0), TCoord(-0.0), TCoord(1), TCoord(-1), std::numeric_limits<TCoord>::infinity(),
+                              std::numeric_limits<TCoord>::quiet_NaN() };
+  for (int i = 0; i < n && i < 6 * 6 * 6; i++)
+  {
+    data.in[0][i] = specials[i % 6];
+    data.in[1][i] = specials[(i / 6) % 6];
+    data.in[2][i] = specials[(i / 36) % 6];
+  }
+}
+
+/// Run all batched conversions of ops on the input, the outputs of successive conversions are appended to result
+static void runCoordinateOps(const CoordinateOps &ops, CoordinateTestData &data, std::vector<TCoord> &result)
+{
+  static const TCoord rotation[9] = { TCoord(0.36), TCoord(0.48), TCoord(-0.8), TCoord(-0.8), TCoord(0.6), TCoord(0),
+                                      TCoord(0.48), TCoord(0.64), TCoord(0.6) };
+  const int n = int(data.in[0].size());
+  const TCoord *x = data.in[0].data(), *y = data.in[1].data(), *z = data.in[2].data();
+  TCoord *a = data.out[0].data(), *b = data.out[1].data(), *c = data.out[2].data();
+  result.clear();
+  auto append = [&](int numOutputs)
+  {
+    for (int i = 0; i < numOutputs; i++)
+    {
+      result.insert(result.end(), data.out[i].begin(), data.out[i].end());
+    }
+  };
+  ops.sphericalToCartesian(x, y, z, a, b, c, n);
+  append(3);
+  ops.cartesianToSpherical(x, y, z, a, b, c, n);
+  append(3);
+  ops.polarToCartesian(x, y, a, b, n);
+  append(2);
+  ops.cartesianToPolar(x, y, a, b, n);
+  append(2);
+  ops.rotatedCartesianToSpherical(rotation, x, y, z, a, b, c, n);
+  append(3);
+  ops.sphericalToRotatedCartesian(rotation, x, y, z, a, b, c, n);
+  append(3);
+}
+
+#if !MM_FAST_TRIG
+/// Rotation of the coordinates with the column-major matrix m, by the matrix product of Eigen on the stacked coordinates
+static void rotateEigen(const TCoord* m, const ArrayXXTCoord &x, const ArrayXXTCoord &y, const ArrayXXTCoord &z,
+                        ArrayXXTCoord &xRot, ArrayXXTCoord &yRot, ArrayXXTCoord &zRot)
+{
+  const Eigen::Index n = x.size();
+  Eigen::Matrix<TCoord, 3, Eigen::Dynamic> stacked(Eigen::Index(3), n);
+  stacked << Eigen::Map<const ArrayXTCoord>(x.data(), n), Eigen::Map<const ArrayXTCoord>(y.data(), n),
+             Eigen::Map<const ArrayXTCoord>(z.data(), n);
+  const auto rotated = Eigen::Map<const Eigen::Matrix<TCoord, 3, 3>>(m) * stacked;
+  xRot = Eigen::Map<const ArrayXXTCoord>(rotated.row(0).eval().data(), n, 1);
+  yRot = Eigen::Map<const ArrayXXTCoord>(rotated.row(1).eval().data(), n, 1);
+  zRot = Eigen::Map<const ArrayXXTCoord>(rotated.row(2).eval().data(), n, 1);
+}
+
+/// The conversions of runCoordinateOps() with the Eigen array expressions on freshly allocated arrays, which the
+/// conversions reproduce bit-exactly
+static void runEigenReference(const CoordinateTestData &data, std::vector<TCoord> &result)
+{
+  static const TCoord rotation[9] = { TCoord(0.36), TCoord(0.48), TCoord(-0.8), TCoord(-0.8), TCoord(0.6), TCoord(0),
+                                      TCoord(0.48), TCoord(0.64), TCoord(0.6) };
+  const Eigen::Index  n = Eigen::Index(data.in[0].size());
+  const ArrayXXTCoord x = Eigen::Map<const ArrayXXTCoord>(data.in[0].data(), n, 1);
+  const ArrayXXTCoord y = Eigen::Map<const ArrayXXTCoord>(data.in[1].data(), n, 1);
+  const ArrayXXTCoord z = Eigen::Map<const ArrayXXTCoord>(data.in[2].data(), n, 1);
+  result.clear();
+  auto append = [&](const ArrayXXTCoord &a) { result.insert(result.end(), a.data(), a.data() + n); };
+  auto atan2 = [](const ArrayXXTCoord &x, const ArrayXXTCoord &y) -> ArrayXXTCoord
+  {
+    return x.binaryExpr(y, [](TCoord x, TCoord y) { return TCoord(std::atan2(y, x)); });
+  };
+  auto sphericalToCartesian = [&](const ArrayXXTCoord &r, const ArrayXXTCoord &theta, const ArrayXXTCoord &phi,
+                                  ArrayXXTCoord &cartX, ArrayXXTCoord &cartY, ArrayXXTCoord &cartZ)
+  {
+    cartX = r * theta.sin() * phi.cos();
+    cartY = r * theta.sin() * phi.sin();
+    cartZ = r * theta.cos();
+  };
+  auto cartesianToSpherical = [&](const ArrayXXTCoord &cartX, const ArrayXXTCoord &cartY, const ArrayXXTCoord &cartZ)
+  {
+    const ArrayXXTCoord r = (cartX.square() + cartY.square() + cartZ.square()).sqrt();
+    append(r);
+    append((cartZ / r).cwiseMin(1).cwiseMax(-1).acos());
+    append(atan2(cartX, cartY));
+  };
+
+  ArrayXXTCoord a, b, c, aRot, bRot, cRot;
+  sphericalToCartesian(x, y, z, a, b, c);
+  append(a);
+  append(b);
+  append(c);
+  cartesianToSpherical(x, y, z);
+  append(x * y.cos());
+  append(x * y.sin());
+  append((x.square() + y.square()).sqrt());
+  append(atan2(x, y));
+  rotateEigen(rotation, x, y, z, aRot, bRot, cRot);
+  cartesianToSpherical(aRot, bRot, cRot);
+  sphericalToCartesian(x, y, z, a, b, c);
+  rotateEigen(rotation, a, b, c, aRot, bRot, cRot);
+  append(aRot);
+  append(bRot);
+  append(cRot);
+}
+#endif
+
+/// Compare two results bit by bit, returns the number of differing values and their maximum absolute difference.
+/// NaN results compare equal regardless of their sign, which the vector instructions do not preserve.
+static int compareCoordinates(const std::vector<TCoord> &ref, const std::vector<TCoord> &test, double &maxDiff)
+{
+  int numDiff = 0;
+  maxDiff = 0;
+  for (size_t i = 0; i < ref.size(); i++)
+  {
+    if (std::isnan(ref[i]) && std::isnan(test[i]))
+    {
+      continue;
+    }
+    if (memcmp(&ref[i], &test[i], sizeof(TCoord)))
+    {
+      numDiff++;
+      if (std::isfinite(ref[i]) && std::isfinite(test[i]))
+      {
+        maxDiff = std::max(maxDiff, double(std::abs(ref[i] - test[i])));
+      }
+    }
+  }
+  return numDiff;
+}
+
+/// Bit-exact check of the batched conversions ops against the reference
+static bool checkCoordinateOpsExact(const char* name, const CoordinateOps &ops, std::mt19937 &rng)
+{
+  CoordinateTestData data;
+  int numDiff = 0;
+  double maxDiff = 0;
+  // Lengths that are not multiples of the vector width exercise the remainder handling
+  for (int n: { 1, 3, 7, 8, 13, 255, 4099 })
+  {
+    fillCoordinateTestData(data, n, rng);
+    std::vector<TCoord> ref, test;
+#if MM_FAST_TRIG
+    runCoordinateOps(CoordinateOps(), data, ref);
+#else
+    runEigenReference(data, ref);
+#endif
+    runCoordinateOps(ops, data, test);
+    double diff;
+    numDiff += compareCoordinates(ref, test, diff);
+    maxDiff = std::max(maxDiff, diff);
+  }
+  if (numDiff)
+  {
+    printf("  %d values differ, max. abs. difference %.3g\n", numDiff, maxDiff);
+  }
+  return reportCheck(name, numDiff == 0);
+}
+
+static bool checkCoordinateOps()
+{
+  bool passed = reportCheck("FastTrig within the documented error bounds", checkFastTrigErrors());
+  std::mt19937 rng(42);
+
+#if MM_FAST_TRIG
+  // The SIMD kernels evaluate the FastTrig polynomials in the same order as the scalar path
+  const char* refName = "scalar";
+#else
+  // Scalar and SIMD kernels reproduce the vectorized and scalar functions of the Eigen array expressions
+  const char* refName = "Eigen";
+  passed = checkCoordinateOpsExact("coordinate conversion scalar vs. Eigen (bit-exact)", CoordinateOps(), rng) && passed;
+#endif
+#if ENABLE_SIMD_OPT_COORDINATE
+  const X86_VEXT detected = read_x86_extension_flags();
+#if MM_FAST_TRIG
+  const X86_VEXT vexts[]     = { SSE41, AVX, AVX2 };
+  const char*    vextNames[] = { "SSE41", "AVX", "AVX2" };
+#else
+  // Eigen evaluates the array expressions with SSE packets, the wider vectors are dispatched to the SSE4.1 kernels
+  const X86_VEXT vexts[]     = { SSE41 };
+  const char*    vextNames[] = { "SSE41" };
+#endif
+  for (int v = 0; v < int(sizeof(vexts) / sizeof(vexts[0])); v++)
+  {
+    const X86_VEXT vext = vexts[v];
+    if (vext > detected)
+    {
+      continue;
+    }
+    CoordinateOps simdOps;
+    switch (vext)
+    {
+#if MM_FAST_TRIG
+    case AVX:   simdOps._initCoordinateOpsX86<AVX>(); break;
+    case AVX2:  simdOps._initCoordinateOpsX86<AVX2>(); break;
+#endif
+    default:    simdOps._initCoordinateOpsX86<SSE41>(); break;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "coordinate conversion %s vs. %s (bit-exact)", vextNames[v], refName);
+    passed = checkCoordinateOpsExact(name, simdOps, rng) && passed;
+  }
+#else
+  printf("coordinate conversion SIMD kernels not compiled, %s reference only\n", refName);
+#endif
+  return passed;
+}
+
+// ====================================================================================================================
+// Fixed-point reprojection
+// ====================================================================================================================
+
+/// Tolerance of the fixed-point reprojection against the floating point models: the moved subblock origins may differ by
+/// one unit of the fractional precision (1/16 luma sample, 1/32 chroma sample in 4:2:0) in at most 0.1% of the positions.
+/// The distance is measured on the sphere in units of the equator: horizontal differences are taken modulo the picture
+/// width and scaled with the sine of the polar angle, as all positions on a pole row are the same point. Subblock
+/// origins on the epipole of a geodesic model are excluded, their direction of motion is undefined in both models.
+static const double FIXED_POINT_MAX_DIFF      = 1.0;
+static const double FIXED_POINT_MAX_DIFF_RATE = 0.001;
+
+static bool checkFixedPointReprojection()
+{
+  const Size                resolution(256, 128);
+  EquirectangularProjection erp(resolution);
+  EpipoleList               epipoleList;
+  const Array3TCoord        cameraPoseEpipole(TCoord(0.3), TCoord(0.5), TCoord(0.8));
+  epipoleList.addEpipole(cameraPoseEpipole, -1, -1, true);
+  const MotionModelID motionModels[] = { TANGENTIAL, ROTATIONAL, GEODESIC_X, GEODESIC_Y, GEODESIC_Z, GEODESIC_CAMPOSE };
+
+  bool passed = true;
+  for (int flavor = 0; flavor < 2; flavor++)
+  {
+    for (int offset4x4 = 0; offset4x4 <= 4; offset4x4 += 2)
+    {
+      SPS floatSPS, fixedSPS;
+      for (SPS *sps: { &floatSPS, &fixedSPS })
+      {
+        sps->setUseTAN(true);
+        sps->setUseROT(true);
+        sps->setUseGED(true);
+        sps->setUseGEDA(true);
+        sps->setGEDFlavor(flavor ? GeodesicMotionModel::VISHWANATH_MODULATED : GeodesicMotionModel::VISHWANATH_ORIGINAL);
+        sps->setMMOffset4x4(offset4x4);
+      }
+      fixedSPS.setUseMMFixedPoint(true);
+      MVReprojection        floatReprojection, fixedReprojection;
+      MVReprojectionContext floatContext, fixedContext;
+      floatReprojection.init(&erp, resolution, &floatSPS, &epipoleList);
+      fixedReprojection.init(&erp, resolution, &fixedSPS, &epipoleList);
+      const double offset = offset4x4 == 4 ? 1.5 : offset4x4;
+
+      std::mt19937 rng(7);
+      for (MotionModelID motionModelID: motionModels)
+      {
+        Array3TCoord epipole(0, 0, 0);
+        switch (motionModelID)
+        {
+        case GEODESIC_X:       epipole = Array3TCoord(1, 0, 0); break;
+        case GEODESIC_Y:       epipole = Array3TCoord(0, 1, 0); break;
+        case GEODESIC_Z:       epipole = Array3TCoord(0, 0, 1); break;
+        case GEODESIC_CAMPOSE: epipole = cameraPoseEpipole / cameraPoseEpipole.matrix().norm(); break;
+        default:               break;
+        }
+        long   numPositions = 0, numDiff = 0;
+        double maxDiff = 0;
+        for (int comp = 0; comp < 2; comp++)
+        {
+          // Positions in 1/16 luma samples for both components
+          const ComponentID compID = comp ? COMPONENT_Cb : COMPONENT_Y;
+          const int         shift  = MV_FRACTIONAL_BITS_INTERNAL + comp;
+          const int         width  = resolution.width << MV_FRACTIONAL_BITS_INTERNAL;
+          for (int i = 0; i < 2000; i++)
+          {
+            const int w = 8 << (rng() % 3), h = 8 << (rng() % 3);
+            const int x = (rng() % ((resolution.width - w) / 8)) * 8, y = (rng() % ((resolution.height - h) / 8)) * 8;
+            const Mv  mv(int(rng() % 1025) - 512, int(rng() % 513) - 256);
+            SubblockPositions ref, test;
+            floatReprojection.reprojectMotionVectorSubblocks(Position(x >> comp, y >> comp), Size(w >> comp, h >> comp), mv,
+                                                             motionModelID, compID, CHROMA_420, 4, 0, ref, floatContext);
+            fixedReprojection.reprojectMotionVectorSubblocks(Position(x >> comp, y >> comp), Size(w >> comp, h >> comp), mv,
+                                                             motionModelID, compID, CHROMA_420, 4, 0, test, fixedContext);
+            for (int row = 0; row < ref.rows; row++)
+            {
+              for (int col = 0; col < ref.cols; col++)
+              {
+                const Array3TCoord origin = erp.pointToSphere(Array2TCoord(TCoord(x + 4 * col + offset), TCoord(y + 4 * row + offset)));
+                if (std::abs(origin.matrix().dot(epipole.matrix())) > TCoord(1 - 1e-6))
+                {
+                  continue;
+                }
+                const int k  = ref.idx(row, col);
+                const int rx = (ref.xPos[k] << shift) + ref.xFrac[k], ry = (ref.yPos[k] << shift) + ref.yFrac[k];
+                const int tx = (test.xPos[k] << shift) + test.xFrac[k], ty = (test.yPos[k] << shift) + test.yFrac[k];
+                int dx = ((rx - tx) % width + width) % width;
+                dx     = std::min(dx, width - dx);
+                const Array3TCoord moved = erp.pointToSphere(Array2TCoord(TCoord(rx / 16.0 + offset), TCoord(ry / 16.0 + offset)));
+                const double sinPolar = std::sqrt(double(moved[0]) * moved[0] + double(moved[1]) * moved[1]);
+                const double diff     = std::max(dx * sinPolar, double(std::abs(ry - ty)));
+                numPositions++;
+                numDiff += rx != tx || ry != ty;
+                maxDiff = std::max(maxDiff, diff);
+              }
+            }
+          }
+        }
+        char name[96];
+        snprintf(name, sizeof(name), "fixed-point reprojection model %d flavor %d offset %d vs. float", int(motionModelID),
+                 flavor, offset4x4);
+        if (numDiff)
+        {
+          printf("  %ld of %ld positions differ, max. difference on the sphere %.3g\n", numDiff, numPositions, maxDiff);
+        }
+        passed = reportCheck(name, maxDiff <= FIXED_POINT_MAX_DIFF && numDiff <= FIXED_POINT_MAX_DIFF_RATE * numPositions)
+                 && passed;
+      }
+    }
+  }
+  return passed;
+}
+
+// ====================================================================================================================
+// WS-PSNR row kernels
+// ====================================================================================================================
+
+/// Per sample loop of TWSPSNRMetric::xCalculateWSPSNR(), the reference of the per sample weighted row kernel
+static double referenceWeightedSSD(const Pel* org, const Pel* rec, const double* weight, int width, int orgShift,
+                                   int recShift, double ssd)
+{
+  for (int x = 0; x < width; x++)
+  {
+    const Intermediate_Int diff = (Intermediate_Int)((org[x] << orgShift) - (rec[x] << recShift));
+    ssd += diff * diff * weight[x];
+  }
+  return ssd;
+}
+
+/// Per sample integer loop, the reference of the row SSD kernel of ERP
+static uint64_t referenceSSD(const Pel* org, const Pel* rec, int width, int orgShift, int recShift)
+{
+  uint64_t ssd = 0;
+  for (int x = 0; x < width; x++)
+  {
+    const Intermediate_Int diff = (Intermediate_Int)((org[x] << orgShift) - (rec[x] << recShift));
+    ssd += uint64_t(diff * diff);
+  }
+  return ssd;
+}
+
+/// Run both row kernels of ops on rows of random samples and weights, the running sums are carried from row to row as
+/// in TWSPSNRMetric::xCalculateRowBasedSSD(); returns the number of results that are not bit-exact with the reference
+static int checkWeightedSSDKernels(const PelBufferOps &ops, std::mt19937 &rng)
+{
+  std::uniform_int_distribution<int>    sample(0, 1023);
+  std::uniform_real_distribution<double> weightDist(0.0, 1.0);
+  int numDiff = 0;
+  // Lengths that are not multiples of the vector width exercise the remainder handling
+  for (int width: { 1, 3, 4, 7, 8, 13, 255, 4099 })
+  {
+    std::vector<Pel>    org(width), rec(width);
+    std::vector<double> weight(width);
+    for (int shift = 0; shift <= 2; shift++)
+    {
+      double ref = 0, refUniform = 0, test = 0, testUniform = 0;
+      for (int row = 0; row < 16; row++)
+      {
+        for (int x = 0; x < width; x++)
+        {
+          org[x]    = Pel(sample(rng) >> shift);
+          rec[x]    = Pel(sample(rng) >> (2 - shift));
+          // Zero weights as in the padding of ERP and the inactive regions of the other geometries
+          weight[x] = x % 11 == 5 ? 0.0 : weightDist(rng);
+        }
+        ref         = referenceWeightedSSD(org.data(), rec.data(), weight.data(), width, shift, 2 - shift, ref);
+        test        = ops.calcRowWeightedSSD(org.data(), rec.data(), weight.data(), width, shift, 2 - shift, test);
+        refUniform  += weight[0] * (double) referenceSSD(org.data(), rec.data(), width, shift, 2 - shift);
+        testUniform += weight[0] * (double) ops.calcRowSSD(org.data(), rec.data(), width, shift, 2 - shift);
+        numDiff += memcmp(&ref, &test, sizeof(double)) != 0;
+        numDiff += memcmp(&refUniform, &testUniform, sizeof(double)) != 0;
+      }
+    }
+  }
+  return numDiff;
+}
+
+static bool checkWSPSNRKernels()
+{
+  // The weighted kernel adds the weighted squared differences in sample order, the row SSD of ERP is an exact integer
+  // sum; both have to be bit-exact with the per sample loops
+  std::mt19937 rng(42);
+  const PelBufferOps scalarOps;
+  bool passed = reportCheck("WS-PSNR row kernels C vs. per sample loop (bit-exact)", checkWeightedSSDKernels(scalarOps, rng) == 0);
+
+#if ENABLE_SIMD_OPT_BUFFER && defined(TARGET_SIMD_X86)
+  const X86_VEXT detected = read_x86_extension_flags();
+  const X86_VEXT vexts[]     = { SSE41, AVX, AVX2 };
+  const char*    vextNames[] = { "SSE41", "AVX", "AVX2" };
+  for (int v = 0; v < 3; v++)
+  {
+    const X86_VEXT vext = vexts[v];
+    if (vext > detected)
+    {
+      continue;
+    }
+    PelBufferOps simdOps;
+    switch (vext)
+    {
+    case SSE41: simdOps._initPelBufOpsX86<SSE41>(); break;
+    case AVX:   simdOps._initPelBufOpsX86<AVX>(); break;
+    default:    simdOps._initPelBufOpsX86<AVX2>(); break;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "WS-PSNR row kernels %s vs. per sample loop (bit-exact)", vextNames[v]);
+    passed = reportCheck(name, checkWeightedSSDKernels(simdOps, rng) == 0) && passed;
+  }
+#endif
+  return passed;
+}
+
+// ====================================================================================================================
+// Main function
+// ====================================================================================================================
+
+int main(int argc, char* argv[])
+{
+  if(argc != 1)
+  {
+    printf("usage: %s\n", argv[0]);
+    printf("checks the optimized kernels of the multi-model extension against their reference implementations\n");
+    return 1;
+  }
+
+  bool passed = true;
+  passed = checkCoordinateOps() && passed;
+  passed = checkFixedPointReprojection() && passed;
+  passed = checkWSPSNRKernels() && passed;
+
+  printf("%s\n", passed ? "all checks passed" : "CHECKS FAILED");
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SphPointConvertApp.cpp
+    \brief    converts the text sphere points files of the S-PSNR metrics into the binary format
+*/
+
+#include <cstdio>
+#include <cstring>
+#include "Lib360/TSphPointSet.h"
+
+int main(int argc, char* argv[])
+{
+  if(argc != 3)
+  {
+    printf("usage: %s <sphere points text file> <binary output file>\n", argv[0]);
+    printf("converts a sphere points file (e.g. sphere_655362.txt) into the binary format which the S-PSNR metrics memory map (SphFile)\n");
+    return 1;
+  }
+
+  TSphPointSet cPoints;
+  if(TSphPointSet::isBinaryFile(argv[1]))
+  {
+    printf("%s is already a binary sphere points file\n", argv[1]);
+    return 1;
+  }
+  if(!cPoints.load(argv[1]))
+  {
+    printf("cannot open %s\n", argv[1]);
+    return 1;
+  }
+  if(!TSphPointSet::writeBinaryFile(argv[2], cPoints.getPoints(), cPoints.getNumPoints()))
+  {
+    printf("cannot write %s\n", argv[2]);
+    return 1;
+  }
+
+  //read back the written file and check that the points are identical;
+  TSphPointSet cCheck;
+  if(!cCheck.load(argv[2]) || cCheck.getNumPoints() != cPoints.getNumPoints()
+    || memcmp(cCheck.getPoints(), cPoints.getPoints(), cPoints.getNumPoints() * sizeof(CPos2D)))
+  {
+    printf("verification of %s failed\n", argv[2]);
+    return 1;
+  }
+  printf("%d sphere points written to %s\n", cPoints.getNumPoints(), argv[2]);
+  return 0;
+}
@@ -527,6 +527,9 @@ Void TExt360AppEncCfg::addOptions(df::program_options_lite::Options &opts, TExt3
 #if SVIDEO_SPSNR_NN || SVIDEO_SPSNR_I || SVIDEO_CF_SPSNR_NN || SVIDEO_CF_SPSNR_I || SVIDEO_CODEC_SPSNR_NN
   ("SphFile",                                    m_sphFilename,                                           std::string(""),         "Spherical points data file name for S-PSNR calculation")
 #endif
+#if SVIDEO_BINARY_SPHERE_POINTS && (SVIDEO_SPSNR_NN || SVIDEO_CODEC_SPSNR_NN)
+  ("SphTableCacheDir",                           m_sphTableCacheDir,                                      std::string(""),         "Directory of the cached S-PSNR-NN sampling position tables (empty: no cache)")
+#endif
 #if SVIDEO_WSPSNR
   ("WSPSNR,-wspsnr",                             m_bWSPSNREnabled,                            true,  "Flag to enable ws-psnr calculation")
 #endif
@@ -556,6 +559,15 @@ Void TExt360AppEncCfg::addOptions(df::program_options_lite::Options &opts, TExt3
 #if SVIDEO_CF_CPPPSNR
   ("CF_CPP_PSNR,-cf_cpppsnr",               m_bCFCPPPSNREnabled,                           true, "Flag to enable cross format cpp-psnr calculation")
 #endif
+#if SVIDEO_ASYNC_METRICS
+  ("AsyncMetrics",                          m_asyncMetricsQueueSize,                       0u,   "Number of pictures queued for calculating the 360 metrics on a background thread (0: calculate synchronously)")
+#endif
+#if SVIDEO_PARALLEL_GEOCONVERT
+  ("GeoConvertThreads",                     m_geoConvertThreads,                           1u,   "Number of threads converting the source geometry to the coding geometry (1: serial)")
+#endif
+#if SVIDEO_GEOMAP_CACHE
+  ("GeoMapCacheDir",                        m_geoMapCacheDir,                              std::string(""), "Directory of the cached geometry mapping tables (empty: no cache)")
+#endif
 #if SVIDEO_HEMI_PROJECTIONS
   ("CodingPCMP",                            m_codingSVideoInfo.bPCMP,                      false,  "Enable padded hemisphere-based projection format coding")
 #endif
@@ -2062,6 +2074,9 @@ Bool TExt360AppEncCfg::verifyParameters()
   if(m_bSVideo)
   {
     xConfirmPara(m_faceSizeAlignment<0, "FaceSizeAlignment must be no less than 0");
+#if SVIDEO_PARALLEL_GEOCONVERT
+    xConfirmPara(m_geoConvertThreads<1, "GeoConvertThreads must be at least 1");
+#endif
     //check source;
     if(   m_sourceSVideoInfo.geoType == SVIDEO_EQUIRECT 
 #if SVIDEO_ADJUSTED_EQUALAREA
@@ -2547,6 +2562,12 @@ Void TExt360AppEncCfg::outputConfigurationSummary()
       printf("Codec S-PSNR-NN is enabled; SphFile file: %s\n", m_sphFilename.empty() ? "NULL" : m_sphFilename.c_str());
     }
 #endif
+#if SVIDEO_BINARY_SPHERE_POINTS
+    if(!m_sphTableCacheDir.empty())
+    {
+      printf("S-PSNR-NN sampling position tables are cached in %s\n", m_sphTableCacheDir.c_str());
+    }
+#endif
 #endif
 #if SVIDEO_WSPSNR
     if(m_bWSPSNREnabled)
@@ -2624,6 +2645,18 @@ Void TExt360AppEncCfg::outputConfigurationSummary()
     if(m_bCFCPPPSNREnabled)
       printf("Cross-format CPP-PSNR is enabled\n");
 #endif
+#if SVIDEO_ASYNC_METRICS
+    if(m_asyncMetricsQueueSize)
+      printf("360 metrics are calculated asynchronously; queue size: %u\n", m_asyncMetricsQueueSize);
+#endif
+#if SVIDEO_PARALLEL_GEOCONVERT
+    if(m_geoConvertThreads > 1)
+      printf("Geometry conversion threads: %u\n", m_geoConvertThreads);
+#endif
+#if SVIDEO_GEOMAP_CACHE
+    if(!m_geoMapCacheDir.empty())
+      printf("Geometry mapping tables are cached in %s\n", m_geoMapCacheDir.c_str());
+#endif
 #if SVIDEO_ROT_FIX
     printf("Rotation in 1/100 degrees: (yaw:%d  pitch:%d  roll:%d)\n", m_codingSVideoInfo.sVideoRotation.degree[2], m_codingSVideoInfo.sVideoRotation.degree[1], m_codingSVideoInfo.sVideoRotation.degree[0]); 
 #endif
@@ -78,6 +78,9 @@ protected:
 #if SVIDEO_SPSNR_NN || SVIDEO_SPSNR_I || SVIDEO_CF_SPSNR_NN || SVIDEO_CF_SPSNR_I || SVIDEO_CODEC_SPSNR_NN
   std::string m_sphFilename;
 #endif
+#if SVIDEO_BINARY_SPHERE_POINTS && (SVIDEO_SPSNR_NN || SVIDEO_CODEC_SPSNR_NN)
+  std::string m_sphTableCacheDir;
+#endif
 #if SVIDEO_WSPSNR
   Bool      m_bWSPSNREnabled;
 #if SVIDEO_WSPSNR_E2E
@@ -99,6 +102,15 @@ protected:
 #if SVIDEO_CF_CPPPSNR
   Bool     m_bCFCPPPSNREnabled;
 #endif
+#if SVIDEO_ASYNC_METRICS
+  UInt     m_asyncMetricsQueueSize;                         ///< pictures queued for the 360 metrics thread; 0: synchronous calculation;
+#endif
+#if SVIDEO_PARALLEL_GEOCONVERT
+  UInt     m_geoConvertThreads;                             ///< threads generating and applying the geometry mapping of the input conversion;
+#endif
+#if SVIDEO_GEOMAP_CACHE
+  std::string m_geoMapCacheDir;                             ///< directory of the cached geometry mapping tables; empty: no cache;
+#endif
 
   EncAppCfg &m_cfg;
   friend class TExt360AppEncTop;
@@ -139,8 +139,23 @@ Void TExt360AppEncTop::xCreate(EncGOP &encGop, PelStorage &yuvOrig)
     m_pcInputGeomtry  = TGeometry::create(extCfg.m_sourceSVideoInfo, &extCfg.m_inputGeoParam);
     m_pcCodingGeomtry = TGeometry::create(extCfg.m_codingSVideoInfo, &extCfg.m_inputGeoParam);
 #endif
+#if SVIDEO_PARALLEL_GEOCONVERT
+    if(m_pcCodingGeomtry)
+    {
+      m_pcCodingGeomtry->setNumGeoConvertThreads(extCfg.m_geoConvertThreads);
+    }
+#endif
+#if SVIDEO_GEOMAP_CACHE
+    if(m_pcCodingGeomtry)
+    {
+      m_pcCodingGeomtry->setGeoMapCacheDir(extCfg.m_geoMapCacheDir);
+    }
+#endif
 #if SVIDEO_E2E_METRICS
     m_ext360EncGop.initE2EMetricsCalc(extCfg.m_sourceSVideoInfo, extCfg.m_codingSVideoInfo, &extCfg.m_inputGeoParam, m_cTVideoIOYuvInputFile4E2EMetrics, cfg.m_InputChromaFormatIDC, cfg.m_inputFileWidth, cfg.m_inputFileHeight, cfg.m_temporalSubsampleRatio);
+#if SVIDEO_GEOMAP_CACHE
+    m_ext360EncGop.setGeoMapCacheDir(extCfg.m_geoMapCacheDir);
+#endif
 #endif
 #if SVIDEO_VIEWPORT_PSNR
     if(extCfg.m_viewPortPSNRParam.bViewPortPSNREnabled)
@@ -177,6 +192,9 @@ Void TExt360AppEncTop::xCreate(EncGOP &encGop, PelStorage &yuvOrig)
       m_ext360EncGop.getSPSNRMetric()->setOutputBitDepth(cfg.m_internalBitDepth);
       m_ext360EncGop.getSPSNRMetric()->setReferenceBitDepth(cfg.m_internalBitDepth);
       m_ext360EncGop.getSPSNRMetric()->sphSampoints(extCfg.m_sphFilename);
+#if SVIDEO_BINARY_SPHERE_POINTS
+      m_ext360EncGop.getSPSNRMetric()->setTableCacheDir(extCfg.m_sphTableCacheDir);
+#endif
 #if SVIDEO_E2E_METRICS
       m_ext360EncGop.getSPSNRMetric()->createTable(m_pcInputGeomtry);
 #else
@@ -190,6 +208,9 @@ Void TExt360AppEncTop::xCreate(EncGOP &encGop, PelStorage &yuvOrig)
       m_ext360EncGop.getCodecSPSNRMetric()->setOutputBitDepth(cfg.m_internalBitDepth);
       m_ext360EncGop.getCodecSPSNRMetric()->setReferenceBitDepth(cfg.m_internalBitDepth);
       m_ext360EncGop.getCodecSPSNRMetric()->sphSampoints(extCfg.m_sphFilename);
+#if SVIDEO_BINARY_SPHERE_POINTS
+      m_ext360EncGop.getCodecSPSNRMetric()->setTableCacheDir(extCfg.m_sphTableCacheDir);
+#endif
       m_ext360EncGop.getCodecSPSNRMetric()->createTable(m_pcCodingGeomtry);
     }
 #endif
@@ -280,6 +301,9 @@ Void TExt360AppEncTop::xCreate(EncGOP &encGop, PelStorage &yuvOrig)
       m_ext360EncGop.getCFCPPPSNRMetric()->setReferenceBitDepth(cfg.m_internalBitDepth);
       m_ext360EncGop.getCFCPPPSNRMetric()->initCPPPSNR(extCfg.m_inputGeoParam, cfg.m_sourceWidth, cfg.m_sourceHeight, extCfg.m_codingSVideoInfo, extCfg.m_sourceSVideoInfo);
     }
+#endif
+#if SVIDEO_ASYNC_METRICS
+    m_ext360EncGop.initAsyncMetrics(extCfg.m_asyncMetricsQueueSize);
 #endif
   }
 }
@@ -50,10 +50,34 @@ TExt360EncGop::TExt360EncGop()
   m_pRefGeometry = nullptr;
   m_pRecGeometry = nullptr;
 #endif
+#if SVIDEO_ASYNC_METRICS
+  m_numSubmittedJobs = 0;
+  m_numComputedJobs = 0;
+  m_numMergedJobs = 0;
+  m_bAsyncShutdown = false;
+#endif
 }
 
 TExt360EncGop::~TExt360EncGop()
 {
+#if SVIDEO_ASYNC_METRICS
+  if(m_asyncThread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_asyncMutex);
+      m_bAsyncShutdown = true;
+    }
+    m_asyncCondition.notify_all();
+    m_asyncThread.join();
+  }
+  for(size_t i=0; i<m_asyncJobs.size(); i++)
+  {
+    m_asyncJobs[i]->orgPicYuv.destroy();
+    m_asyncJobs[i]->recPicYuv.destroy();
+    delete m_asyncJobs[i];
+  }
+  m_asyncJobs.clear();
+#endif
 #if SVIDEO_E2E_METRICS
   if(m_pRefGeometry)
   {
@@ -81,10 +105,23 @@ TExt360EncGop::~TExt360EncGop()
 
 Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
 {
+#if SVIDEO_ASYNC_METRICS
+  if(!m_asyncJobs.empty())
+  {
+    xSubmitAsyncMetrics(pcPic);
+    return;
+  }
+#endif
   PelUnitBuf recPicYuv = pcPic->getRecoBuf();
   PelUnitBuf orgPicYuv = pcPic->getOrigBuf();
+  xCalculatePSNRs(pcPic->getPOC(), orgPicYuv, recPicYuv);
+  xStoreMetrics(m_picMetrics);
+}
+
+Void TExt360EncGop::xCalculatePSNRs(Int iPOC, PelUnitBuf &orgPicYuv, PelUnitBuf &recPicYuv)
+{
 #if SVIDEO_E2E_METRICS
-  readOrigPicYuv(pcPic->getPOC());
+  readOrigPicYuv(iPOC);
   reconstructPicYuv(recPicYuv);
 #endif
 #if SVIDEO_SPSNR_NN
@@ -121,7 +158,7 @@ Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
 #if SVIDEO_E2E_METRICS
     getE2EWSPSNRMetric()->xCalculateE2EWSPSNR(getRecPicYuv(),  getOrigPicYuv());
 #else
-    getE2EWSPSNRMetric()->xCalculateE2EWSPSNR(&recPicYuv, pcPic->getPOC());
+    getE2EWSPSNRMetric()->xCalculateE2EWSPSNR(&recPicYuv, iPOC);
 #endif
   }
 #endif
@@ -150,16 +187,16 @@ Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
   if(getViewPortPSNRMetric()->isEnabled())
   {
 #if SVIDEO_E2E_METRICS
-    getViewPortPSNRMetric()->xCalculatePSNR(pcPic, getOrigPicYuv());
+    getViewPortPSNRMetric()->xCalculatePSNR(iPOC, recPicYuv, getOrigPicYuv());
 #else
-    getViewPortPSNRMetric()->xCalculatePSNR(pcPic);
+    getViewPortPSNRMetric()->xCalculatePSNR(iPOC, recPicYuv);
 #endif
   }
 #endif
 #if SVIDEO_DYNAMIC_VIEWPORT_PSNR
   if(getDynamicViewPortPSNRMetric()->isEnabled())
   {
-    getDynamicViewPortPSNRMetric()->xCalculateDynamicViewPSNR(pcPic, getOrigPicYuv());
+    getDynamicViewPortPSNRMetric()->xCalculateDynamicViewPSNR(iPOC, recPicYuv, getOrigPicYuv());
   }
 #endif
 #if SVIDEO_CF_SPSNR_NN
@@ -182,8 +219,72 @@ Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
 #endif
 }
 
+Void TExt360EncGop::xStoreMetrics(PicMetrics &picMetrics)
+{
+  const size_t resultSize = sizeof(Double) * MAX_NUM_COMPONENT;
+#if SVIDEO_SPSNR_NN
+  memcpy(picMetrics.dSPSNR, getSPSNRMetric()->getSPSNR(), resultSize);
+#if SVIDEO_CODEC_SPSNR_NN
+  memcpy(picMetrics.dCodecSPSNR, getCodecSPSNRMetric()->getSPSNR(), resultSize);
+#endif
+#endif
+#if SVIDEO_WSPSNR
+  memcpy(picMetrics.dWSPSNR, getWSPSNRMetric()->getWSPSNR(), resultSize);
+#if SVIDEO_WSPSNR_E2E
+  memcpy(picMetrics.dE2EWSPSNR, getE2EWSPSNRMetric()->getWSPSNR(), resultSize);
+#endif
+#endif
+#if SVIDEO_SPSNR_I
+  memcpy(picMetrics.dSPSNRI, getSPSNRIMetric()->getSPSNRI(), resultSize);
+#endif
+#if SVIDEO_CPPPSNR
+  memcpy(picMetrics.dCPPPSNR, getCPPPSNRMetric()->getCPPPSNR(), resultSize);
+#endif
+#if SVIDEO_VIEWPORT_PSNR
+  if(getViewPortPSNRMetric()->isEnabled())
+  {
+    picMetrics.viewPortPSNR.resize(getViewPortPSNRMetric()->getNumOfViewPorts() * MAX_NUM_COMPONENT);
+    for(Int i=0; i<getViewPortPSNRMetric()->getNumOfViewPorts(); i++)
+    {
+      memcpy(picMetrics.getViewPortPSNR(i), getViewPortPSNRMetric()->getPSNR(i), resultSize);
+    }
+  }
+#endif
+#if SVIDEO_DYNAMIC_VIEWPORT_PSNR
+  if(getDynamicViewPortPSNRMetric()->isEnabled())
+  {
+    picMetrics.dynamicViewPortPSNR.resize(getDynamicViewPortPSNRMetric()->getNumOfViewPorts() * MAX_NUM_COMPONENT);
+    for(Int i=0; i<getDynamicViewPortPSNRMetric()->getNumOfViewPorts(); i++)
+    {
+      memcpy(picMetrics.getDynamicViewPortPSNR(i), getDynamicViewPortPSNRMetric()->getPSNR(i), resultSize);
+    }
+  }
+#endif
+#if SVIDEO_CF_SPSNR_NN
+  memcpy(picMetrics.dCFSPSNR, getCFSPSNRMetric()->getSPSNR(), resultSize);
+#endif
+#if SVIDEO_CF_SPSNR_I
+  memcpy(picMetrics.dCFSPSNRI, getCFSPSNRIMetric()->getSPSNRI(), resultSize);
+#endif
+#if SVIDEO_CF_CPPPSNR
+  memcpy(picMetrics.dCFCPPPSNR, getCFCPPPSNRMetric()->getCPPPSNR(), resultSize);
+#endif
+}
 
 Void TExt360EncGop::addResult(Analyze &encAnalyze)
+{
+#if SVIDEO_ASYNC_METRICS
+  if(!m_asyncJobs.empty())
+  {
+    // added when the results of the picture are merged
+    m_asyncJobs[(m_numSubmittedJobs - 1) % m_asyncJobs.size()]->analyzers.push_back(&encAnalyze);
+    return;
+  }
+#endif
+  xAddResult(encAnalyze, m_picMetrics);
+}
+
+Void TExt360EncGop::xAddResult(Analyze &encAnalyze, PicMetrics &picMetrics)
 {
   TExt360EncAnalyze &ext360EncAnalyze=encAnalyze.getExt360Info();
 
@@ -191,13 +292,13 @@ Void TExt360EncGop::addResult(Analyze &encAnalyze)
   if(getSPSNRMetric()->getSPSNREnabled())
   {
     ext360EncAnalyze.setSPSNREnabled(true);
-    ext360EncAnalyze.addSPSNR(getSPSNRMetric()->getSPSNR());
+    ext360EncAnalyze.addSPSNR(picMetrics.dSPSNR);
   }
 #if SVIDEO_CODEC_SPSNR_NN
   if(getCodecSPSNRMetric()->getSPSNREnabled())
   {
     ext360EncAnalyze.setCodecSPSNREnabled(true);
-    ext360EncAnalyze.addCodecSPSNR(getCodecSPSNRMetric()->getSPSNR());
+    ext360EncAnalyze.addCodecSPSNR(picMetrics.dCodecSPSNR);
   }
 #endif
 #endif
@@ -205,13 +306,13 @@ Void TExt360EncGop::addResult(Analyze &encAnalyze)
   if(getWSPSNRMetric()->getWSPSNREnabled())
   {
     ext360EncAnalyze.setWSPSNREnabled(true);
-    ext360EncAnalyze.addWSPSNR(getWSPSNRMetric()->getWSPSNR());
+    ext360EncAnalyze.addWSPSNR(picMetrics.dWSPSNR);
   }
 #if SVIDEO_WSPSNR_E2E
   if(getE2EWSPSNRMetric()->getWSPSNREnabled())
   {
     ext360EncAnalyze.setE2EWSPSNREnabled(true);
-    ext360EncAnalyze.addE2EWSPSNR(getE2EWSPSNRMetric()->getWSPSNR());
+    ext360EncAnalyze.addE2EWSPSNR(picMetrics.dE2EWSPSNR);
   }
 #endif
 #endif
@@ -219,49 +320,49 @@ Void TExt360EncGop::addResult(Analyze &encAnalyze)
   if(getSPSNRIMetric()->getSPSNRIEnabled())
   {
     ext360EncAnalyze.setSPSNRIEnabled(true);
-    ext360EncAnalyze.addSPSNRI(getSPSNRIMetric()->getSPSNRI());
+    ext360EncAnalyze.addSPSNRI(picMetrics.dSPSNRI);
   }
 #endif
 #if SVIDEO_CPPPSNR
   if(getCPPPSNRMetric()->getCPPPSNREnabled())
   {
     ext360EncAnalyze.setCPPPSNREnabled(true);
-    ext360EncAnalyze.addCPPPSNR(getCPPPSNRMetric()->getCPPPSNR());
+    ext360EncAnalyze.addCPPPSNR(picMetrics.dCPPPSNR);
   }
 #endif
 #if SVIDEO_VIEWPORT_PSNR
   if(getViewPortPSNRMetric()->isEnabled())
   {
     ext360EncAnalyze.setViewPortPSNREnabled(true);
-    ext360EncAnalyze.addViewPortPSNR(getViewPortPSNRMetric()->getPSNR(0));
+    ext360EncAnalyze.addViewPortPSNR(picMetrics.getViewPortPSNR(0));
   }
 #endif
 #if SVIDEO_CF_SPSNR_NN
   if(getCFSPSNRMetric()->getSPSNREnabled())
   {
     ext360EncAnalyze.setCFSPSNREnabled(true);
-    ext360EncAnalyze.addCFSPSNR(getCFSPSNRMetric()->getSPSNR());
+    ext360EncAnalyze.addCFSPSNR(picMetrics.dCFSPSNR);
   }
 #endif
 #if SVIDEO_CF_SPSNR_I
   if(getCFSPSNRIMetric()->getSPSNRIEnabled())
   {
     ext360EncAnalyze.setCFSPSNRIEnabled(true);
-    ext360EncAnalyze.addCFSPSNRI(getCFSPSNRIMetric()->getSPSNRI());
+    ext360EncAnalyze.addCFSPSNRI(picMetrics.dCFSPSNRI);
   }
 #endif
 #if SVIDEO_CF_CPPPSNR
   if(getCFCPPPSNRMetric()->getCPPPSNREnabled())
   {
     ext360EncAnalyze.setCFCPPPSNREnabled(true);
-    ext360EncAnalyze.addCFCPPPSNR(getCFCPPPSNRMetric()->getCPPPSNR());
+    ext360EncAnalyze.addCFCPPPSNR(picMetrics.dCFCPPPSNR);
   }
 #endif
 #if SVIDEO_DYNAMIC_VIEWPORT_PSNR
   if(getDynamicViewPortPSNRMetric()->isEnabled())
   {
     ext360EncAnalyze.setDynamicViewPortPSNREnabled(true);
-    ext360EncAnalyze.addDynamicViewPortPSNR(getDynamicViewPortPSNRMetric()->getPSNR(0));
+    ext360EncAnalyze.addDynamicViewPortPSNR(picMetrics.getDynamicViewPortPSNR(0));
   }
 #endif
 }
@@ -309,11 +410,27 @@ Void TExt360EncGop::printPsnr(MsgLevel level, bool printHexPsnr, const char *nam
 
 Void TExt360EncGop::printPerPOCInfo(MsgLevel level, bool printHexPsnr)
 {
+#if SVIDEO_ASYNC_METRICS
+  if(!m_asyncJobs.empty())
+  {
+    // printed when the results of the picture are merged
+    AsyncMetricsJob &job = *m_asyncJobs[(m_numSubmittedJobs - 1) % m_asyncJobs.size()];
+    job.bPrintInfo    = true;
+    job.bPrintHexPsnr = job.bPrintHexPsnr || printHexPsnr;
+    job.printLevel    = level;
+    return;
+  }
+#endif
+  xPrintPerPOCInfo(level, printHexPsnr, m_picMetrics);
+}
+
+Void TExt360EncGop::xPrintPerPOCInfo(MsgLevel level, bool printHexPsnr, PicMetrics &picMetrics)
+{
 #if SVIDEO_E2E_METRICS
 #if SVIDEO_WSPSNR && SVIDEO_WSPSNR_REPORT_PER_FRAME
   if (getWSPSNRMetric()->getWSPSNREnabled())
   {
-    printPsnr(level, printHexPsnr, "WSPSNR", TExt360EncGop::getWSPSNRMetric()->getWSPSNR());
+    printPsnr(level, printHexPsnr, "WSPSNR", picMetrics.dWSPSNR);
   }
 #endif
 #endif
@@ -321,15 +438,15 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level, bool printHexPsnr)
 #if SVIDEO_CODEC_SPSNR_NN
   if (getCodecSPSNRMetric()->getSPSNREnabled())
   {
-    printPsnr(level, printHexPsnr, "C_SPSNR_NN", getCodecSPSNRMetric()->getSPSNR());
+    printPsnr(level, printHexPsnr, "C_SPSNR_NN", picMetrics.dCodecSPSNR);
   }
 #endif
   if (getSPSNRMetric()->getSPSNREnabled())
   {
 #if SVIDEO_E2E_METRICS
-    printPsnr(level, printHexPsnr, "E2ESPSNR_NN", getSPSNRMetric()->getSPSNR());
+    printPsnr(level, printHexPsnr, "E2ESPSNR_NN", picMetrics.dSPSNR);
 #else
-    printPsnr(level, printHexPsnr, "SPSNR_NN", getSPSNRMetric()->getSPSNR());
+    printPsnr(level, printHexPsnr, "SPSNR_NN", picMetrics.dSPSNR);
 #endif
   }
 #endif
@@ -337,7 +454,7 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level, bool printHexPsnr)
 #if SVIDEO_WSPSNR && SVIDEO_WSPSNR_REPORT_PER_FRAME
   if (getWSPSNRMetric()->getWSPSNREnabled())
   {
-    printPsnr(level, printHexPsnr, "WSPSNR", getWSPSNRMetric()->getWSPSNR());
+    printPsnr(level, printHexPsnr, "WSPSNR", picMetrics.dWSPSNR);
   }
 #endif
 #endif
@@ -345,9 +462,9 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level, bool printHexPsnr)
   if (getSPSNRIMetric()->getSPSNRIEnabled())
   {
 #if SVIDEO_E2E_METRICS
-    printPsnr(level, printHexPsnr, "E2ESPSNR_I", getSPSNRIMetric()->getSPSNRI());
+    printPsnr(level, printHexPsnr, "E2ESPSNR_I", picMetrics.dSPSNRI);
 #else
-    printPsnr(level, printHexPsnr, "SPSNR_I", getSPSNRIMetric()->getSPSNRI());
+    printPsnr(level, printHexPsnr, "SPSNR_I", picMetrics.dSPSNRI);
 #endif
   }
 #endif
@@ -355,16 +472,16 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level, bool printHexPsnr)
   if (getCPPPSNRMetric()->getCPPPSNREnabled())
   {
 #if SVIDEO_E2E_METRICS
-    printPsnr(level, printHexPsnr, "E2ECPPPSNR", getCPPPSNRMetric()->getCPPPSNR());
+    printPsnr(level, printHexPsnr, "E2ECPPPSNR", picMetrics.dCPPPSNR);
 #else
-    printPsnr(level, printHexPsnr, "CPPPSNR", getCPPPSNRMetric()->getCPPPSNR());
+    printPsnr(level, printHexPsnr, "CPPPSNR", picMetrics.dCPPPSNR);
 #endif
   }
 #endif
 #if SVIDEO_WSPSNR_E2E && SVIDEO_WSPSNR_E2E_REPORT_PER_FRAME
   if (getE2EWSPSNRMetric()->getWSPSNREnabled())
   {
-    printPsnr(level, printHexPsnr, "E2EWSPSNR", getE2EWSPSNRMetric()->getWSPSNR());
+    printPsnr(level, printHexPsnr, "E2EWSPSNR", picMetrics.dE2EWSPSNR);
   }
 #endif
 #if SVIDEO_VIEWPORT_PSNR && SVIDEO_VIEWPORT_PSNR_REPORT_PER_FRAME
@@ -374,7 +491,7 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level, bool printHexPsnr)
     for (Int i = 0; i<getViewPortPSNRMetric()->getNumOfViewPorts(); i++)
     {
       sprintf(tmp, "PSNR_VP%d", i);
-      printPsnr(level, printHexPsnr, tmp, getViewPortPSNRMetric()->getPSNR(i));
+      printPsnr(level, printHexPsnr, tmp, picMetrics.getViewPortPSNR(i));
     }
   }
 #endif
@@ -385,37 +502,52 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level, bool printHexPsnr)
     for (Int i = 0; i<getDynamicViewPortPSNRMetric()->getNumOfViewPorts(); i++)
     {
       sprintf(tmp, "PSNR_DYN_VP%d", i);
-      printPsnr(level, printHexPsnr, tmp, getDynamicViewPortPSNRMetric()->getPSNR(i));
+      printPsnr(level, printHexPsnr, tmp, picMetrics.getDynamicViewPortPSNR(i));
     }
   }
 #endif
 #if SVIDEO_CF_SPSNR_NN && SVIDEO_CF_SPSNR_NN_REPORT_PER_FRAME
   if (getCFSPSNRMetric()->getSPSNREnabled())
   {
-    printPsnr(level, printHexPsnr, "CFSPSNR_NN", getCFSPSNRMetric()->getSPSNR());
+    printPsnr(level, printHexPsnr, "CFSPSNR_NN", picMetrics.dCFSPSNR);
   }
 #endif
 #if SVIDEO_CF_SPSNR_I && SVIDEO_CF_SPSNR_I_REPORT_PER_FRAME
   if (getCFSPSNRIMetric()->getSPSNRIEnabled())
   {
-    printPsnr(level, printHexPsnr, "CFSPSNR_I", getCFSPSNRIMetric()->getSPSNRI());
+    printPsnr(level, printHexPsnr, "CFSPSNR_I", picMetrics.dCFSPSNRI);
   }
 #endif
 #if SVIDEO_CF_CPPPSNR && SVIDEO_CF_CPPPSNR_REPORT_PER_FRAME
   if (getCFCPPPSNRMetric()->getCPPPSNREnabled())
   {
-    printPsnr(level, printHexPsnr, "CFCPPPSNR", getCFCPPPSNRMetric()->getCPPPSNR());
+    printPsnr(level, printHexPsnr, "CFCPPPSNR", picMetrics.dCFCPPPSNR);
   }
 #endif
 }
 #else
 Void TExt360EncGop::printPerPOCInfo(MsgLevel level)
 {
+#if SVIDEO_ASYNC_METRICS
+  if(!m_asyncJobs.empty())
+  {
+    // printed when the results of the picture are merged
+    AsyncMetricsJob &job = *m_asyncJobs[(m_numSubmittedJobs - 1) % m_asyncJobs.size()];
+    job.bPrintInfo = true;
+    job.printLevel = level;
+    return;
+  }
+#endif
+  xPrintPerPOCInfo(level, m_picMetrics);
+}
+
+Void TExt360EncGop::xPrintPerPOCInfo(MsgLevel level, PicMetrics &picMetrics)
+{
 #if SVIDEO_E2E_METRICS
 #if SVIDEO_WSPSNR && SVIDEO_WSPSNR_REPORT_PER_FRAME
   if(getWSPSNRMetric()->getWSPSNREnabled())
   {
-    msg(level, " [Y-WSPSNR %6.4lf dB   U-WSPSNR %6.4lf dB   V-WSPSNR %6.4lf dB]", getWSPSNRMetric()->getWSPSNR()[COMPONENT_Y], getWSPSNRMetric()->getWSPSNR()[COMPONENT_Cb], getWSPSNRMetric()->getWSPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-WSPSNR %6.4lf dB   U-WSPSNR %6.4lf dB   V-WSPSNR %6.4lf dB]", picMetrics.dWSPSNR[COMPONENT_Y], picMetrics.dWSPSNR[COMPONENT_Cb], picMetrics.dWSPSNR[COMPONENT_Cr] );
   }
 #endif
 #endif
@@ -423,15 +555,15 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level)
 #if SVIDEO_CODEC_SPSNR_NN
   if(getCodecSPSNRMetric()->getSPSNREnabled())
   {
-    msg(level, " [Y-C_SPSNR_NN %6.4lf dB   U-C_SPSNR_NN %6.4lf dB   V-C_SPSNR_NN %6.4lf dB]", getCodecSPSNRMetric()->getSPSNR()[COMPONENT_Y], getCodecSPSNRMetric()->getSPSNR()[COMPONENT_Cb], getCodecSPSNRMetric()->getSPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-C_SPSNR_NN %6.4lf dB   U-C_SPSNR_NN %6.4lf dB   V-C_SPSNR_NN %6.4lf dB]", picMetrics.dCodecSPSNR[COMPONENT_Y], picMetrics.dCodecSPSNR[COMPONENT_Cb], picMetrics.dCodecSPSNR[COMPONENT_Cr] );
   }
 #endif
   if(getSPSNRMetric()->getSPSNREnabled())
   {
 #if SVIDEO_E2E_METRICS
-    msg(level, " [Y-E2ESPSNR_NN %6.4lf dB   U-E2ESPSNR_NN %6.4lf dB   V-E2ESPSNR_NN %6.4lf dB]", getSPSNRMetric()->getSPSNR()[COMPONENT_Y], getSPSNRMetric()->getSPSNR()[COMPONENT_Cb], getSPSNRMetric()->getSPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-E2ESPSNR_NN %6.4lf dB   U-E2ESPSNR_NN %6.4lf dB   V-E2ESPSNR_NN %6.4lf dB]", picMetrics.dSPSNR[COMPONENT_Y], picMetrics.dSPSNR[COMPONENT_Cb], picMetrics.dSPSNR[COMPONENT_Cr] );
 #else
-    msg(level, " [Y-SPSNR_NN %6.4lf dB    U-SPSNR_NN %6.4lf dB    V-SPSNR_NN %6.4lf dB]", getSPSNRMetric()->getSPSNR()[COMPONENT_Y], getSPSNRMetric()->getSPSNR()[COMPONENT_Cb], getSPSNRMetric()->getSPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-SPSNR_NN %6.4lf dB    U-SPSNR_NN %6.4lf dB    V-SPSNR_NN %6.4lf dB]", picMetrics.dSPSNR[COMPONENT_Y], picMetrics.dSPSNR[COMPONENT_Cb], picMetrics.dSPSNR[COMPONENT_Cr] );
 #endif
   }
 #endif
@@ -439,7 +571,7 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level)
 #if SVIDEO_WSPSNR && SVIDEO_WSPSNR_REPORT_PER_FRAME
   if(getWSPSNRMetric()->getWSPSNREnabled())
   {
-    msg(level, " [Y-WSPSNR %6.4lf dB   U-WSPSNR %6.4lf dB   V-WSPSNR %6.4lf dB]", getWSPSNRMetric()->getWSPSNR()[COMPONENT_Y], getWSPSNRMetric()->getWSPSNR()[COMPONENT_Cb], getWSPSNRMetric()->getWSPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-WSPSNR %6.4lf dB   U-WSPSNR %6.4lf dB   V-WSPSNR %6.4lf dB]", picMetrics.dWSPSNR[COMPONENT_Y], picMetrics.dWSPSNR[COMPONENT_Cb], picMetrics.dWSPSNR[COMPONENT_Cr] );
   }
 #endif
 #endif
@@ -447,9 +579,9 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level)
   if(getSPSNRIMetric()->getSPSNRIEnabled())
   {
 #if SVIDEO_E2E_METRICS
-    msg(level, " [Y-E2ESPSNR_I %6.4lf dB   U-E2ESPSNR_I %6.4lf dB   V-E2ESPSNR_I %6.4lf dB]", getSPSNRIMetric()->getSPSNRI()[COMPONENT_Y], getSPSNRIMetric()->getSPSNRI()[COMPONENT_Cb], getSPSNRIMetric()->getSPSNRI()[COMPONENT_Cr] );
+    msg(level, " [Y-E2ESPSNR_I %6.4lf dB   U-E2ESPSNR_I %6.4lf dB   V-E2ESPSNR_I %6.4lf dB]", picMetrics.dSPSNRI[COMPONENT_Y], picMetrics.dSPSNRI[COMPONENT_Cb], picMetrics.dSPSNRI[COMPONENT_Cr] );
 #else
-    msg(level, " [Y-SPSNR_I %6.4lf dB   U-SPSNR_I %6.4lf dB   V-SPSNR_I %6.4lf dB]", getSPSNRIMetric()->getSPSNRI()[COMPONENT_Y], getSPSNRIMetric()->getSPSNRI()[COMPONENT_Cb], getSPSNRIMetric()->getSPSNRI()[COMPONENT_Cr] );
+    msg(level, " [Y-SPSNR_I %6.4lf dB   U-SPSNR_I %6.4lf dB   V-SPSNR_I %6.4lf dB]", picMetrics.dSPSNRI[COMPONENT_Y], picMetrics.dSPSNRI[COMPONENT_Cb], picMetrics.dSPSNRI[COMPONENT_Cr] );
 #endif
   }
 #endif
@@ -457,48 +589,48 @@ Void TExt360EncGop::printPerPOCInfo(MsgLevel level)
   if(getCPPPSNRMetric()->getCPPPSNREnabled())
   {
 #if SVIDEO_E2E_METRICS
-    msg(level, " [Y-E2ECPPPSNR %6.4lf dB   U-E2ECPPPSNR %6.4lf dB   V-E2ECPPPSNR %6.4lf dB]", getCPPPSNRMetric()->getCPPPSNR()[COMPONENT_Y], getCPPPSNRMetric()->getCPPPSNR()[COMPONENT_Cb], getCPPPSNRMetric()->getCPPPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-E2ECPPPSNR %6.4lf dB   U-E2ECPPPSNR %6.4lf dB   V-E2ECPPPSNR %6.4lf dB]", picMetrics.dCPPPSNR[COMPONENT_Y], picMetrics.dCPPPSNR[COMPONENT_Cb], picMetrics.dCPPPSNR[COMPONENT_Cr] );
 #else
-    msg(level, " [Y-CPPPSNR %6.4lf dB   U-CPPPSNR %6.4lf dB   V-CPPPSNR %6.4lf dB]", getCPPPSNRMetric()->getCPPPSNR()[COMPONENT_Y], getCPPPSNRMetric()->getCPPPSNR()[COMPONENT_Cb], getCPPPSNRMetric()->getCPPPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-CPPPSNR %6.4lf dB   U-CPPPSNR %6.4lf dB   V-CPPPSNR %6.4lf dB]", picMetrics.dCPPPSNR[COMPONENT_Y], picMetrics.dCPPPSNR[COMPONENT_Cb], picMetrics.dCPPPSNR[COMPONENT_Cr] );
 #endif
   }
 #endif
 #if SVIDEO_WSPSNR_E2E && SVIDEO_WSPSNR_E2E_REPORT_PER_FRAME
   if(getE2EWSPSNRMetric()->getWSPSNREnabled())
   {
-    msg(level, " [Y-E2EWSPSNR %6.4lf dB   U-E2EWSPSNR %6.4lf dB   V-E2EWSPSNR %6.4lf dB]", getE2EWSPSNRMetric()->getWSPSNR()[COMPONENT_Y], getE2EWSPSNRMetric()->getWSPSNR()[COMPONENT_Cb], getE2EWSPSNRMetric()->getWSPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-E2EWSPSNR %6.4lf dB   U-E2EWSPSNR %6.4lf dB   V-E2EWSPSNR %6.4lf dB]", picMetrics.dE2EWSPSNR[COMPONENT_Y], picMetrics.dE2EWSPSNR[COMPONENT_Cb], picMetrics.dE2EWSPSNR[COMPONENT_Cr] );
   }
 #endif
 #if SVIDEO_VIEWPORT_PSNR && SVIDEO_VIEWPORT_PSNR_REPORT_PER_FRAME
   if(getViewPortPSNRMetric()->isEnabled())
   {
     for(Int i=0; i<getViewPortPSNRMetric()->getNumOfViewPorts(); i++)
-      msg(level, " [Y-PSNR_VP%d %6.4lf dB   U-PSNR_VP%d %6.4lf dB   V-PSNR_VP%d %6.4lf dB]", i, getViewPortPSNRMetric()->getPSNR(i)[COMPONENT_Y], i, getViewPortPSNRMetric()->getPSNR(i)[COMPONENT_Cb], i, getViewPortPSNRMetric()->getPSNR(i)[COMPONENT_Cr] );
+      msg(level, " [Y-PSNR_VP%d %6.4lf dB   U-PSNR_VP%d %6.4lf dB   V-PSNR_VP%d %6.4lf dB]", i, picMetrics.getViewPortPSNR(i)[COMPONENT_Y], i, picMetrics.getViewPortPSNR(i)[COMPONENT_Cb], i, picMetrics.getViewPortPSNR(i)[COMPONENT_Cr] );
   }
 #endif
 #if SVIDEO_DYNAMIC_VIEWPORT_PSNR && SVIDEO_DYNAMIC_VIEWPORT_PSNR_REPORT_PER_FRAME
   if(getDynamicViewPortPSNRMetric()->isEnabled())
   {
     for(Int i=0; i<getDynamicViewPortPSNRMetric()->getNumOfViewPorts(); i++)
-      msg(level, " [Y-PSNR_DYN_VP%d %6.4lf dB   U-PSNR_DYN_VP%d %6.4lf dB   V-PSNR_DYN_VP%d %6.4lf dB]", i, getDynamicViewPortPSNRMetric()->getPSNR(i)[COMPONENT_Y], i, getDynamicViewPortPSNRMetric()->getPSNR(i)[COMPONENT_Cb], i, getDynamicViewPortPSNRMetric()->getPSNR(i)[COMPONENT_Cr] );
+      msg(level, " [Y-PSNR_DYN_VP%d %6.4lf dB   U-PSNR_DYN_VP%d %6.4lf dB   V-PSNR_DYN_VP%d %6.4lf dB]", i, picMetrics.getDynamicViewPortPSNR(i)[COMPONENT_Y], i, picMetrics.getDynamicViewPortPSNR(i)[COMPONENT_Cb], i, picMetrics.getDynamicViewPortPSNR(i)[COMPONENT_Cr] );
   }
 #endif
 #if SVIDEO_CF_SPSNR_NN && SVIDEO_CF_SPSNR_NN_REPORT_PER_FRAME
   if(getCFSPSNRMetric()->getSPSNREnabled())
   {
-    msg(level, " [Y-CFSPSNR_NN %6.4lf dB    U-CFSPSNR_NN %6.4lf dB    V-CFSPSNR_NN %6.4lf dB]", getCFSPSNRMetric()->getSPSNR()[COMPONENT_Y], getCFSPSNRMetric()->getSPSNR()[COMPONENT_Cb], getCFSPSNRMetric()->getSPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-CFSPSNR_NN %6.4lf dB    U-CFSPSNR_NN %6.4lf dB    V-CFSPSNR_NN %6.4lf dB]", picMetrics.dCFSPSNR[COMPONENT_Y], picMetrics.dCFSPSNR[COMPONENT_Cb], picMetrics.dCFSPSNR[COMPONENT_Cr] );
   }
 #endif
 #if SVIDEO_CF_SPSNR_I && SVIDEO_CF_SPSNR_I_REPORT_PER_FRAME
   if(getCFSPSNRIMetric()->getSPSNRIEnabled())
   {
-    msg(level, " [Y-CFSPSNR_I %6.4lf dB    U-CFSPSNR_I %6.4lf dB    V-CFSPSNR_I %6.4lf dB]", getCFSPSNRIMetric()->getSPSNRI()[COMPONENT_Y], getCFSPSNRIMetric()->getSPSNRI()[COMPONENT_Cb], getCFSPSNRIMetric()->getSPSNRI()[COMPONENT_Cr] );
+    msg(level, " [Y-CFSPSNR_I %6.4lf dB    U-CFSPSNR_I %6.4lf dB    V-CFSPSNR_I %6.4lf dB]", picMetrics.dCFSPSNRI[COMPONENT_Y], picMetrics.dCFSPSNRI[COMPONENT_Cb], picMetrics.dCFSPSNRI[COMPONENT_Cr] );
   }
 #endif
 #if SVIDEO_CF_CPPPSNR && SVIDEO_CF_CPPPSNR_REPORT_PER_FRAME
   if(getCFCPPPSNRMetric()->getCPPPSNREnabled())
   {
-    msg(level, " [Y-CFCPPPSNR %6.4lf dB   U-CFCPPPSNR %6.4lf dB   V-CFCPPPSNR %6.4lf dB]", getCFCPPPSNRMetric()->getCPPPSNR()[COMPONENT_Y], getCFCPPPSNRMetric()->getCPPPSNR()[COMPONENT_Cb], getCFCPPPSNRMetric()->getCPPPSNR()[COMPONENT_Cr] );
+    msg(level, " [Y-CFCPPPSNR %6.4lf dB   U-CFCPPPSNR %6.4lf dB   V-CFCPPPSNR %6.4lf dB]", picMetrics.dCFCPPPSNR[COMPONENT_Y], picMetrics.dCFCPPPSNR[COMPONENT_Cb], picMetrics.dCFCPPPSNR[COMPONENT_Cr] );
   }
 #endif
 }
@@ -583,3 +715,132 @@ Void TExt360EncGop::initE2EMetricsCalc(SVideoInfo& sRefVideoInfo, SVideoInfo& sR
     m_pcRecPicYuv->create(m_inputChromaFomat, a, 0, S_PAD_MAX, MEMORY_ALIGN_DEF_SIZE);
 }
 #endif
+
+#if SVIDEO_ASYNC_METRICS
+// Computes the metrics of up to uiQueueSize pictures on a background thread. The pictures are handed to the thread in
+// coding order and their results are merged in the same order, so that the summary is identical to the synchronous
+// computation; only the per picture 360 metrics are printed in separate lines, once available.
+Void TExt360EncGop::initAsyncMetrics(UInt uiQueueSize)
+{
+  CHECK(!m_asyncJobs.empty(), "The asynchronous 360 metrics are already initialized");
+  if(!uiQueueSize)
+  {
+    return;
+  }
+  for(UInt i=0; i<uiQueueSize; i++)
+  {
+    AsyncMetricsJob *pcJob = new AsyncMetricsJob;
+    pcJob->iPOC = 0;
+    pcJob->bPrintInfo = false;
+    pcJob->bPrintHexPsnr = false;
+    pcJob->printLevel = NOTICE;
+    m_asyncJobs.push_back(pcJob);
+  }
+  m_asyncThread = std::thread(&TExt360EncGop::xAsyncMetricsThread, this);
+}
+
+Void TExt360EncGop::waitForAsyncMetrics()
+{
+  if(m_asyncJobs.empty())
+  {
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    m_asyncCondition.wait(lock, [this] { return m_numComputedJobs == m_numSubmittedJobs; });
+  }
+  xMergeAsyncMetrics(false);
+}
+
+Void TExt360EncGop::xSubmitAsyncMetrics(Picture *pcPic)
+{
+  const UInt uiQueueSize = (UInt)m_asyncJobs.size();
+  xMergeAsyncMetrics(false);
+  if(m_numSubmittedJobs - m_numMergedJobs == uiQueueSize)
+  {
+    xMergeAsyncMetrics(true);
+  }
+
+  // the slot is neither used by the metrics thread nor by a pending merge
+  AsyncMetricsJob &job = *m_asyncJobs[m_numSubmittedJobs % uiQueueSize];
+  const PelUnitBuf recPicYuv = pcPic->getRecoBuf();
+  if(job.recPicYuv.bufs.empty())
+  {
+    const Area a = Area(Position(), pcPic->Y());
+    job.orgPicYuv.create(pcPic->chromaFormat, a);
+    job.recPicYuv.create(pcPic->chromaFormat, a);
+  }
+  job.orgPicYuv.copyFrom(pcPic->getOrigBuf());
+  job.recPicYuv.copyFrom(recPicYuv);
+  job.iPOC = pcPic->getPOC();
+  job.analyzers.clear();
+  job.bPrintInfo = false;
+  job.bPrintHexPsnr = false;
+
+  {
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    m_numSubmittedJobs++;
+  }
+  m_asyncCondition.notify_all();
+}
+
+Void TExt360EncGop::xMergeAsyncMetrics(Bool bWaitForOldest)
+{
+  UInt uiNumComputedJobs;
+  {
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    if(bWaitForOldest)
+    {
+      m_asyncCondition.wait(lock, [this] { return m_numComputedJobs != m_numMergedJobs; });
+    }
+    uiNumComputedJobs = m_numComputedJobs;
+  }
+
+  for(; m_numMergedJobs != uiNumComputedJobs; m_numMergedJobs++)
+  {
+    AsyncMetricsJob &job = *m_asyncJobs[m_numMergedJobs % m_asyncJobs.size()];
+    for(size_t i=0; i<job.analyzers.size(); i++)
+    {
+      xAddResult(*job.analyzers[i], job.picMetrics);
+    }
+    if(job.bPrintInfo)
+    {
+      msg(job.printLevel, "POC %4d 360 metrics", job.iPOC);
+#if SVIDEO_HEX_PSNR_SUPPORT
+      xPrintPerPOCInfo(job.printLevel, false, job.picMetrics);
+      if(job.bPrintHexPsnr)
+      {
+        xPrintPerPOCInfo(job.printLevel, true, job.picMetrics);
+      }
+#else
+      xPrintPerPOCInfo(job.printLevel, job.picMetrics);
+#endif
+      msg(job.printLevel, "\n");
+    }
+  }
+}
+
+Void TExt360EncGop::xAsyncMetricsThread()
+{
+  std::unique_lock<std::mutex> lock(m_asyncMutex);
+  while(true)
+  {
+    m_asyncCondition.wait(lock, [this] { return m_bAsyncShutdown || m_numComputedJobs != m_numSubmittedJobs; });
+    if(m_bAsyncShutdown)
+    {
+      return;
+    }
+    AsyncMetricsJob &job = *m_asyncJobs[m_numComputedJobs % m_asyncJobs.size()];
+    lock.unlock();
+
+    PelUnitBuf orgPicYuv = job.orgPicYuv;
+    PelUnitBuf recPicYuv = job.recPicYuv;
+    xCalculatePSNRs(job.iPOC, orgPicYuv, recPicYuv);
+    xStoreMetrics(job.picMetrics);
+
+    lock.lock();
+    m_numComputedJobs++;
+    m_asyncCondition.notify_all();
+  }
+}
+#endif
@@ -56,6 +56,11 @@ class EncGOP;
 #if SVIDEO_VIEWPORT_PSNR
 #include "Lib360/TViewPortPSNR.h"
 #endif
+#if SVIDEO_ASYNC_METRICS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 
 
 class TExt360EncGop
@@ -72,8 +77,69 @@ public:
 #else
   Void printPerPOCInfo(MsgLevel level);
 #endif
+#if SVIDEO_ASYNC_METRICS
+  Void initAsyncMetrics(UInt uiQueueSize);
+  Void waitForAsyncMetrics();
+#endif
 
 private:
+  /// results of all metrics for one picture, kept apart from the metric objects so that they can be handed between threads
+  struct PicMetrics
+  {
+    Double dSPSNR[MAX_NUM_COMPONENT];
+    Double dCodecSPSNR[MAX_NUM_COMPONENT];
+    Double dWSPSNR[MAX_NUM_COMPONENT];
+    Double dE2EWSPSNR[MAX_NUM_COMPONENT];
+    Double dSPSNRI[MAX_NUM_COMPONENT];
+    Double dCPPPSNR[MAX_NUM_COMPONENT];
+    Double dCFSPSNR[MAX_NUM_COMPONENT];
+    Double dCFSPSNRI[MAX_NUM_COMPONENT];
+    Double dCFCPPPSNR[MAX_NUM_COMPONENT];
+    std::vector<Double> viewPortPSNR;         ///< MAX_NUM_COMPONENT values per viewport
+    std::vector<Double> dynamicViewPortPSNR;  ///< MAX_NUM_COMPONENT values per dynamic viewport
+
+    Double* getViewPortPSNR(Int iVPIdx)        { return &viewPortPSNR[iVPIdx * MAX_NUM_COMPONENT]; }
+    Double* getDynamicViewPortPSNR(Int iVPIdx) { return &dynamicViewPortPSNR[iVPIdx * MAX_NUM_COMPONENT]; }
+  };
+
+  Void xCalculatePSNRs(Int iPOC, PelUnitBuf &orgPicYuv, PelUnitBuf &recPicYuv);
+  Void xStoreMetrics(PicMetrics &picMetrics);
+  Void xAddResult(Analyze &encAnalyze, PicMetrics &picMetrics);
+#if SVIDEO_HEX_PSNR_SUPPORT
+  Void xPrintPerPOCInfo(MsgLevel level, bool printHexPsnr, PicMetrics &picMetrics);
+#else
+  Void xPrintPerPOCInfo(MsgLevel level, PicMetrics &picMetrics);
+#endif
+
+  PicMetrics m_picMetrics;  ///< results of the last picture of the synchronous computation
+
+#if SVIDEO_ASYNC_METRICS
+  /// a picture queued for the metrics thread
+  struct AsyncMetricsJob
+  {
+    Int                   iPOC;
+    PelStorage            orgPicYuv;
+    PelStorage            recPicYuv;
+    PicMetrics            picMetrics;
+    std::vector<Analyze*> analyzers;      ///< accessed by the encoding thread only
+    Bool                  bPrintInfo;
+    Bool                  bPrintHexPsnr;
+    MsgLevel              printLevel;
+  };
+
+  Void xSubmitAsyncMetrics(Picture *pcPic);
+  Void xMergeAsyncMetrics(Bool bWaitForOldest);
+  Void xAsyncMetricsThread();
+
+  std::vector<AsyncMetricsJob*> m_asyncJobs;   ///< ring buffer; empty if the metrics are computed synchronously
+  UInt                    m_numSubmittedJobs;
+  UInt                    m_numComputedJobs;
+  UInt                    m_numMergedJobs;   ///< accessed by the encoding thread only
+  Bool                    m_bAsyncShutdown;
+  std::thread             m_asyncThread;
+  std::mutex              m_asyncMutex;
+  std::condition_variable m_asyncCondition;
+#endif
 
 #if SVIDEO_E2E_METRICS
   VideoIOYuv *m_pcTVideoIOYuvInputFile;  //note: reference;
@@ -129,6 +195,9 @@ public:
   Void readOrigPicYuv(Int iPOC);
   Void reconstructPicYuv(PelUnitBuf& InPicYuv);
   Void initE2EMetricsCalc(SVideoInfo& sRefVideoInfo, SVideoInfo& sRecVideoInfo, InputGeoParam *pInGeoParam, VideoIOYuv& yuvInputFile, ChromaFormat inputChromaFomat, Int iInputWidth, Int iInputHeight, UInt tempSubsampleRatio);  
+#if SVIDEO_GEOMAP_CACHE
+  Void setGeoMapCacheDir(const std::string &dir) { m_pRefGeometry->setGeoMapCacheDir(dir); }
+#endif
 #endif
 #if SVIDEO_SPSNR_NN
   TSPSNRMetric* getSPSNRMetric()  {return &m_cSPSNRMetric;}
@@ -322,6 +322,29 @@ void linTfCore( const T* src, int srcStride, Pel *dst, int dstStride, int width,
 #undef LINTF_CORE_INC
 }
 
+// the weighted squared differences are added to ssd one by one in sample order, as in the per sample loop of the WS-PSNR
+double calcRowWeightedSSDCore( const Pel* org, const Pel* rec, const double* weight, int width, int orgShift, int recShift, double ssd )
+{
+  for( int x = 0; x < width; x++ )
+  {
+    const int diff = ( org[x] << orgShift ) - ( rec[x] << recShift );
+    ssd += ( double ) ( diff * diff ) * weight[x];
+  }
+  return ssd;
+}
+
+// the squared differences are summed as integers, the sum is exact and independent of the order of the samples
+uint64_t calcRowSSDCore( const Pel* org, const Pel* rec, int width, int orgShift, int recShift )
+{
+  uint64_t ssd = 0;
+  for( int x = 0; x < width; x++ )
+  {
+    const int diff = ( org[x] << orgShift ) - ( rec[x] << recShift );
+    ssd += uint32_t( diff * diff );
+  }
+  return ssd;
+}
+
 PelBufferOps::PelBufferOps()
 {
   addAvg4 = addAvgCore<Pel>;
@@ -356,6 +379,9 @@ PelBufferOps::PelBufferOps()
   profGradFilter = gradFilterCore <false>;
   applyPROF      = applyPROFCore;
   roundIntVector = nullptr;
+
+  calcRowWeightedSSD        = calcRowWeightedSSDCore;
+  calcRowSSD                = calcRowSSDCore;
 }
 
 PelBufferOps g_pelBufOP = PelBufferOps();
@@ -85,6 +85,8 @@ struct PelBufferOps
                     const Pel *gradY, int gradStride, const int *dMvX, const int *dMvY, int dMvStride, const bool bi,
                     int shiftNum, Pel offset, const ClpRng &clpRng);
   void (*roundIntVector) (int* v, int size, unsigned int nShift, const int dmvLimit);
+  double ( *calcRowWeightedSSD )        ( const Pel* org, const Pel* rec, const double* weight, int width, int orgShift, int recShift, double ssd );
+  uint64_t ( *calcRowSSD )              ( const Pel* org, const Pel* rec, int width, int orgShift, int recShift );
 };
 
 extern PelBufferOps g_pelBufOP;
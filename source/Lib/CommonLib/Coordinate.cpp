@@ -8,8 +8,9 @@
 ArrayXXTCoordPtrPair CoordinateConversion::cartesianToPolar(ArrayXXTCoordPtrPair cart2D) {
   const ArrayXXTCoordPtr& cart2DX = std::get<0>(cart2D);
   const ArrayXXTCoordPtr& cart2DY = std::get<1>(cart2D);
-  ArrayXXTCoordPtr polarR = std::make_shared<ArrayXXTCoord>((cart2DX->square() + cart2DY->square()).sqrt());
-  ArrayXXTCoordPtr polarPhi = std::make_shared<ArrayXXTCoord>(cart2DX->binaryExpr(*cart2DY, [](TCoord x, TCoord y) { return TCoord(std::atan2(y, x)); }));
+  ArrayXXTCoordPtr polarR = std::make_shared<ArrayXXTCoord>(cart2DX->rows(), cart2DX->cols());
+  ArrayXXTCoordPtr polarPhi = std::make_shared<ArrayXXTCoord>(cart2DX->rows(), cart2DX->cols());
+  g_coordOP.cartesianToPolar(cart2DX->data(), cart2DY->data(), polarR->data(), polarPhi->data(), int(cart2DX->size()));
   return {polarR, polarPhi};
 }
 
@@ -22,8 +23,9 @@ Array2TCoord CoordinateConversion::cartesianToPolar(const Array2TCoord &cart2D)
 ArrayXXTCoordPtrPair CoordinateConversion::polarToCartesian(ArrayXXTCoordPtrPair polar) {
   const ArrayXXTCoordPtr& polarR = std::get<0>(polar);
   const ArrayXXTCoordPtr& polarPhi = std::get<1>(polar);
-  ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(*polarR * polarPhi->cos());
-  ArrayXXTCoordPtr cart2DY = std::make_shared<ArrayXXTCoord>(*polarR * polarPhi->sin());
+  ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(polarR->rows(), polarR->cols());
+  ArrayXXTCoordPtr cart2DY = std::make_shared<ArrayXXTCoord>(polarR->rows(), polarR->cols());
+  g_coordOP.polarToCartesian(polarR->data(), polarPhi->data(), cart2DX->data(), cart2DY->data(), int(polarR->size()));
   return {cart2DX, cart2DY};
 }
 
@@ -37,9 +39,11 @@ ArrayXXTCoordPtrTriple CoordinateConversion::cartesianToSpherical(ArrayXXTCoordP
   const ArrayXXTCoordPtr& cart3DX = std::get<0>(cart3D);
   const ArrayXXTCoordPtr& cart3DY = std::get<1>(cart3D);
   const ArrayXXTCoordPtr& cart3DZ = std::get<2>(cart3D);
-  ArrayXXTCoordPtr sphericalR = std::make_shared<ArrayXXTCoord>((cart3DX->square() + cart3DY->square() + cart3DZ->square()).sqrt());
-  ArrayXXTCoordPtr sphericalTheta = std::make_shared<ArrayXXTCoord>((*cart3DZ / *sphericalR).cwiseMin(1).cwiseMax(-1).acos());
-  ArrayXXTCoordPtr sphericalPhi = std::make_shared<ArrayXXTCoord>(cart3DX->binaryExpr(*cart3DY, [](TCoord x, TCoord y) { return TCoord(std::atan2(y, x)); }));
+  ArrayXXTCoordPtr sphericalR = std::make_shared<ArrayXXTCoord>(cart3DX->rows(), cart3DX->cols());
+  ArrayXXTCoordPtr sphericalTheta = std::make_shared<ArrayXXTCoord>(cart3DX->rows(), cart3DX->cols());
+  ArrayXXTCoordPtr sphericalPhi = std::make_shared<ArrayXXTCoord>(cart3DX->rows(), cart3DX->cols());
+  g_coordOP.cartesianToSpherical(cart3DX->data(), cart3DY->data(), cart3DZ->data(),
+                                 sphericalR->data(), sphericalTheta->data(), sphericalPhi->data(), int(cart3DX->size()));
   return {sphericalR, sphericalTheta, sphericalPhi};
 }
 
@@ -54,9 +58,11 @@ ArrayXXTCoordPtrTriple CoordinateConversion::sphericalToCartesian(ArrayXXTCoordP
   const ArrayXXTCoordPtr& sphericalR = std::get<0>(spherical);
   const ArrayXXTCoordPtr& sphericalTheta = std::get<1>(spherical);
   const ArrayXXTCoordPtr& sphericalPhi = std::get<2>(spherical);
-  ArrayXXTCoordPtr cart3DX = std::make_shared<ArrayXXTCoord>(*sphericalR * sphericalTheta->sin() * sphericalPhi->cos());
-  ArrayXXTCoordPtr cart3DY = std::make_shared<ArrayXXTCoord>(*sphericalR * sphericalTheta->sin() * sphericalPhi->sin());
-  ArrayXXTCoordPtr cart3DZ = std::make_shared<ArrayXXTCoord>(*sphericalR * sphericalTheta->cos());
+  ArrayXXTCoordPtr cart3DX = std::make_shared<ArrayXXTCoord>(sphericalR->rows(), sphericalR->cols());
+  ArrayXXTCoordPtr cart3DY = std::make_shared<ArrayXXTCoord>(sphericalR->rows(), sphericalR->cols());
+  ArrayXXTCoordPtr cart3DZ = std::make_shared<ArrayXXTCoord>(sphericalR->rows(), sphericalR->cols());
+  g_coordOP.sphericalToCartesian(sphericalR->data(), sphericalTheta->data(), sphericalPhi->data(),
+                                 cart3DX->data(), cart3DY->data(), cart3DZ->data(), int(sphericalR->size()));
   return {cart3DX, cart3DY, cart3DZ};
 }
 
@@ -67,6 +73,98 @@ Array3TCoord CoordinateConversion::sphericalToCartesian(const Array3TCoord &sphe
   return {cart3DX, cart3DY, cart3DZ};
 }
 
+static void sphericalToCartesianCore(const TCoord* r, const TCoord* theta, const TCoord* phi, TCoord* x, TCoord* y, TCoord* z, int n)
+{
+  const int packetEnd = CoordTrig::packetEnd(n);
+  for (int i = 0; i < n; i++) {
+    TCoord sinTheta, cosTheta, sinPhi, cosPhi;
+    CoordTrig::sincos(theta[i], sinTheta, cosTheta, i < packetEnd);
+    CoordTrig::sincos(phi[i], sinPhi, cosPhi, i < packetEnd);
+    const TCoord rSinTheta = r[i] * sinTheta;
+    x[i] = rSinTheta * cosPhi;
+    y[i] = rSinTheta * sinPhi;
+    z[i] = r[i] * cosTheta;
+  }
+}
+
+static inline void cartesianToSphericalElement(const TCoord x, const TCoord y, const TCoord z, TCoord &r, TCoord &theta, TCoord &phi, bool packet)
+{
+  const TCoord radius = CoordTrig::sqrt(x * x + y * y + z * z, packet);
+  // Operand order of min/max propagates NaN in the same way as the vector min/max instructions
+  const TCoord cosTheta = std::max(std::min(z / radius, TCoord(1)), TCoord(-1));
+  r = radius;
+  theta = CoordTrig::acos(cosTheta);
+  phi = CoordTrig::atan2(y, x);
+}
+
+static void cartesianToSphericalCore(const TCoord* x, const TCoord* y, const TCoord* z, TCoord* r, TCoord* theta, TCoord* phi, int n)
+{
+  const int packetEnd = CoordTrig::packetEnd(n);
+  for (int i = 0; i < n; i++) {
+    cartesianToSphericalElement(x[i], y[i], z[i], r[i], theta[i], phi[i], i < packetEnd);
+  }
+}
+
+static void rotatedCartesianToSphericalCore(const TCoord* m, const TCoord* x, const TCoord* y, const TCoord* z, TCoord* r, TCoord* theta, TCoord* phi, int n)
+{
+  const int packetEnd = CoordTrig::packetEnd(n);
+  for (int i = 0; i < n; i++) {
+    const TCoord xRot = m[0] * x[i] + (m[3] * y[i] + m[6] * z[i]);
+    const TCoord yRot = m[1] * x[i] + (m[4] * y[i] + m[7] * z[i]);
+    const TCoord zRot = m[2] * x[i] + (m[5] * y[i] + m[8] * z[i]);
+    cartesianToSphericalElement(xRot, yRot, zRot, r[i], theta[i], phi[i], i < packetEnd);
+  }
+}
+
+static void sphericalToRotatedCartesianCore(const TCoord* m, const TCoord* r, const TCoord* theta, const TCoord* phi, TCoord* x, TCoord* y, TCoord* z, int n)
+{
+  const int packetEnd = CoordTrig::packetEnd(n);
+  for (int i = 0; i < n; i++) {
+    TCoord sinTheta, cosTheta, sinPhi, cosPhi;
+    CoordTrig::sincos(theta[i], sinTheta, cosTheta, i < packetEnd);
+    CoordTrig::sincos(phi[i], sinPhi, cosPhi, i < packetEnd);
+    const TCoord rSinTheta = r[i] * sinTheta;
+    const TCoord xSph = rSinTheta * cosPhi;
+    const TCoord ySph = rSinTheta * sinPhi;
+    const TCoord zSph = r[i] * cosTheta;
+    x[i] = m[0] * xSph + (m[3] * ySph + m[6] * zSph);
+    y[i] = m[1] * xSph + (m[4] * ySph + m[7] * zSph);
+    z[i] = m[2] * xSph + (m[5] * ySph + m[8] * zSph);
+  }
+}
+
+static void polarToCartesianCore(const TCoord* r, const TCoord* phi, TCoord* x, TCoord* y, int n)
+{
+  const int packetEnd = CoordTrig::packetEnd(n);
+  for (int i = 0; i < n; i++) {
+    TCoord sinPhi, cosPhi;
+    CoordTrig::sincos(phi[i], sinPhi, cosPhi, i < packetEnd);
+    x[i] = r[i] * cosPhi;
+    y[i] = r[i] * sinPhi;
+  }
+}
+
+static void cartesianToPolarCore(const TCoord* x, const TCoord* y, TCoord* r, TCoord* phi, int n)
+{
+  const int packetEnd = CoordTrig::packetEnd(n);
+  for (int i = 0; i < n; i++) {
+    r[i] = CoordTrig::sqrt(x[i] * x[i] + y[i] * y[i], i < packetEnd);
+    phi[i] = CoordTrig::atan2(y[i], x[i]);
+  }
+}
+
+CoordinateOps::CoordinateOps()
+{
+  sphericalToCartesian = sphericalToCartesianCore;
+  cartesianToSpherical = cartesianToSphericalCore;
+  polarToCartesian     = polarToCartesianCore;
+  cartesianToPolar     = cartesianToPolarCore;
+  rotatedCartesianToSpherical = rotatedCartesianToSphericalCore;
+  sphericalToRotatedCartesian = sphericalToRotatedCartesianCore;
+}
+
+CoordinateOps g_coordOP = CoordinateOps();
+
 TCoord FloatingFixedConversion::fixedToFloating(int fixed, int precision) {
   return TCoord(fixed >> precision) + TCoord(fixed & ((1 << precision) - 1))/TCoord(1 << precision);
 }
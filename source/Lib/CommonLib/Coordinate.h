@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <iostream>
+#include <cmath>
 #include "Common.h"
 #include "CommonDef.h"
 #include "Eigen/Dense"
@@ -50,6 +51,201 @@ namespace CoordinateConversion {
 }
 
 
+/// Polynomial approximations of the trigonometric functions used for batched coordinate conversion with MM_FAST_TRIG.
+/// The scalar implementations are the reference for the SIMD kernels in x86/CoordinateX86.h and evaluate the same
+/// operations in the same order, so that the results are bit-exact across all instruction sets (without FMA
+/// contraction; only the sign of NaN results may differ). SelfCheckApp verifies both the bit-exactness and the
+/// error bounds. Maximum absolute errors against a double precision reference:
+///   sin, cos:  < 1.0e-7 for |x| <= 8192
+///   atan2:     < 3.0e-7 rad
+///   acos:      < 3.0e-7 rad for |x| <= 1
+namespace FastTrig {
+  constexpr TCoord FOUR_OVER_PI = TCoord(1.27323954473516);
+  constexpr TCoord PI_4_DP1 = TCoord(0.78515625);               ///< pi/4 split for Cody-Waite range reduction
+  constexpr TCoord PI_4_DP2 = TCoord(2.4187564849853515625e-4);
+  constexpr TCoord PI_4_DP3 = TCoord(3.77489497744594108e-8);
+  constexpr TCoord SIN_C0 = TCoord(-1.9515295891e-4);
+  constexpr TCoord SIN_C1 = TCoord(8.3321608736e-3);
+  constexpr TCoord SIN_C2 = TCoord(-1.6666654611e-1);
+  constexpr TCoord COS_C0 = TCoord(2.443315711809948e-5);
+  constexpr TCoord COS_C1 = TCoord(-1.388731625493765e-3);
+  constexpr TCoord COS_C2 = TCoord(4.166664568298827e-2);
+  constexpr TCoord TAN_3PI_8 = TCoord(2.414213562373095);
+  constexpr TCoord TAN_PI_8 = TCoord(0.4142135623730950);
+  constexpr TCoord ATAN_C0 = TCoord(8.05374449538e-2);
+  constexpr TCoord ATAN_C1 = TCoord(-1.38776856032e-1);
+  constexpr TCoord ATAN_C2 = TCoord(1.99777106478e-1);
+  constexpr TCoord ATAN_C3 = TCoord(-3.33329491539e-1);
+  constexpr TCoord ASIN_C0 = TCoord(4.2163199048e-2);
+  constexpr TCoord ASIN_C1 = TCoord(2.4181311049e-2);
+  constexpr TCoord ASIN_C2 = TCoord(4.5470025998e-2);
+  constexpr TCoord ASIN_C3 = TCoord(7.4953002686e-2);
+  constexpr TCoord ASIN_C4 = TCoord(1.6666752422e-1);
+  constexpr TCoord PI = TCoord(3.14159265358979);
+  constexpr TCoord PI_2 = TCoord(1.57079632679490);
+  constexpr TCoord PI_4 = TCoord(0.78539816339745);
+
+  inline void sincos(TCoord x, TCoord &s, TCoord &c) {
+    const TCoord ax = std::abs(x);
+    int j = int(ax * FOUR_OVER_PI);
+    j = (j + 1) & ~1;
+    const TCoord y = TCoord(j);
+    const TCoord xr = ((ax - y * PI_4_DP1) - y * PI_4_DP2) - y * PI_4_DP3;
+    const TCoord z = xr * xr;
+    const TCoord polyCos = ((COS_C0 * z + COS_C1) * z + COS_C2) * z * z - TCoord(0.5) * z + TCoord(1);
+    const TCoord polySin = ((SIN_C0 * z + SIN_C1) * z + SIN_C2) * z * xr + xr;
+    const bool swap = (j & 2) != 0;
+    s = swap ? polyCos : polySin;
+    c = swap ? polySin : polyCos;
+    if (((j & 4) != 0) != std::signbit(x)) {
+      s = -s;
+    }
+    if (((j + 2) & 4) != 0) {
+      c = -c;
+    }
+  }
+
+  inline TCoord atan(TCoord x) {
+    const TCoord ax = std::abs(x);
+    TCoord y0 = 0;
+    TCoord xr = ax;
+    if (ax > TAN_3PI_8) {
+      y0 = PI_2;
+      xr = TCoord(-1) / ax;
+    } else if (ax > TAN_PI_8) {
+      y0 = PI_4;
+      xr = (ax - TCoord(1)) / (ax + TCoord(1));
+    }
+    const TCoord z = xr * xr;
+    const TCoord r = (((ATAN_C0 * z + ATAN_C1) * z + ATAN_C2) * z + ATAN_C3) * z * xr + xr + y0;
+    return std::signbit(x) ? -r : r;
+  }
+
+  inline TCoord atan2(TCoord y, TCoord x) {
+    if (x == 0) {
+      return y > 0 ? PI_2 : (y < 0 ? -PI_2 : TCoord(0));
+    }
+    const TCoord r = atan(y / x);
+    if (x < 0) {
+      return std::signbit(y) ? r - PI : r + PI;
+    }
+    return r;
+  }
+
+  inline TCoord acos(TCoord x) {
+    const TCoord ax = std::abs(x);
+    const bool big = ax > TCoord(0.5);
+    const TCoord z = big ? TCoord(0.5) * (TCoord(1) - ax) : ax * ax;
+    const TCoord xs = big ? std::sqrt(z) : ax;
+    const TCoord p = ((((ASIN_C0 * z + ASIN_C1) * z + ASIN_C2) * z + ASIN_C3) * z + ASIN_C4) * z * xs + xs;
+    if (big) {
+      return x < 0 ? PI - TCoord(2) * p : TCoord(2) * p;
+    }
+    return x < 0 ? PI_2 + p : PI_2 - p;
+  }
+}
+
+
+/// Trigonometric functions of the reprojection. The choice is normative for multi-model bitstreams, as it changes the
+/// reprojected sample positions.
+/// Without MM_FAST_TRIG, the results are those of the Eigen array expressions: Eigen evaluates the leading packetEnd(n)
+/// elements of an array of n elements with its vectorized functions and the trailing elements with the C library, as
+/// in a linear traversal of an aligned array. The two differ in the last bits (sqrt() approximates the reciprocal
+/// square root with EIGEN_FAST_MATH), so the result for a value depends on its position in the array. acos() and
+/// atan2() are not vectorized by Eigen. With MM_FAST_TRIG, all functions use the FastTrig approximations and the square
+/// root is exact.
+namespace CoordTrig {
+#if MM_FAST_TRIG
+  constexpr int PACKET_SIZE = 1;
+#else
+  typedef Eigen::internal::packet_traits<TCoord> PacketTraits;
+  /// Number of elements evaluated together by the vectorized functions of Eigen (1: not vectorized)
+  constexpr int PACKET_SIZE = PacketTraits::Vectorizable ? int(PacketTraits::size) : 1;
+
+  /// Eigen functor on one array element, packet: vectorized function
+  template<class Op>
+  inline TCoord eigenOp(TCoord x, bool packet) {
+    const Op op;
+    if (PACKET_SIZE > 1 && Eigen::internal::functor_traits<Op>::PacketAccess && packet) {
+      return Eigen::internal::pfirst(op.packetOp(Eigen::internal::pset1<PacketTraits::type>(x)));
+    }
+    return op(x);
+  }
+#endif
+
+  /// Number of leading elements of an array of n elements that are evaluated with the vectorized functions
+  inline int packetEnd(int n) {
+    return n - n % PACKET_SIZE;
+  }
+
+  /// Sine and cosine of an array element, packet: the element lies before packetEnd() of its array
+  inline void sincos(TCoord x, TCoord &s, TCoord &c, bool packet) {
+#if MM_FAST_TRIG
+    FastTrig::sincos(x, s, c);
+#else
+    // Eigen only vectorizes an expression if all of its functions are vectorized
+    const bool vectorized = packet && PacketTraits::HasSin && PacketTraits::HasCos;
+    s = eigenOp<Eigen::internal::scalar_sin_op<TCoord>>(x, vectorized);
+    c = eigenOp<Eigen::internal::scalar_cos_op<TCoord>>(x, vectorized);
+#endif
+  }
+
+  /// Sine and cosine of a single value, as for an array of one element
+  inline void sincos(TCoord x, TCoord &s, TCoord &c) {
+    sincos(x, s, c, false);
+  }
+
+  /// Square root of an array element, packet: the element lies before packetEnd() of its array
+  inline TCoord sqrt(TCoord x, bool packet) {
+#if MM_FAST_TRIG
+    return std::sqrt(x);
+#else
+    return eigenOp<Eigen::internal::scalar_sqrt_op<TCoord>>(x, packet);
+#endif
+  }
+
+  inline TCoord atan2(TCoord y, TCoord x) {
+#if MM_FAST_TRIG
+    return FastTrig::atan2(y, x);
+#else
+    return std::atan2(y, x);
+#endif
+  }
+
+  inline TCoord acos(TCoord x) {
+#if MM_FAST_TRIG
+    return FastTrig::acos(x);
+#else
+    return std::acos(x);
+#endif
+  }
+}
+
+
+/// Batched coordinate conversion kernels on flat coordinate arrays of length n.
+struct CoordinateOps
+{
+  CoordinateOps();
+
+#if ENABLE_SIMD_OPT_COORDINATE && defined(TARGET_SIMD_X86)
+  void initCoordinateOpsX86();
+  template<X86_VEXT vext>
+  void _initCoordinateOpsX86();
+#endif
+
+  void ( *sphericalToCartesian ) ( const TCoord* r, const TCoord* theta, const TCoord* phi, TCoord* x, TCoord* y, TCoord* z, int n );
+  void ( *cartesianToSpherical ) ( const TCoord* x, const TCoord* y, const TCoord* z, TCoord* r, TCoord* theta, TCoord* phi, int n );
+  void ( *polarToCartesian )     ( const TCoord* r, const TCoord* phi, TCoord* x, TCoord* y, int n );
+  void ( *cartesianToPolar )     ( const TCoord* x, const TCoord* y, TCoord* r, TCoord* phi, int n );
+  /// Fused rotation by the column-major 3x3 matrix and conversion, evaluated as m(i,0)*x + (m(i,1)*y + m(i,2)*z)
+  /// like the Eigen product of the matrix and the stacked coordinates
+  void ( *rotatedCartesianToSpherical ) ( const TCoord* rotation, const TCoord* x, const TCoord* y, const TCoord* z, TCoord* r, TCoord* theta, TCoord* phi, int n );
+  void ( *sphericalToRotatedCartesian ) ( const TCoord* rotation, const TCoord* r, const TCoord* theta, const TCoord* phi, TCoord* x, TCoord* y, TCoord* z, int n );
+};
+
+extern CoordinateOps g_coordOP;
+
+
 /// Floating point <-> fixed point conversion namespace
 namespace FloatingFixedConversion {
   TCoord fixedToFloating(int fixed, int precision);
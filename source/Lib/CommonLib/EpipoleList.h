@@ -18,6 +18,8 @@ public:
 
   void addEpipole(const Array3TCoord &epipole, int curPOC = -1, int refPOC = -1, bool makeAvailable = false);
   Array3TCoord findEpipole(int curPOC, int refPOC) const;
+  /** @brief Epipole in fixed-point precision EPIPOLE_PRECISION_FIXED as signaled. */
+  Array3Fixed findEpipoleFixed(int curPOC, int refPOC) const;
   int count() const {
     bool globalIsDefault = m_epipoleMap.at({-1, -1}).epipole.isZero();
     return int(m_epipoleMap.size()) - (globalIsDefault ? 1 : 0);
@@ -43,6 +45,5 @@ protected:
     explicit EpipoleEntry(Array3Fixed epipole, bool isAvailable = false): epipole(std::move(epipole)), isAvailable(isAvailable) {}
   };
 
-  Array3Fixed findEpipoleFixed(int curPOC, int refPOC) const;
   std::map<POCHash, EpipoleEntry> m_epipoleMap;
 };
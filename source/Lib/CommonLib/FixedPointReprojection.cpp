@@ -0,0 +1,556 @@
+//
+// Integer-only motion vector reprojection for the equirectangular projection.
+//
+
+#include "FixedPointReprojection.h"
+#include "MVReprojection.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+/// sin(k * pi / 512) in Q30
+const int32_t SIN_TABLE[257] = {
+0,    6588356,   13176464,   19764076,   26350943,   32936819,   39521455,   46104602,
+    52686014,   59265442,   65842639,   72417357,   78989349,   85558366,   92124163,   98686491,
+   105245103,  111799753,  118350194,  124896179,  131437462,  137973796,  144504935,  151030634,
+   157550647,  164064728,  170572633,  177074115,  183568930,  190056834,  196537583,  203010932,
+   209476638,  215934457,  222384147,  228825464,  235258165,  241682010,  248096755,  254502159,
+   260897982,  267283981,  273659918,  280025552,  286380643,  292724951,  299058239,  305380268,
+   311690799,  317989595,  324276419,  330551034,  336813204,  343062693,  349299266,  355522689,
+   361732726,  367929144,  374111709,  380280190,  386434353,  392573967,  398698801,  404808624,
+   410903207,  416982319,  423045732,  429093217,  435124548,  441139496,  447137835,  453119340,
+   459083786,  465030947,  470960600,  476872522,  482766489,  488642281,  494499676,  500338453,
+   506158392,  511959275,  517740883,  523502998,  529245404,  534967884,  540670223,  546352205,
+   552013618,  557654248,  563273883,  568872310,  574449320,  580004702,  585538248,  591049748,
+   596538995,  602005783,  607449906,  612871159,  618269338,  623644239,  628995660,  634323400,
+   639627258,  644907034,  650162530,  655393548,  660599890,  665781362,  670937767,  676068911,
+   681174602,  686254647,  691308855,  696337036,  701339000,  706314559,  711263525,  716185713,
+   721080937,  725949013,  730789757,  735602987,  740388522,  745146182,  749875788,  754577161,
+   759250125,  763894504,  768510122,  773096806,  777654384,  782182683,  786681534,  791150767,
+   795590213,  799999706,  804379079,  808728167,  813046808,  817334838,  821592095,  825818421,
+   830013654,  834177638,  838310216,  842411232,  846480531,  850517961,  854523370,  858496606,
+   862437520,  866345964,  870221790,  874064853,  877875009,  881652112,  885396022,  889106597,
+   892783698,  896427186,  900036924,  903612776,  907154608,  910662286,  914135678,  917574653,
+   920979082,  924348837,  927683790,  930983817,  934248793,  937478595,  940673101,  943832191,
+   946955747,  950043650,  953095785,  956112036,  959092290,  962036435,  964944360,  967815955,
+   970651112,  973449725,  976211688,  978936898,  981625251,  984276646,  986890984,  989468165,
+   992008094,  994510675,  996975812,  999403415, 1001793390, 1004145648, 1006460100, 1008736660,
+  1010975242, 1013175761, 1015338134, 1017462281, 1019548121, 1021595575, 1023604567, 1025575020,
+  1027506862, 1029400018, 1031254418, 1033069992, 1034846671, 1036584389, 1038283080, 1039942680,
+  1041563127, 1043144360, 1044686319, 1046188946, 1047652185, 1049075980, 1050460278, 1051805027,
+  1053110176, 1054375676, 1055601479, 1056787540, 1057933813, 1059040255, 1060106826, 1061133483,
+  1062120190, 1063066909, 1063973603, 1064840240, 1065666786, 1066453210, 1067199483, 1067905576,
+  1068571464, 1069197120, 1069782521, 1070327646, 1070832474, 1071296985, 1071721163, 1072104991,
+  1072448455, 1072751542, 1073014240, 1073236540, 1073418433, 1073559913, 1073660973, 1073721611,
+  1073741824,
+};
+
+/// atan(k / 256) as binary angle
+const uint32_t ATAN_TABLE[257] = {
+           0,    2670163,    5340245,    8010164,   10679838,   13349187,   16018129,   18686582,
+    21354465,   24021698,   26688200,   29353889,   32018685,   34682507,   37345276,   40006910,
+    42667331,   45326458,   47984212,   50640513,   53295284,   55948444,   58599915,   61249621,
+    63897482,   66543421,   69187361,   71829226,   74468939,   77106424,   79741605,   82374407,
+    85004756,   87632577,   90257796,   92880340,   95500135,   98117110,  100731191,  103342309,
+   105950391,  108555367,  111157167,  113755721,  116350962,  118942819,  121531227,  124116117,
+   126697423,  129275078,  131849018,  134419178,  136985493,  139547900,  142106335,  144660738,
+   147211045,  149757197,  152299132,  154836791,  157370116,  159899047,  162423527,  164943499,
+   167458907,  169969696,  172475810,  174977196,  177473799,  179965568,  182452450,  184934394,
+   187411349,  189883266,  192350096,  194811789,  197268300,  199719579,  202165583,  204606264,
+   207041579,  209471483,  211895933,  214314887,  216728303,  219136141,  221538359,  223934919,
+   226325781,  228710908,  231090262,  233463808,  235831508,  238193329,  240549235,  242899194,
+   245243172,  247581137,  249913059,  252238905,  254558647,  256872255,  259179700,  261480955,
+   263775993,  266064788,  268347313,  270623543,  272893455,  275157025,  277414230,  279665048,
+   281909457,  284147437,  286378966,  288604026,  290822599,  293034664,  295240206,  297439207,
+   299631651,  301817523,  303996806,  306169488,  308335554,  310494991,  312647786,  314793928,
+   316933406,  319066208,  321192324,  323311746,  325424463,  327530468,  329629752,  331722309,
+   333808132,  335887214,  337959550,  340025134,  342083962,  344136031,  346181336,  348219874,
+   350251643,  352276640,  354294865,  356306316,  358310992,  360308894,  362300021,  364284375,
+   366261957,  368232767,  370196809,  372154086,  374104599,  376048352,  377985350,  379915596,
+   381839095,  383755852,  385665872,  387569162,  389465727,  391355574,  393238710,  395115141,
+   396984877,  398847924,  400704291,  402553986,  404397019,  406233399,  408063135,  409886237,
+   411702716,  413512582,  415315845,  417112518,  418902610,  420686135,  422463104,  424233528,
+   425997422,  427754796,  429505665,  431250041,  432987938,  434719370,  436444350,  438162893,
+   439875013,  441580724,  443280042,  444972981,  446659557,  448339785,  450013680,  451681259,
+   453342536,  454997530,  456646255,  458288728,  459924966,  461554985,  463178803,  464796437,
+   466407904,  468013221,  469612406,  471205476,  472792449,  474373344,  475948178,  477516969,
+   479079736,  480636498,  482187271,  483732076,  485270931,  486803855,  488330866,  489851983,
+   491367227,  492876615,  494380167,  495877903,  497369841,  498856002,  500336404,  501811068,
+   503280012,  504743258,  506200824,  507652730,  509098996,  510539643,  511974689,  513404156,
+   514828063,  516246430,  517659277,  519066625,  520468494,  521864904,  523255875,  524641427,
+   526021581,  527396357,  528765775,  530129856,  531488619,  532842087,  534190278,  535533213,
+   536870912,
+};
+
+constexpr int64_t PI_Q30          = 3373259426;  ///< pi in Q30
+constexpr int64_t TWO_OVER_PI_Q32 = 2734261102;  ///< 2 / pi in Q32
+constexpr int64_t ROUND_Q30       = int64_t(1) << 29;
+
+inline int64_t mulQ30(int64_t a, int64_t b)
+{
+  return (a * b + ROUND_Q30) >> 30;
+}
+
+/// Product of a Q30 value exceeding the 32-bit range and a Q30 value of at most one
+inline int64_t mulQ30Wide(int64_t a, int64_t b)
+{
+  return (a >> 30) * b + (((a & (FixedPointTrig::ONE - 1)) * b + ROUND_Q30) >> 30);
+}
+
+inline int64_t divRound(int64_t n, int64_t d)
+{
+  return n >= 0 ? (n + d / 2) / d : -((-n + d / 2) / d);
+}
+
+inline int floorLog2U64(uint64_t x)
+{
+  return (x >> 32) != 0 ? 32 + floorLog2(uint32_t(x >> 32)) : floorLog2(uint32_t(x));
+}
+
+/// Right shift bringing a non-negative value below 2^31
+inline int shiftBelow31(int64_t maxAbs)
+{
+  return maxAbs < (int64_t(1) << 31) ? 0 : floorLog2U64(uint64_t(maxAbs)) - 30;
+}
+
+/// Arctangent of t in [0, 1] (Q30) as binary angle
+uint32_t atanUnit(int64_t t)
+{
+  const int     k  = int(t >> 22);
+  const int64_t tk = int64_t(k) << 22;
+  if (k == 256)
+  {
+    return ATAN_TABLE[256];
+  }
+  // atan(t) = atan(tk) + atan(r) with r = (t - tk) / (1 + t * tk) <= 1/256
+  const int64_t r   = ((t - tk) << 30) / (FixedPointTrig::ONE + ((t * tk) >> 30));
+  const int64_t r3  = mulQ30(mulQ30(r, r), r);
+  const int64_t rad = r - r3 / 3;
+  return ATAN_TABLE[k] + uint32_t((rad * TWO_OVER_PI_Q32 + (int64_t(1) << 31)) >> 32);
+}
+}
+
+void FixedPointTrig::sincos(uint32_t angle, int64_t &s, int64_t &c)
+{
+  const uint32_t quadrant  = angle >> 30;
+  const uint32_t remainder = angle & (QUARTER_TURN - 1);
+  const int      k         = int(remainder >> 22);
+
+  // sin(a + d) and cos(a + d) of the table angle a and the remaining angle d < pi / 512
+  const int64_t d      = (int64_t(remainder & ((1u << 22) - 1)) * PI_Q30 + (int64_t(1) << 30)) >> 31;
+  const int64_t d2     = mulQ30(d, d);
+  const int64_t sinD   = d - mulQ30(d2, d) / 6;
+  const int64_t cosD   = ONE - d2 / 2 + mulQ30(d2, d2) / 24;
+  const int64_t sinA   = SIN_TABLE[k];
+  const int64_t cosA   = SIN_TABLE[256 - k];
+  const int64_t sinQ   = (sinA * cosD + cosA * sinD + ROUND_Q30) >> 30;
+  const int64_t cosQ   = (cosA * cosD - sinA * sinD + ROUND_Q30) >> 30;
+
+  switch (quadrant)
+  {
+  case 0: s = sinQ;  c = cosQ;  break;
+  case 1: s = cosQ;  c = -sinQ; break;
+  case 2: s = -sinQ; c = -cosQ; break;
+  default: s = -cosQ; c = sinQ; break;
+  }
+}
+
+uint32_t FixedPointTrig::atan2(int64_t y, int64_t x)
+{
+  if (x == 0 && y == 0)
+  {
+    return 0;
+  }
+  const uint64_t absX = uint64_t(x < 0 ? -x : x);
+  const uint64_t absY = uint64_t(y < 0 ? -y : y);
+  const bool     swap = absY > absX;
+  uint64_t       num  = swap ? absX : absY;
+  uint64_t       den  = swap ? absY : absX;
+
+  // Denominator in [2^31, 2^32), so that the Q30 ratio does not overflow and keeps its precision
+  const int log2Den = floorLog2U64(den);
+  if (log2Den > 31)
+  {
+    den >>= log2Den - 31;
+    num >>= log2Den - 31;
+  }
+  else
+  {
+    den <<= 31 - log2Den;
+    num <<= 31 - log2Den;
+  }
+
+  uint32_t angle = atanUnit(int64_t((num << 30) / den));
+  if (swap)
+  {
+    angle = QUARTER_TURN - angle;
+  }
+  if (x < 0)
+  {
+    angle = HALF_TURN - angle;
+  }
+  return y < 0 ? 0u - angle : angle;
+}
+
+uint64_t FixedPointTrig::isqrt(uint64_t value)
+{
+  // The correctly rounded double precision square root is close to the result and corrected exactly, so that the
+  // result does not depend on the floating point environment
+  uint64_t result = std::min(uint64_t(std::sqrt(double(value))), uint64_t(0xffffffff));
+  while (result * result > value)
+  {
+    result--;
+  }
+  while (result < 0xffffffff && (result + 1) * (result + 1) <= value)
+  {
+    result++;
+  }
+  return result;
+}
+
+FixedPointReprojection::Vec3 FixedPointReprojection::Matrix3::operator*(const Vec3 &v) const
+{
+  return { (m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z + ROUND_Q30) >> 30,
+           (m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z + ROUND_Q30) >> 30,
+           (m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z + ROUND_Q30) >> 30 };
+}
+
+FixedPointReprojection::Vec3 FixedPointReprojection::Matrix3::transposedTimes(const Vec3 &v) const
+{
+  return { (m[0][0] * v.x + m[1][0] * v.y + m[2][0] * v.z + ROUND_Q30) >> 30,
+           (m[0][1] * v.x + m[1][1] * v.y + m[2][1] * v.z + ROUND_Q30) >> 30,
+           (m[0][2] * v.x + m[1][2] * v.y + m[2][2] * v.z + ROUND_Q30) >> 30 };
+}
+
+FixedPointReprojection::Matrix3 FixedPointReprojection::Matrix3::operator*(const Matrix3 &other) const
+{
+  Matrix3 product;
+  for (int i = 0; i < 3; i++)
+  {
+    for (int j = 0; j < 3; j++)
+    {
+      product.m[i][j] = (m[i][0] * other.m[0][j] + m[i][1] * other.m[1][j] + m[i][2] * other.m[2][j] + ROUND_Q30) >> 30;
+    }
+  }
+  return product;
+}
+
+FixedPointReprojection::Matrix3 FixedPointReprojection::Matrix3::transposed() const
+{
+  Matrix3 transposed;
+  for (int i = 0; i < 3; i++)
+  {
+    for (int j = 0; j < 3; j++)
+    {
+      transposed.m[i][j] = m[j][i];
+    }
+  }
+  return transposed;
+}
+
+FixedPointReprojection::Matrix3 FixedPointReprojection::rotationZ(uint32_t angle)
+{
+  int64_t s, c;
+  FixedPointTrig::sincos(angle, s, c);
+  return { { { c, -s, 0 }, { s, c, 0 }, { 0, 0, FixedPointTrig::ONE } } };
+}
+
+FixedPointReprojection::Matrix3 FixedPointReprojection::rotationY(uint32_t angle)
+{
+  int64_t s, c;
+  FixedPointTrig::sincos(angle, s, c);
+  return { { { c, 0, s }, { 0, FixedPointTrig::ONE, 0 }, { -s, 0, c } } };
+}
+
+bool FixedPointReprojection::epipoleRotation(const Array3Fixed &epipole, Matrix3 &rotation)
+{
+  const int64_t  ex    = epipole[0];
+  const int64_t  ey    = epipole[1];
+  const int64_t  ez    = epipole[2];
+  const uint64_t norm2 = uint64_t(ex * ex) + uint64_t(ey * ey) + uint64_t(ez * ez);
+  if (norm2 == 0)
+  {
+    return false;
+  }
+  const int64_t norm = int64_t(FixedPointTrig::isqrt(norm2));
+  const int64_t nx   = divRound(ex * FixedPointTrig::ONE, norm);
+  const int64_t ny   = divRound(ey * FixedPointTrig::ONE, norm);
+  const int64_t nz   = divRound(ez * FixedPointTrig::ONE, norm);
+
+  rotation = { { { FixedPointTrig::ONE, 0, 0 }, { 0, FixedPointTrig::ONE, 0 }, { 0, 0, FixedPointTrig::ONE } } };
+  const int64_t onePlusC = FixedPointTrig::ONE + nz;
+  if ((nx == 0 && ny == 0) || onePlusC <= 0)
+  {
+    // Epipole parallel to the north pole
+    if (nz < 0)
+    {
+      rotation.m[2][2] = -FixedPointTrig::ONE;
+    }
+    return true;
+  }
+
+  // Rodrigues rotation I + K + K^2 / (1 + c) about the axis (0, 0, 1) x n, transposed
+  const int64_t nxx = divRound(nx * nx, onePlusC);
+  const int64_t nxy = divRound(nx * ny, onePlusC);
+  const int64_t nyy = divRound(ny * ny, onePlusC);
+  rotation.m[0][0] -= nxx;
+  rotation.m[0][1]  = -nxy;
+  rotation.m[0][2]  = -nx;
+  rotation.m[1][0]  = -nxy;
+  rotation.m[1][1] -= nyy;
+  rotation.m[1][2]  = -ny;
+  rotation.m[2][0]  = nx;
+  rotation.m[2][1]  = ny;
+  rotation.m[2][2] -= nxx + nyy;
+  return true;
+}
+
+FixedPointReprojection::Vec3 FixedPointReprojection::unitVector(uint32_t theta, uint32_t phi)
+{
+  int64_t sinTheta, cosTheta, sinPhi, cosPhi;
+  FixedPointTrig::sincos(theta, sinTheta, cosTheta);
+  FixedPointTrig::sincos(phi, sinPhi, cosPhi);
+  return { mulQ30(sinTheta, cosPhi), mulQ30(sinTheta, sinPhi), cosTheta };
+}
+
+void FixedPointReprojection::sphericalAngles(Vec3 v, uint32_t &theta, uint32_t &phi)
+{
+  // Common scale below 2^31 so that the squares do not overflow
+  const int64_t maxAbs = std::max(std::max(std::abs(v.x), std::abs(v.y)), std::abs(v.z));
+  const int shift = shiftBelow31(maxAbs);
+  v.x >>= shift;
+  v.y >>= shift;
+  v.z >>= shift;
+
+  const uint64_t rho = FixedPointTrig::isqrt(uint64_t(v.x * v.x) + uint64_t(v.y * v.y));
+  phi   = FixedPointTrig::atan2(v.y, v.x);
+  theta = FixedPointTrig::atan2(int64_t(rho), v.z);
+}
+
+void FixedPointReprojection::init(const Size &resolution, int pixelOffset, int offset4x4, GeodesicMotionModel::Flavor flavor)
+{
+  m_width       = int(resolution.width);
+  m_height      = int(resolution.height);
+  m_pixelOffset = pixelOffset;
+  m_offset4x4   = offset4x4;
+  m_flavor      = flavor;
+}
+
+bool FixedPointReprojection::supports(MotionModelID motionModelID)
+{
+  switch (motionModelID)
+  {
+  case TANGENTIAL:
+  case ROTATIONAL:
+  case GEODESIC_X:
+  case GEODESIC_Y:
+  case GEODESIC_Z:
+  case GEODESIC_CAMPOSE:
+    return true;
+  default:
+    return false;
+  }
+}
+
+uint32_t FixedPointReprojection::azimuth(int64_t x) const
+{
+  // phi = -2 pi x / width
+  return uint32_t(-divRound((x + m_pixelOffset) * (int64_t(1) << 28), m_width));
+}
+
+uint32_t FixedPointReprojection::polarAngle(int64_t y) const
+{
+  // theta = pi y / height
+  return uint32_t(divRound((y + m_pixelOffset) * (int64_t(1) << 27), m_height));
+}
+
+int FixedPointReprojection::projectionX(uint32_t phi) const
+{
+  // Azimuth in (-2 pi, 0]
+  const uint32_t negPhi = 0u - phi;
+  return int((uint64_t(negPhi) * uint64_t(16 * m_width) + (uint64_t(1) << 31)) >> 32) - m_pixelOffset;
+}
+
+int FixedPointReprojection::projectionY(uint32_t theta) const
+{
+  return int((uint64_t(theta) * uint64_t(16 * m_height) + (uint64_t(1) << 30)) >> 31) - m_pixelOffset;
+}
+
+void FixedPointReprojection::reprojectSubblocks(const Position &position, const Size &size, const Size &subblockSize,
+                                                ComponentID compID, ChromaFormat chromaFormat,
+                                                const Mv &motionVector, MotionModelID motionModelID, const Array3Fixed &epipole,
+                                                SubblockPositions &dst) const
+{
+  CHECK(!supports(motionModelID), "Motion model not supported by the fixed-point reprojection.");
+
+  const int rows     = dst.rows;
+  const int cols     = dst.cols;
+  const int scaleX   = getComponentScaleX(compID, chromaFormat);
+  const int scaleY   = getComponentScaleY(compID, chromaFormat);
+  const int shiftHor = MV_FRACTIONAL_BITS_INTERNAL + scaleX;
+  const int shiftVer = MV_FRACTIONAL_BITS_INTERNAL + scaleY;
+  const int fracMaskHor = (1 << shiftHor) - 1;
+  const int fracMaskVer = (1 << shiftVer) - 1;
+
+  // Subblock origins on the luma scale and block center in 1/16 samples
+  const int64_t startX  = int64_t(position.x << scaleX) * 16 + m_offset4x4;
+  const int64_t startY  = int64_t(position.y << scaleY) * 16 + m_offset4x4;
+  const int64_t stepX   = int64_t(subblockSize.width << scaleX) * 16;
+  const int64_t stepY   = int64_t(subblockSize.height << scaleY) * 16;
+  const int64_t centerX = int64_t(position.x) * 16 + (int64_t(size.width) - 1) * 8;
+  const int64_t centerY = int64_t(position.y) * 16 + (int64_t(size.height) - 1) * 8;
+
+  // Only the tangential model uses the motion vector in radians, the others as rotation angle
+  const uint32_t motionX = uint32_t(divRound(int64_t(motionVector.hor) * (int64_t(1) << 27), m_height));
+  const uint32_t motionY = uint32_t(divRound(int64_t(motionVector.ver) * (int64_t(1) << 27), m_height));
+
+  // Separable angles of the unit sphere grid
+  int64_t sinTheta[MAX_CU_SIZE], cosTheta[MAX_CU_SIZE];
+  int64_t sinPhi[MAX_CU_SIZE], cosPhi[MAX_CU_SIZE];
+  CHECK(rows > MAX_CU_SIZE || cols > MAX_CU_SIZE, "Block exceeds the fixed-point reprojection buffers.");
+  for (int row = 0; row < rows; row++)
+  {
+    FixedPointTrig::sincos(polarAngle(startY + row * stepY), sinTheta[row], cosTheta[row]);
+  }
+  for (int col = 0; col < cols; col++)
+  {
+    FixedPointTrig::sincos(azimuth(startX + col * stepX), sinPhi[col], cosPhi[col]);
+  }
+
+  bool moved = motionVector.hor != 0 || motionVector.ver != 0;
+
+  Matrix3 rotation = {};
+  Vec3 center = {}, east = {}, north = {};
+  int64_t sinMotionX = 0, sinCenterMoved = 0;
+  int64_t tangentMotionX = 0, tangentMotionY = 0;
+  const uint32_t thetaCenter = polarAngle(centerY);
+  const uint32_t phiCenter   = azimuth(centerX);
+  switch (motionModelID)
+  {
+  case ROTATIONAL:
+  {
+    const Matrix3 unrot = rotationY(FixedPointTrig::QUARTER_TURN - thetaCenter) * rotationZ(0u - phiCenter);
+    rotation = unrot.transposed() * ((rotationZ(0u - motionX) * rotationY(motionY)) * unrot);
+    break;
+  }
+  case TANGENTIAL:
+  {
+    int64_t sinThetaCenter, cosThetaCenter, sinPhiCenter, cosPhiCenter;
+    FixedPointTrig::sincos(thetaCenter, sinThetaCenter, cosThetaCenter);
+    FixedPointTrig::sincos(phiCenter, sinPhiCenter, cosPhiCenter);
+    // Tangent plane at the block center spanned by the directions of increasing azimuth and elevation
+    center = { mulQ30(sinThetaCenter, cosPhiCenter), mulQ30(sinThetaCenter, sinPhiCenter), cosThetaCenter };
+    east   = { -sinPhiCenter, cosPhiCenter, 0 };
+    north  = { -mulQ30(cosThetaCenter, cosPhiCenter), -mulQ30(cosThetaCenter, sinPhiCenter), sinThetaCenter };
+    tangentMotionX = divRound(int64_t(motionVector.hor) * PI_Q30, int64_t(16) * m_height);
+    tangentMotionY = divRound(int64_t(motionVector.ver) * PI_Q30, int64_t(16) * m_height);
+    break;
+  }
+  default:
+  {
+    // Geodesic motion models, no motion for an undefined epipole
+    moved = moved && epipoleRotation(epipole, rotation);
+    if (moved && m_flavor == GeodesicMotionModel::VISHWANATH_MODULATED && motionX != 0)
+    {
+      // sin(theta_c + A) and sin(A) of the modulation factor k = sin(theta_c + A) / sin(A)
+      uint32_t thetaCenterRot, phiCenterRot;
+      sphericalAngles(rotation * unitVector(thetaCenter, phiCenter), thetaCenterRot, phiCenterRot);
+      int64_t cosUnused;
+      FixedPointTrig::sincos(motionX, sinMotionX, cosUnused);
+      FixedPointTrig::sincos(thetaCenterRot + motionX, sinCenterMoved, cosUnused);
+    }
+    break;
+  }
+  }
+
+  for (int col = 0; col < cols; col++)
+  {
+    for (int row = 0; row < rows; row++)
+    {
+      const int i = dst.idx(row, col);
+      bool valid = moved;
+      uint32_t thetaMoved = 0, phiMoved = 0;
+      if (valid)
+      {
+        const Vec3 cart3D = { mulQ30(sinTheta[row], cosPhi[col]), mulQ30(sinTheta[row], sinPhi[col]), cosTheta[row] };
+        if (motionModelID == ROTATIONAL)
+        {
+          sphericalAngles(rotation * cart3D, thetaMoved, phiMoved);
+        }
+        else if (motionModelID == TANGENTIAL)
+        {
+          // Gnomonic projection to the tangent plane, motion and back. The plane point (x, y) and the center are
+          // scaled by |cos(psi)|, which keeps the direction, so that no division is required.
+          const int64_t cosPsi = (cart3D.x * center.x + cart3D.y * center.y + cart3D.z * center.z + ROUND_Q30) >> 30;
+          Vec3 coeffs = { cosPsi,
+                          ((cart3D.x * east.x + cart3D.y * east.y + ROUND_Q30) >> 30) - mulQ30Wide(tangentMotionX, cosPsi),
+                          ((cart3D.x * north.x + cart3D.y * north.y + cart3D.z * north.z + ROUND_Q30) >> 30) - mulQ30Wide(tangentMotionY, cosPsi) };
+          if (cosPsi < 0)
+          {
+            coeffs = { -coeffs.x, -coeffs.y, -coeffs.z };
+          }
+          // The floating point model is undefined on the horizon and for a moved point in the center of the plane
+          valid = cosPsi != 0 && (coeffs.y != 0 || coeffs.z != 0);
+          if (valid)
+          {
+            const int64_t maxAbs = std::max(std::max(std::abs(coeffs.x), std::abs(coeffs.y)), std::abs(coeffs.z));
+            const int shift = shiftBelow31(maxAbs);
+            coeffs.x >>= shift;
+            coeffs.y >>= shift;
+            coeffs.z >>= shift;
+            // Moved point in the frame of the block center (towards the center azimuth, east, up). As the floating
+            // point model determines the azimuth offset with atan instead of atan2, the horizontal direction is
+            // mirrored through the origin if it points away from the center azimuth.
+            Vec3 local = { coeffs.x * north.z - coeffs.z * center.z,
+                           coeffs.y * FixedPointTrig::ONE,
+                           coeffs.x * center.z + coeffs.z * north.z };
+            if (local.x < 0)
+            {
+              local.x = -local.x;
+              local.y = -local.y;
+            }
+            uint32_t phiOffset;
+            sphericalAngles(local, thetaMoved, phiOffset);
+            phiMoved = phiCenter + phiOffset;
+          }
+        }
+        else
+        {
+          uint32_t theta, phi;
+          sphericalAngles(rotation * cart3D, theta, phi);
+          thetaMoved = theta + motionX;
+          if (m_flavor == GeodesicMotionModel::VISHWANATH_MODULATED && motionX != 0)
+          {
+            // delta theta = atan(sin(theta) / (k - cos(theta))), numerator and denominator multiplied by sin(A)
+            int64_t sinThetaRot, cosThetaRot;
+            FixedPointTrig::sincos(theta, sinThetaRot, cosThetaRot);
+            int64_t num = sinThetaRot * sinMotionX;
+            int64_t den = sinCenterMoved * FixedPointTrig::ONE - cosThetaRot * sinMotionX;
+            if (den < 0)
+            {
+              num = -num;
+              den = -den;
+            }
+            valid = num != 0 || den != 0;
+            thetaMoved = theta + FixedPointTrig::atan2(num, den);
+          }
+          if (valid)
+          {
+            sphericalAngles(rotation.transposedTimes(unitVector(thetaMoved, phi + motionY)), thetaMoved, phiMoved);
+          }
+        }
+      }
+
+      // No motion for undefined results, as for NaN in the floating point reprojection
+      const int fixedX = valid ? projectionX(phiMoved) - m_offset4x4 : int(startX + col * stepX) - m_offset4x4;
+      const int fixedY = valid ? projectionY(thetaMoved) - m_offset4x4 : int(startY + row * stepY) - m_offset4x4;
+      dst.xPos[i]  = fixedX >> shiftHor;
+      dst.yPos[i]  = fixedY >> shiftVer;
+      dst.xFrac[i] = fixedX & fracMaskHor;
+      dst.yFrac[i] = fixedY & fracMaskVer;
+    }
+  }
+}
@@ -0,0 +1,95 @@
+//
+// Integer-only motion vector reprojection for the equirectangular projection.
+//
+
+#pragma once
+
+#include "CommonDef.h"
+#include "Unit.h"
+#include "Mv.h"
+#include "Coordinate.h"
+#include "MotionModels/GeodesicMotionModel.h"
+
+struct SubblockPositions;
+
+/// Fixed-point trigonometry on binary angles, where 2^32 corresponds to a full turn and angles wrap around like
+/// unsigned integers. Sine and cosine are Q30 values interpolated from a quarter wave table with a Taylor correction
+/// of the remaining angle, the arctangent uses a table and a correction term on the remaining ratio. All results are
+/// exact functions of the integer arguments, so they are identical on all platforms. Maximum absolute errors are below
+/// 2^-28.
+namespace FixedPointTrig
+{
+  static constexpr int      PRECISION    = 30;
+  static constexpr int64_t  ONE          = int64_t(1) << PRECISION;
+  static constexpr uint32_t QUARTER_TURN = 1u << 30;
+  static constexpr uint32_t HALF_TURN    = 1u << 31;
+
+  void     sincos(uint32_t angle, int64_t &s, int64_t &c);
+  /** Angle of (x, y) in (-pi, pi] as binary angle. Arbitrary scale of x and y; 0 for the origin. */
+  uint32_t atan2(int64_t y, int64_t x);
+  /** Floor of the square root */
+  uint64_t isqrt(uint64_t value);
+}
+
+/// Integer-only reprojection of the subblock origins for the tangential, rotational and geodesic motion models in the
+/// equirectangular projection. Replaces the floating point modeling of MVReprojection when the SPS enables it, so that
+/// the subblock positions of these models do not depend on the floating point environment of the host. The models
+/// follow their floating point counterparts up to the precision of the fixed-point trigonometry; positions on the
+/// sphere are Q30 vectors and angles binary angles.
+class FixedPointReprojection
+{
+public:
+  FixedPointReprojection(): m_width(0), m_height(0), m_pixelOffset(0), m_offset4x4(0), m_flavor(GeodesicMotionModel::VISHWANATH_ORIGINAL) {}
+
+  /** @param pixelOffset Pixel offset of the projection in 1/16 samples
+   *  @param offset4x4 Subblock origin offset within the 4x4 subblocks in 1/16 samples */
+  void init(const Size &resolution, int pixelOffset, int offset4x4, GeodesicMotionModel::Flavor flavor);
+  bool isInitialized() const { return m_width > 0; }
+  static bool supports(MotionModelID motionModelID);
+
+  /** @brief Reproject the motion vector on the subblocks of dst (rows and cols set by the caller).
+   *
+   * Same interface as the fused MVReprojection::reprojectMotionVectorSubblocks(). The epipole (precision
+   * EPIPOLE_PRECISION_FIXED) is only used by the geodesic motion models.
+   */
+  void reprojectSubblocks(const Position &position, const Size &size, const Size &subblockSize,
+                          ComponentID compID, ChromaFormat chromaFormat,
+                          const Mv &motionVector, MotionModelID motionModelID, const Array3Fixed &epipole,
+                          SubblockPositions &dst) const;
+
+protected:
+  struct Vec3
+  {
+    int64_t x, y, z;
+  };
+  /** Q30 rotation matrix */
+  struct Matrix3
+  {
+    int64_t m[3][3];
+
+    Vec3 operator*(const Vec3 &v) const;
+    Vec3 transposedTimes(const Vec3 &v) const;
+    Matrix3 operator*(const Matrix3 &other) const;
+    Matrix3 transposed() const;
+  };
+
+  static Matrix3 rotationZ(uint32_t angle);
+  static Matrix3 rotationY(uint32_t angle);
+  /** Rotation of the north pole to the epipole as in GeodesicMotionModel::Rotation. False for a zero epipole. */
+  static bool epipoleRotation(const Array3Fixed &epipole, Matrix3 &rotation);
+
+  static Vec3 unitVector(uint32_t theta, uint32_t phi);
+  /** Polar angle and azimuth of a vector of arbitrary length */
+  static void sphericalAngles(Vec3 v, uint32_t &theta, uint32_t &phi);
+
+  uint32_t azimuth(int64_t x) const;
+  uint32_t polarAngle(int64_t y) const;
+  int projectionX(uint32_t phi) const;
+  int projectionY(uint32_t theta) const;
+
+  int m_width;
+  int m_height;
+  int m_pixelOffset;  /**< 1/16 samples */
+  int m_offset4x4;  /**< 1/16 samples */
+  GeodesicMotionModel::Flavor m_flavor;
+};
@@ -40,6 +40,7 @@
 #include "Buffer.h"
 #include "UnitTools.h"
 #include "MCTS.h"
+#include "MMProfiler.h"
 
 #include <memory.h>
 #include <algorithm>
@@ -711,31 +712,19 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
 #if INTERPRED_PROFILING
   auto start_mvReprojTime = std::chrono::high_resolution_clock::now();
 #endif
-  ArrayXXFixedPtrPair cart2DProjMovedFixedSubblocks = m_mvReprojection->reprojectMotionVectorSubblocks(
-    blockPos, blockSize, mv, motionModel, compID, chFmt, pu.cs->slice->getPOC(), refPic->getPOC());
+  m_mvReprojection->reprojectMotionVectorSubblocks(blockPos, blockSize, mv, motionModel, compID, chFmt,
+                                                   pu.cs->slice->getPOC(), refPic->getPOC(), m_subblockPositions,
+                                                   m_mvReprojectionContext);
+  // Integer sample positions and fractional phases with precision according to the current component ID and chroma format.
+  const int *xPos = m_subblockPositions.xPos;
+  const int *yPos = m_subblockPositions.yPos;
+  const int *xFrac = m_subblockPositions.xFrac;
+  const int *yFrac = m_subblockPositions.yFrac;
 #if INTERPRED_PROFILING
   auto end_mvReprojTime = std::chrono::high_resolution_clock::now();
   dbg_mvReprojTime += std::chrono::duration<double>(end_mvReprojTime - start_mvReprojTime).count();
 #endif
 
-#if INTERPRED_PROFILING
-  auto start_fracCalcTime = std::chrono::high_resolution_clock::now();
-#endif
-  // MVReprojection returns fixed precision moved subblock positions with precision (decimal shift)
-  // according to the current component ID and chroma format.
-  int shiftHor = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleX(compID, chFmt));
-  int shiftVer = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleY(compID, chFmt));
-  ArrayXXFixed xPos, yPos;  // Integer pixel coordinates
-  ArrayXXFixed xFrac, yFrac; // Fractional pixel coordinates
-  xPos = std::get<0>(cart2DProjMovedFixedSubblocks)->unaryExpr([shiftHor](int val){ return val >> shiftHor; });
-  yPos = std::get<1>(cart2DProjMovedFixedSubblocks)->unaryExpr([shiftVer](int val){ return val >> shiftVer; });
-  xFrac = std::get<0>(cart2DProjMovedFixedSubblocks)->unaryExpr([shiftHor](int val){ return val & ((1 << shiftHor) - 1); });
-  yFrac = std::get<1>(cart2DProjMovedFixedSubblocks)->unaryExpr([shiftVer](int val){ return val & ((1 << shiftVer) - 1); });
-#if INTERPRED_PROFILING
-  auto end_fracCalcTime = std::chrono::high_resolution_clock::now();
-  dbg_fracCalcTime += std::chrono::duration<double>(end_fracCalcTime - start_fracCalcTime).count();
-#endif
-
   PelBuf& dstBuf = dstPic.bufs[compID];
 
   CPelBuf refBuf;
@@ -770,59 +759,75 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
 #if INTERPRED_PROFILING
   auto start_interpolTime = std::chrono::high_resolution_clock::now();
 #endif
+  g_mmProfiler.add(motionModel, MMProfiler::PREDICTIONS);
+  MMProfiler::ScopedTimer interpolationTimer(motionModel, MMProfiler::INTERPOLATION_TIME);
   const Size subblockSize = MVReprojection::subblockSize(compID, chFmt);
   const int scaleX = 1 << getComponentScaleX(compID, chFmt);
   const int scaleY = 1 << getComponentScaleY(compID, chFmt);
   int maxCUWidth = int(pu.cs->sps->getMaxCUWidth()) / scaleX;
   int maxCUHeight = int(pu.cs->sps->getMaxCUHeight()) / scaleY;
-  for (int col = 0; col < blockSize.width / subblockSize.width; ++col) {
-    for (int row = 0; row < blockSize.height / subblockSize.height; ++row) {
-      if (xPos(row, col) < -maxCUWidth or yPos(row, col) < -maxCUHeight or xPos(row, col) >= refBuf.width + maxCUWidth - subblockSize.width or yPos(row, col) >= refBuf.height + maxCUHeight - subblockSize.height)
-      {
-        dstBuf.subBuf(col * int(subblockSize.width), row * int(subblockSize.height), subblockSize.width, subblockSize.height).memset(0);
-        continue;
-      }
-      if (yFrac(row, col) == 0)
-      {
-        m_if.filterHor(compID,
-                       (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col),
-                       refBuf.stride,
-                       dstBuf.buf + row * subblockSize.height * dstBuf.stride + col * subblockSize.width,
-                       dstBuf.stride,
-                       int(subblockSize.width), int(subblockSize.height), xFrac(row, col), rndRes, clpRng, filterIdx, useAltHpelIf);
-      }
-      else if (xFrac(row, col) == 0)
-      {
-        m_if.filterVer(compID,
-                       (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col),
-                       refBuf.stride,
-                       dstBuf.buf + row * subblockSize.height * dstBuf.stride + col * subblockSize.width,
-                       dstBuf.stride,
-                       int(subblockSize.width), int(subblockSize.height), yFrac(row, col), true, rndRes, clpRng, filterIdx, useAltHpelIf);
-      }
-      else
-      {
-        PelBuf tmpBuf = PelBuf(m_filteredBlockTmp[0][compID], subblockSize);
-        // TODO: tmpBuf.stride = dstBuf.stride? Probably speeds up data copy by a little bit...
-        tmpBuf.stride = dstBuf.stride;
-
-        int vFilterSize = isLuma(compID) ? NTAPS_LUMA : NTAPS_CHROMA;
-        if (bilinearMC)
+  if (!bilinearMC)
+  {
+    // All subblocks in one call, the batched kernel selects the filter path per subblock. As in the loop below, the
+    // upper bound is unsigned, so negative positions count as outside of the reference picture.
+    const Position minPos(0, 0);
+    const Position maxPos(refBuf.width + maxCUWidth - subblockSize.width, refBuf.height + maxCUHeight - subblockSize.height);
+    m_if.filterSubblocks(compID, refBuf.buf, refBuf.stride, dstBuf.buf, dstBuf.stride, subblockSize,
+                         blockSize.height / subblockSize.height, blockSize.width / subblockSize.width, xPos, yPos, xFrac,
+                         yFrac, minPos, maxPos, rndRes, clpRng);
+  }
+  else
+  {
+    for (int col = 0; col < blockSize.width / subblockSize.width; ++col) {
+      for (int row = 0; row < blockSize.height / subblockSize.height; ++row) {
+        const int i = m_subblockPositions.idx(row, col);
+        if (xPos[i] < -maxCUWidth or yPos[i] < -maxCUHeight or xPos[i] >= refBuf.width + maxCUWidth - subblockSize.width or yPos[i] >= refBuf.height + maxCUHeight - subblockSize.height)
+        {
+          dstBuf.subBuf(col * int(subblockSize.width), row * int(subblockSize.height), subblockSize.width, subblockSize.height).memset(0);
+          continue;
+        }
+        if (yFrac[i] == 0)
+        {
+          m_if.filterHor(compID,
+                         (Pel *) refBuf.buf + yPos[i] * refBuf.stride + xPos[i],
+                         refBuf.stride,
+                         dstBuf.buf + row * subblockSize.height * dstBuf.stride + col * subblockSize.width,
+                         dstBuf.stride,
+                         int(subblockSize.width), int(subblockSize.height), xFrac[i], rndRes, clpRng, filterIdx, useAltHpelIf);
+        }
+        else if (xFrac[i] == 0)
+        {
+          m_if.filterVer(compID,
+                         (Pel *) refBuf.buf + yPos[i] * refBuf.stride + xPos[i],
+                         refBuf.stride,
+                         dstBuf.buf + row * subblockSize.height * dstBuf.stride + col * subblockSize.width,
+                         dstBuf.stride,
+                         int(subblockSize.width), int(subblockSize.height), yFrac[i], true, rndRes, clpRng, filterIdx, useAltHpelIf);
+        }
+        else
         {
-          vFilterSize = NTAPS_BILINEAR;
+          PelBuf tmpBuf = PelBuf(m_filteredBlockTmp[0][compID], subblockSize);
+          // TODO: tmpBuf.stride = dstBuf.stride? Probably speeds up data copy by a little bit...
+          tmpBuf.stride = dstBuf.stride;
+
+          int vFilterSize = isLuma(compID) ? NTAPS_LUMA : NTAPS_CHROMA;
+          if (bilinearMC)
+          {
+            vFilterSize = NTAPS_BILINEAR;
+          }
+          m_if.filterHor(compID, (Pel *) refBuf.buf + yPos[i] * refBuf.stride + xPos[i] - ((vFilterSize >> 1) - 1) * refBuf.stride,
+                         refBuf.stride,
+                         tmpBuf.buf,
+                         tmpBuf.stride,
+                         int(subblockSize.width), int(subblockSize.height) + vFilterSize - 1, xFrac[i], false, clpRng, filterIdx, useAltHpelIf);
+          JVET_J0090_SET_CACHE_ENABLE(false);
+          m_if.filterVer(compID,
+                         (Pel *) tmpBuf.buf + ((vFilterSize >> 1) - 1) * tmpBuf.stride,
+                         tmpBuf.stride,
+                         dstBuf.buf + row * subblockSize.height * dstBuf.stride + col * subblockSize.width,
+                         dstBuf.stride,
+                         int(subblockSize.width), int(subblockSize.height), yFrac[i], false, rndRes, clpRng, filterIdx, useAltHpelIf);
         }
-        m_if.filterHor(compID, (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col) - ((vFilterSize >> 1) - 1) * refBuf.stride,
-                       refBuf.stride,
-                       tmpBuf.buf,
-                       tmpBuf.stride,
-                       int(subblockSize.width), int(subblockSize.height) + vFilterSize - 1, xFrac(row, col), false, clpRng, filterIdx, useAltHpelIf);
-        JVET_J0090_SET_CACHE_ENABLE(false);
-        m_if.filterVer(compID,
-                       (Pel *) tmpBuf.buf + ((vFilterSize >> 1) - 1) * tmpBuf.stride,
-                       tmpBuf.stride,
-                       dstBuf.buf + row * subblockSize.height * dstBuf.stride + col * subblockSize.width,
-                       dstBuf.stride,
-                       int(subblockSize.width), int(subblockSize.height), yFrac(row, col), false, rndRes, clpRng, filterIdx, useAltHpelIf);
       }
     }
   }
@@ -830,6 +835,7 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
     (srcPadStride == 0)
     && (bioApplied
         == false));   // Enabled only in non-DMVR-non-BDOF process, In DMVR process, srcPadStride is always non-zero
+  interpolationTimer.stop();
 #if INTERPRED_PROFILING
   auto end_interpolTime = std::chrono::high_resolution_clock::now();
   dbg_interpolTime += std::chrono::duration<double>(end_interpolTime - start_interpolTime).count();
@@ -840,7 +846,7 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
   {
     // Extended sample values for BDOF
     dstBuf.buf = m_filteredBlockTmp[2 + m_iRefListIdx][compID];
-    xNearestNeighborPaddingForBDOF(xPos, yPos, xFrac, yFrac, refBuf, dstBuf, bdofWidth, bdofHeight, clpRng);
+    xNearestNeighborPaddingForBDOF(m_subblockPositions, refBuf, dstBuf, bdofWidth, bdofHeight, clpRng);
 
     // restore data
     dstBuf.buf    = backupDstBufPtr;
@@ -855,22 +861,26 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
 #endif
 }
 
-void InterPrediction::xNearestNeighborPaddingForBDOF(const ArrayXXFixed &xPos, const ArrayXXFixed &yPos,
-                                                     const ArrayXXFixed &xFrac, const ArrayXXFixed &yFrac,
+void InterPrediction::xNearestNeighborPaddingForBDOF(const SubblockPositions &subblockPositions,
                                                      CPelBuf refBuf, PelBuf dstBuf,
                                                      int bdofWidth, int bdofHeight,
                                                      ClpRng clpRng)
 {
   const int shift = IF_INTERNAL_FRAC_BITS(clpRng.bd);
   int xOffset, yOffset;
-  const int rows = xPos.rows();
-  const int cols = xPos.cols();
+  const int rows = subblockPositions.rows;
+  const int cols = subblockPositions.cols;
+  const int *xPos = subblockPositions.xPos;
+  const int *yPos = subblockPositions.yPos;
+  const int *xFrac = subblockPositions.xFrac;
+  const int *yFrac = subblockPositions.yFrac;
 
   // Loop through 4x4 subblock shifts in top row
   for (int col = 0; col < cols; ++col)
   {
-    xOffset = xPos(0, col) + ((xFrac(0, col) < 8) ? 1 : 0);
-    yOffset = yPos(0, col) + ((yFrac(0, col) < 8) ? 1 : 0);
+    const int i = subblockPositions.idx(0, col);
+    xOffset = xPos[i] + ((xFrac[i] < 8) ? 1 : 0);
+    yOffset = yPos[i] + ((yFrac[i] < 8) ? 1 : 0);
 
     for (int k = 0; k < 4; ++k)
     {
@@ -882,8 +892,9 @@ void InterPrediction::xNearestNeighborPaddingForBDOF(const ArrayXXFixed &xPos, c
   // Loop through 4x4 subblock shifts in left column
   for (int row = 0; row < rows; ++row)
   {
-    xOffset = xPos(row, 0) + ((xFrac(row, 0) < 8) ? 1 : 0);
-    yOffset = yPos(row, 0) + ((yFrac(row, 0) < 8) ? 1 : 0);
+    const int i = subblockPositions.idx(row, 0);
+    xOffset = xPos[i] + ((xFrac[i] < 8) ? 1 : 0);
+    yOffset = yPos[i] + ((yFrac[i] < 8) ? 1 : 0);
 
     for (int k = 0; k < 4; ++k)
     {
@@ -895,8 +906,9 @@ void InterPrediction::xNearestNeighborPaddingForBDOF(const ArrayXXFixed &xPos, c
   // Loop through 4x4 subblock shifts in right column
   for (int row = 0; row < rows; ++row)
   {
-    xOffset = xPos(row, cols - 1) + ((xFrac(row, cols - 1) < 8) ? 1 : 0);
-    yOffset = yPos(row, cols - 1) + ((xFrac(row, cols - 1) < 8) ? 1 : 0);
+    const int i = subblockPositions.idx(row, cols - 1);
+    xOffset = xPos[i] + ((xFrac[i] < 8) ? 1 : 0);
+    yOffset = yPos[i] + ((xFrac[i] < 8) ? 1 : 0);
 
     for (int k = 0; k < 4; ++k)
     {
@@ -908,8 +920,9 @@ void InterPrediction::xNearestNeighborPaddingForBDOF(const ArrayXXFixed &xPos, c
   // Loop through all 4x4 subblock shifts in bottom row
   for (int col = 0; col < cols; ++col)
   {
-    xOffset = xPos(rows - 1, col) + ((xFrac(rows - 1, col) < 8) ? 1 : 0);
-    yOffset = yPos(rows - 1, col) + ((yFrac(rows - 1, col) < 8) ? 1 : 0);
+    const int i = subblockPositions.idx(rows - 1, col);
+    xOffset = xPos[i] + ((xFrac[i] < 8) ? 1 : 0);
+    yOffset = yPos[i] + ((yFrac[i] < 8) ? 1 : 0);
 
     for (int k = 0; k < 4; ++k)
     {
@@ -2477,6 +2490,17 @@ void InterPrediction::xProcessDMVRProjected(PredictionUnit& pu, PelUnitBuf &pcYu
   srcPred0 = srcPred0.subBuf(UnitAreaRelative(pu, subPuTmp));
   srcPred1 = srcPred1.subBuf(UnitAreaRelative(pu, subPuTmp));
 
+  // Window search: the sub-PU extended by one ring of 4x4 subblocks is reprojected and interpolated once per list, and
+  // the integer offsets are evaluated on shifted views of it, as the bilinear window of the classic DMVR. Sub-PUs whose
+  // window leaves the picture fall back to a prediction per offset.
+  const int windowMargin = 4;
+  CHECK(iterationCount * DMVR_NUM_ITERATION > windowMargin, "The DMVR search range exceeds the prediction window.");
+  const bool useWindow = pu.cs->sps->getUseMMDMVRWindow();
+  const int picWidth = int(pu.cs->pps->getPicWidthInLumaSamples());
+  const int picHeight = int(pu.cs->pps->getPicHeightInLumaSamples());
+  m_biLinearBufStride = (MAX_CU_SIZE + (2 * DMVR_NUM_ITERATION));
+  const int windowStride = m_biLinearBufStride;
+
   int yStart = 0;
   for (int y = puPos.y; y < (puPos.y + pu.lumaSize().height); y = y + dy, yStart = yStart + dy)
   {
@@ -2485,6 +2509,28 @@ void InterPrediction::xProcessDMVRProjected(PredictionUnit& pu, PelUnitBuf &pcYu
       PredictionUnit subPu = pu;
       subPu.UnitArea::operator=(UnitArea(pu.chromaFormat, Area(x, y, dx, dy)));
 
+      const bool windowSearch = useWindow && x >= windowMargin && y >= windowMargin
+                                && x + dx + windowMargin <= picWidth && y + dy + windowMargin <= picHeight;
+      Pel *windowL0 = nullptr;
+      Pel *windowL1 = nullptr;
+      if (windowSearch)
+      {
+        PredictionUnit windowPu = pu;
+        windowPu.UnitArea::operator=(UnitArea(pu.chromaFormat, Area(x - windowMargin, y - windowMargin,
+                                                                    dx + 2 * windowMargin, dy + 2 * windowMargin)));
+        const Size windowSize(dx + 2 * windowMargin, dy + 2 * windowMargin);
+        PelUnitBuf windowPredL0(pu.chromaFormat, PelBuf(m_cYuvPredTempDMVRL0, windowStride, windowSize));
+        PelUnitBuf windowPredL1(pu.chromaFormat, PelBuf(m_cYuvPredTempDMVRL1, windowStride, windowSize));
+        xPredInterBlkMM(COMPONENT_Y, windowPu, refPicL0, mergeMv[0], windowPredL0, motionModel, true,
+                        pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
+                        pu.cu->slice->getScalingRatio(REF_PIC_LIST_0, pu.refIdx[REF_PIC_LIST_0]), false);
+        xPredInterBlkMM(COMPONENT_Y, windowPu, refPicL1, mergeMv[1], windowPredL1, motionModel, true,
+                        pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
+                        pu.cu->slice->getScalingRatio(REF_PIC_LIST_1, pu.refIdx[REF_PIC_LIST_1]), false);
+        windowL0 = m_cYuvPredTempDMVRL0 + windowMargin * (windowStride + 1);
+        windowL1 = m_cYuvPredTempDMVRL1 + windowMargin * (windowStride + 1);
+      }
+
       uint64_t  minCost         = MAX_UINT64;
       bool      notZeroCost     = true;
       int16_t   totalDeltaMV[2] = { 0, 0 };
@@ -2507,16 +2553,23 @@ void InterPrediction::xProcessDMVRProjected(PredictionUnit& pu, PelUnitBuf &pcYu
 
         if (i == 0)
         {
-          xPredInterBlkMM(COMPONENT_Y, subPu, refPicL0, totalMv0, srcPred0, motionModel, true,
-                          pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
-                          pu.cu->slice->getScalingRatio(REF_PIC_LIST_0, pu.refIdx[REF_PIC_LIST_0]), false);
-          xPredInterBlkMM(COMPONENT_Y, subPu, refPicL1, totalMv1, srcPred1, motionModel, true,
-                          pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
-                          pu.cu->slice->getScalingRatio(REF_PIC_LIST_1, pu.refIdx[REF_PIC_LIST_1]), false);
-          minCost = xDMVRCost(bd,
-                              srcPred0.bufs[COMPONENT_Y].buf, srcPred0.bufs[COMPONENT_Y].stride,
-                              srcPred1.bufs[COMPONENT_Y].buf, srcPred1.bufs[COMPONENT_Y].stride,
-                              dx, dy);
+          if (windowSearch)
+          {
+            minCost = xDMVRCost(bd, windowL0, windowStride, windowL1, windowStride, dx, dy);
+          }
+          else
+          {
+            xPredInterBlkMM(COMPONENT_Y, subPu, refPicL0, totalMv0, srcPred0, motionModel, true,
+                            pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
+                            pu.cu->slice->getScalingRatio(REF_PIC_LIST_0, pu.refIdx[REF_PIC_LIST_0]), false);
+            xPredInterBlkMM(COMPONENT_Y, subPu, refPicL1, totalMv1, srcPred1, motionModel, true,
+                            pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
+                            pu.cu->slice->getScalingRatio(REF_PIC_LIST_1, pu.refIdx[REF_PIC_LIST_1]), false);
+            minCost = xDMVRCost(bd,
+                                srcPred0.bufs[COMPONENT_Y].buf, srcPred0.bufs[COMPONENT_Y].stride,
+                                srcPred1.bufs[COMPONENT_Y].buf, srcPred1.bufs[COMPONENT_Y].stride,
+                                dx, dy);
+          }
           minCost -= (minCost >> 2);
           if (minCost < (dx * dy))
           {
@@ -2531,36 +2584,45 @@ void InterPrediction::xProcessDMVRProjected(PredictionUnit& pu, PelUnitBuf &pcYu
           break;
         }
 
-        // Integer search loop -> pattern in m_pSearchOffset.
-        Mv totalMv0Orig = totalMv0;
-        Mv totalMv1Orig = totalMv1;
-        for (int nIdx = 0; (nIdx < 25); ++nIdx)
+        if (windowSearch)
         {
-          int32_t sadOffset = ((m_pSearchOffset[nIdx].getVer() * ((2 * DMVR_NUM_ITERATION) + 1)) + m_pSearchOffset[nIdx].getHor());
+          // xBIPMVRefine() addresses the window with m_biLinearBufStride
+          xBIPMVRefine(bd, windowL0 + totalDeltaMV[0] + totalDeltaMV[1] * windowStride,
+                       windowL1 - totalDeltaMV[0] - totalDeltaMV[1] * windowStride, minCost, deltaMV, pSADsArray, dx, dy);
+        }
+        else
+        {
+          // Integer search loop -> pattern in m_pSearchOffset.
+          Mv totalMv0Orig = totalMv0;
+          Mv totalMv1Orig = totalMv1;
+          for (int nIdx = 0; (nIdx < 25); ++nIdx)
+          {
+            int32_t sadOffset = ((m_pSearchOffset[nIdx].getVer() * ((2 * DMVR_NUM_ITERATION) + 1)) + m_pSearchOffset[nIdx].getHor());
 
-          totalMv0 = totalMv0Orig + (m_pSearchOffset[nIdx] << MV_FRACTIONAL_BITS_INTERNAL);
-          totalMv1 = totalMv1Orig - (m_pSearchOffset[nIdx] << MV_FRACTIONAL_BITS_INTERNAL);
+            totalMv0 = totalMv0Orig + (m_pSearchOffset[nIdx] << MV_FRACTIONAL_BITS_INTERNAL);
+            totalMv1 = totalMv1Orig - (m_pSearchOffset[nIdx] << MV_FRACTIONAL_BITS_INTERNAL);
 
-          xPredInterBlkMM(COMPONENT_Y, subPu, refPicL0, totalMv0, srcPred0, motionModel, true,
-                          pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
-                          pu.cu->slice->getScalingRatio(REF_PIC_LIST_0, pu.refIdx[REF_PIC_LIST_0]), false);
-          xPredInterBlkMM(COMPONENT_Y, subPu, refPicL1, totalMv1, srcPred1, motionModel, true,
-                          pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
-                          pu.cu->slice->getScalingRatio(REF_PIC_LIST_1, pu.refIdx[REF_PIC_LIST_1]), false);
+            xPredInterBlkMM(COMPONENT_Y, subPu, refPicL0, totalMv0, srcPred0, motionModel, true,
+                            pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
+                            pu.cu->slice->getScalingRatio(REF_PIC_LIST_0, pu.refIdx[REF_PIC_LIST_0]), false);
+            xPredInterBlkMM(COMPONENT_Y, subPu, refPicL1, totalMv1, srcPred1, motionModel, true,
+                            pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
+                            pu.cu->slice->getScalingRatio(REF_PIC_LIST_1, pu.refIdx[REF_PIC_LIST_1]), false);
 
-          if (*(pSADsArray + sadOffset) == MAX_UINT64)
-          {
-            const uint64_t cost = xDMVRCost(bd,
-                                            srcPred0.bufs[COMPONENT_Y].buf, srcPred0.bufs[COMPONENT_Y].stride,
-                                            srcPred1.bufs[COMPONENT_Y].buf, srcPred1.bufs[COMPONENT_Y].stride,
-                                            dx, dy);
-            *(pSADsArray + sadOffset) = cost;
-          }
-          if (*(pSADsArray + sadOffset) < minCost)
-          {
-            minCost = *(pSADsArray + sadOffset);
-            deltaMV[0] = m_pSearchOffset[nIdx].getHor();
-            deltaMV[1] = m_pSearchOffset[nIdx].getVer();
+            if (*(pSADsArray + sadOffset) == MAX_UINT64)
+            {
+              const uint64_t cost = xDMVRCost(bd,
+                                              srcPred0.bufs[COMPONENT_Y].buf, srcPred0.bufs[COMPONENT_Y].stride,
+                                              srcPred1.bufs[COMPONENT_Y].buf, srcPred1.bufs[COMPONENT_Y].stride,
+                                              dx, dy);
+              *(pSADsArray + sadOffset) = cost;
+            }
+            if (*(pSADsArray + sadOffset) < minCost)
+            {
+              minCost = *(pSADsArray + sadOffset);
+              deltaMV[0] = m_pSearchOffset[nIdx].getHor();
+              deltaMV[1] = m_pSearchOffset[nIdx].getVer();
+            }
           }
         }
 
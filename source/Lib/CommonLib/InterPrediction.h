@@ -129,14 +129,15 @@ protected:
 
   // Multi-model inter prediction
   MVReprojection*       m_mvReprojection;
+  MVReprojectionContext m_mvReprojectionContext;  ///< Reprojection state of this prediction instance (one per thread)
+  SubblockPositions    m_subblockPositions;  ///< Scratch for reprojected subblock positions of the current block
 
   int                  m_IBCBufferWidth;
   PelStorage           m_IBCBuffer;
   void xIntraBlockCopy          (PredictionUnit &pu, PelUnitBuf &predBuf, const ComponentID compID);
   int             rightShiftMSB(int numer, int    denom);
   void            applyBiOptFlow(const PredictionUnit &pu, const CPelUnitBuf &yuvSrc0, const CPelUnitBuf &yuvSrc1, const int &refIdx0, const int &refIdx1, PelUnitBuf &yuvDst, const BitDepths &clipBitDepths);
-  void xNearestNeighborPaddingForBDOF(const ArrayXXFixed &xPos, const ArrayXXFixed &yPos,
-                                      const ArrayXXFixed &xFrac, const ArrayXXFixed &yFrac,
+  void xNearestNeighborPaddingForBDOF(const SubblockPositions &subblockPositions,
                                       CPelBuf refBuf, PelBuf dstBuf,
                                       int bdofWidth, int bdofHeight,
                                       ClpRng clpRng);
@@ -194,13 +195,11 @@ public:
 #if INTERPRED_PROFILING
   double dbg_predBlkTime;
   double dbg_mvReprojTime;
-  double dbg_fracCalcTime;
   double dbg_interpolTime;
   double dbg_bdofPadTime;
   void reset_profiling() {
     dbg_predBlkTime = 0;
     dbg_mvReprojTime = 0;
-    dbg_fracCalcTime = 0;
     dbg_interpolTime = 0;
     dbg_bdofPadTime = 0;
   }
@@ -208,14 +207,12 @@ public:
     std::cout << std::fixed;
     std::cout << std::setprecision(2);
     double pct_mvReproj = dbg_mvReprojTime/dbg_predBlkTime;
-    double pct_fracCalc = dbg_fracCalcTime/dbg_predBlkTime;
     double pct_interpol = dbg_interpolTime/dbg_predBlkTime;
     double pct_bdofPad = dbg_bdofPadTime/dbg_predBlkTime;
-    double remainderTime = dbg_predBlkTime - dbg_mvReprojTime - dbg_fracCalcTime - dbg_interpolTime - dbg_bdofPadTime;
+    double remainderTime = dbg_predBlkTime - dbg_mvReprojTime - dbg_interpolTime - dbg_bdofPadTime;
     double pct_remainder = remainderTime/dbg_predBlkTime;
     std::cout << "predBlkTime: " << dbg_predBlkTime << "s\n";
     std::cout << "  mvReprojTime:   " << dbg_mvReprojTime << "s (" << pct_mvReproj * 100 << "%)\n";
-    std::cout << "  fracCalcTime:   " << dbg_fracCalcTime << "s (" << pct_fracCalc * 100 << "%)\n";
     std::cout << "  interpolTime:   " << dbg_interpolTime << "s (" << pct_interpol * 100 << "%)\n";
     std::cout << "  bdofPadTime:    " << dbg_bdofPadTime << "s (" << pct_bdofPad * 100 << "%)\n";
     std::cout << "  remainderTime:  " << remainderTime << "s (" << pct_remainder * 100 << "%)\n";
@@ -261,6 +258,8 @@ public:
   bool xPredInterBlkRPR( const std::pair<int, int>& scalingRatio, const PPS& pps, const CompArea &blk, const Picture* refPic, const Mv& mv, Pel* dst, const int dstStride, const bool bi, const bool wrapRef, const ClpRng& clpRng, const int filterIndex, const bool useAltHpelIf = false );
 
   MVReprojection* getMVReprojection() { return m_mvReprojection; }
+  MVReprojectionContext& getMVReprojectionContext() { return m_mvReprojectionContext; }
+  const MVReprojectionContext& getMVReprojectionContext() const { return m_mvReprojectionContext; }
 };
 
 //! \}
@@ -364,6 +364,11 @@ InterpolationFilter::InterpolationFilter()
   m_filterCopy[1][0]   = filterCopy<true, false>;
   m_filterCopy[1][1]   = filterCopy<true, true>;
 
+  m_filterSubblocks[0][0] = filterSubblocks<NTAPS_LUMA, false>;
+  m_filterSubblocks[0][1] = filterSubblocks<NTAPS_LUMA, true>;
+  m_filterSubblocks[1][0] = filterSubblocks<NTAPS_CHROMA, false>;
+  m_filterSubblocks[1][1] = filterSubblocks<NTAPS_CHROMA, true>;
+
   m_weightedGeoBlk = xWeightedGeoBlk;
 }
 
@@ -668,10 +673,97 @@ void InterpolationFilter::filterVer(const ClpRng &clpRng, Pel const *src, const
   m_filterVer[IDX][isFirst][isLast](clpRng, src, srcStride, dst, dstStride, width, height, coeff, biMCForDMVR);
 }
 
+/**
+ * \brief Interpolate a block from subblocks with individual integer positions and fractional phases
+ *
+ * \tparam N          Number of taps
+ * \tparam isLast     Flag indicating whether the result is rounded and clipped to the sample bit depth
+ * \param  src        Pointer to the origin of the reference samples the positions refer to
+ * \param  dst        Pointer to the top-left destination sample of the block
+ * \param  numRows    Number of subblock rows, positions are stored column-major
+ * \param  minPos     Minimum valid subblock position
+ * \param  maxPos     Position past the maximum valid subblock position
+ * \param  coeffTable Filter taps of all fractional phases, N per phase
+ */
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// !!! NOTE !!!
+//
+//  This is the scalar version of the function.
+//  If you change the functionality here, consider to switch off the SIMD implementation of this function.
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template<int N, bool isLast>
+void InterpolationFilter::filterSubblocks(const ClpRng &clpRng, Pel const *src, const ptrdiff_t srcStride, Pel *dst,
+                                          const ptrdiff_t dstStride, int sbWidth, int sbHeight, int numRows,
+                                          int numCols, const int *xPos, const int *yPos, const int *xFrac,
+                                          const int *yFrac, const Position &minPos, const Position &maxPos,
+                                          TFilterCoeff const *coeffTable)
+{
+  CHECK(sbWidth > 4 || sbHeight > 4, "Unsupported subblock size");
+  Pel tmp[4 * (4 + N - 1)];
+
+  for (int col = 0; col < numCols; col++)
+  {
+    for (int row = 0; row < numRows; row++)
+    {
+      const int i  = col * numRows + row;
+      Pel *dstBlk  = dst + row * sbHeight * dstStride + col * sbWidth;
+      if (xPos[i] < minPos.x || yPos[i] < minPos.y || xPos[i] >= maxPos.x || yPos[i] >= maxPos.y)
+      {
+        for (int y = 0; y < sbHeight; y++)
+        {
+          ::memset(dstBlk + y * dstStride, 0, sbWidth * sizeof(Pel));
+        }
+        continue;
+      }
+
+      const Pel *srcBlk = src + yPos[i] * srcStride + xPos[i];
+      if (yFrac[i] == 0)
+      {
+        if (xFrac[i] == 0)
+        {
+          filterCopy<true, isLast>(clpRng, srcBlk, srcStride, dstBlk, dstStride, sbWidth, sbHeight, false);
+        }
+        else
+        {
+          filter<N, false, true, isLast>(clpRng, srcBlk, srcStride, dstBlk, dstStride, sbWidth, sbHeight,
+                                         coeffTable + xFrac[i] * N, false);
+        }
+      }
+      else if (xFrac[i] == 0)
+      {
+        filter<N, true, true, isLast>(clpRng, srcBlk, srcStride, dstBlk, dstStride, sbWidth, sbHeight,
+                                      coeffTable + yFrac[i] * N, false);
+      }
+      else
+      {
+        filter<N, false, true, false>(clpRng, srcBlk - (N / 2 - 1) * srcStride, srcStride, tmp, sbWidth, sbWidth,
+                                      sbHeight + N - 1, coeffTable + xFrac[i] * N, false);
+        filter<N, true, false, isLast>(clpRng, tmp + (N / 2 - 1) * sbWidth, sbWidth, dstBlk, dstStride, sbWidth,
+                                       sbHeight, coeffTable + yFrac[i] * N, false);
+      }
+    }
+  }
+}
+
 // ====================================================================================================================
 // Public member functions
 // ====================================================================================================================
 
+void InterpolationFilter::filterSubblocks(const ComponentID compID, Pel const *src, const ptrdiff_t srcStride, Pel *dst,
+                                          const ptrdiff_t dstStride, const Size &subblockSize, int numRows,
+                                          int numCols, const int *xPos, const int *yPos, const int *xFrac,
+                                          const int *yFrac, const Position &minPos, const Position &maxPos,
+                                          bool isLast, const ClpRng &clpRng)
+{
+  const int idx = isLuma(compID) ? 0 : 1;
+  TFilterCoeff const *coeffTable = isLuma(compID) ? m_lumaFilter[0] : m_chromaFilter[0];
+  m_filterSubblocks[idx][isLast](clpRng, src, srcStride, dst, dstStride, int(subblockSize.width),
+                                 int(subblockSize.height), numRows, numCols, xPos, yPos, xFrac, yFrac, minPos, maxPos,
+                                 coeffTable);
+}
+
 void InterpolationFilter::filterHor(const ComponentID compID, Pel const *src, const ptrdiff_t srcStride, Pel *dst,
                                     const ptrdiff_t dstStride, int width, int height, int frac, bool isLast,
                                     const ClpRng &clpRng, int nFilterIdx, bool useAltHpelIf)
@@ -86,6 +86,12 @@ public:
   void filterVer(const ClpRng &clpRng, Pel const *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width,
                  int height, bool isFirst, bool isLast, TFilterCoeff const *coeff, bool biMCForDMVR);
 
+  template<int N, bool isLast>
+  static void filterSubblocks(const ClpRng &clpRng, Pel const *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride,
+                              int sbWidth, int sbHeight, int numRows, int numCols, const int *xPos, const int *yPos,
+                              const int *xFrac, const int *yFrac, const Position &minPos, const Position &maxPos,
+                              TFilterCoeff const *coeffTable);
+
   static void xWeightedGeoBlk(const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const uint8_t splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1);
   void weightedGeoBlk(const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const uint8_t splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1);
 protected:
@@ -112,6 +118,10 @@ public:
                                int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR);
   void (*m_filterCopy[2][2])(const ClpRng &clpRng, Pel const *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride,
                              int width, int height, bool biMCForDMVR);
+  void (*m_filterSubblocks[2][2])(const ClpRng &clpRng, Pel const *src, ptrdiff_t srcStride, Pel *dst,
+                                  ptrdiff_t dstStride, int sbWidth, int sbHeight, int numRows, int numCols,
+                                  const int *xPos, const int *yPos, const int *xFrac, const int *yFrac,
+                                  const Position &minPos, const Position &maxPos, TFilterCoeff const *coeffTable);
   void( *m_weightedGeoBlk )(const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const uint8_t splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1);
 
   void initInterpolationFilter( bool enable );
@@ -126,6 +136,14 @@ public:
   void filterVer(const ComponentID compID, Pel const *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride,
                  int width, int height, int frac, bool isFirst, bool isLast, const ClpRng &clpRng,
                  int nFilterIdx = FILTER_DEFAULT, bool useAltHpelIf = false);
+  /// Interpolate a block whose subblocks each have an own integer position and fractional phase, e.g. the reprojected
+  /// subblocks of a multi-model block. Positions and phases are in column-major subblock order. Subblocks whose position
+  /// is outside of [minPos, maxPos) are set to zero. The result equals filterHor/filterVer with FILTER_DEFAULT applied
+  /// per subblock.
+  void filterSubblocks(const ComponentID compID, Pel const *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride,
+                       const Size &subblockSize, int numRows, int numCols, const int *xPos, const int *yPos,
+                       const int *xFrac, const int *yFrac, const Position &minPos, const Position &maxPos, bool isLast,
+                       const ClpRng &clpRng);
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   void cacheAssign( CacheModel *cache ) { m_cacheModel = cache; }
 #endif
@@ -5,36 +5,41 @@
 #include "MMConfig.h"
 
 std::vector<MotionModelID> MMConfig::getActiveMotionModels() const {
+  MotionModelID activeMotionModels[NUM_MODELS];
+  const int numActiveMotionModels = getActiveMotionModels(activeMotionModels);
+  return std::vector<MotionModelID>(activeMotionModels, activeMotionModels + numActiveMotionModels);
+}
+
+int MMConfig::getActiveMotionModels(MotionModelID *models) const {
+  int numModels = 0;
+  models[numModels++] = CLASSIC;
+  if (MPA)
+  {
+    models[numModels++] = MPA_FRONT_BACK;
+    models[numModels++] = MPA_LEFT_RIGHT;
+    models[numModels++] = MPA_TOP_BOTTOM;
+  }
+  if (T3D)
+  {
+    models[numModels++] = THREE_D_TRANSLATIONAL;
+  }
+  if (TAN)
+  {
+    models[numModels++] = TANGENTIAL;
+  }
+  if (ROT)
+  {
+    models[numModels++] = ROTATIONAL;
+  }
+  if (GED)
+  {
+    models[numModels++] = GEODESIC_CAMPOSE;
+  }
+  if (GEDA)
   {
-    std::vector<MotionModelID> activeMotionModels{ CLASSIC };
-    if (MPA)
-    {
-      activeMotionModels.push_back(MPA_FRONT_BACK);
-      activeMotionModels.push_back(MPA_LEFT_RIGHT);
-      activeMotionModels.push_back(MPA_TOP_BOTTOM);
-    }
-    if (T3D)
-    {
-      activeMotionModels.push_back(THREE_D_TRANSLATIONAL);
-    }
-    if (TAN)
-    {
-      activeMotionModels.push_back(TANGENTIAL);
-    }
-    if (ROT)
-    {
-      activeMotionModels.push_back(ROTATIONAL);
-    }
-    if (GED)
-    {
-      activeMotionModels.push_back(GEODESIC_CAMPOSE);
-    }
-    if (GEDA)
-    {
-      activeMotionModels.push_back(GEODESIC_X);
-      activeMotionModels.push_back(GEODESIC_Y);
-      activeMotionModels.push_back(GEODESIC_Z);
-    }
-    return activeMotionModels;
+    models[numModels++] = GEODESIC_X;
+    models[numModels++] = GEODESIC_Y;
+    models[numModels++] = GEODESIC_Z;
   }
+  return numModels;
 }
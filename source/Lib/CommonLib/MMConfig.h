@@ -20,6 +20,8 @@ struct MMConfig
   bool              GEDA{false}; /**< Geodesic-adaptive motion model */
   GeodesicMotionModel::Flavor GEDFlavor{GeodesicMotionModel::VISHWANATH_ORIGINAL}; /**< Geodesic motion model flavor for geodesic motion models */
   bool              MMMVP{false}; /**< Multi-model motion vector prediction */
+  bool              MMFixedPoint{false}; /**< Integer-only reprojection for the tangential, rotational and geodesic motion models */
+  bool              MMDMVRWindow{false}; /**< Projected DMVR searches the integer offsets in one padded prediction window */
   int               MMOffset4x4{0}; /**< Multi-model 4x4 subblock offset */
   int               projectionFct{0}; /**< Projection function */
   unsigned          focalLengthPx{0};
@@ -31,6 +33,8 @@ struct MMConfig
 
   bool getUseMultiModel() const { return MPA || T3D || TAN || ROT || GED || GEDA; }
   std::vector<MotionModelID> getActiveMotionModels() const;
+  /** Write the active motion models to models, which must hold NUM_MODELS entries, and return their number. */
+  int getActiveMotionModels(MotionModelID *models) const;
 };
 
 #endif   // VTM360_MMCONFIG_H
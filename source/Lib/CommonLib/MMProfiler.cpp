@@ -0,0 +1,257 @@
+//
+// Runtime profiling of the multi-model inter prediction per motion model.
+//
+
+#include "MMProfiler.h"
+
+#include "CodingStructure.h"
+#include "UnitTools.h"
+
+#include <fstream>
+#include <iomanip>
+
+MMProfiler g_mmProfiler;
+
+static const char *const MOTION_MODEL_NAMES[NUM_MODELS] = {
+  "CLASSIC", "MPA_FRONT_BACK", "MPA_LEFT_RIGHT", "MPA_TOP_BOTTOM", "TANGENTIAL", "THREE_D_TRANSLATIONAL",
+  "ROTATIONAL", "GEODESIC_X", "GEODESIC_Y", "GEODESIC_Z", "GEODESIC_CAMPOSE"
+};
+
+static const char *const COUNTER_NAMES[MMProfiler::NUM_COUNTERS] = {
+  "predictions", "reprojections", "reprojection_cache_hits", "reprojection_ms", "interpolation_ms",
+  "mvp_conversions", "mvp_conversion_cache_hits", "mvp_conversion_ms", "selected"
+};
+
+static bool isTimeCounter(int counter)
+{
+  return counter == MMProfiler::REPROJECTION_TIME || counter == MMProfiler::INTERPOLATION_TIME
+         || counter == MMProfiler::MVP_CONVERSION_TIME;
+}
+
+static void writeValue(std::ostream &os, int counter, uint64_t value)
+{
+  if (isTimeCounter(counter)) {
+    // Nanoseconds as milliseconds
+    os << std::fixed << std::setprecision(3) << double(value) * 1e-6;
+  } else {
+    os << value;
+  }
+}
+
+MMProfiler::ScopedTimer::ScopedTimer(MotionModelID motionModel, Counter counter)
+  : m_motionModel(motionModel), m_counter(counter), m_active(g_mmProfiler.isEnabled())
+{
+  if (m_active) {
+    m_start = std::chrono::steady_clock::now();
+  }
+}
+
+void MMProfiler::ScopedTimer::stop()
+{
+  if (m_active) {
+    m_active = false;
+    const auto duration = std::chrono::steady_clock::now() - m_start;
+    g_mmProfiler.add(m_motionModel, m_counter, uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+  }
+}
+
+MMProfiler::MMProfiler(): m_enabled(false)
+{
+  for (auto &model : m_counters) {
+    for (auto &counter : model) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+  }
+  for (auto &rank : m_rankCounters) {
+    for (auto &counter : rank) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+void MMProfiler::open(const std::string &fileName)
+{
+  if (fileName.empty() || m_enabled) {
+    return;
+  }
+  // Fail early rather than after encoding the sequence
+  std::ofstream file(fileName.c_str());
+  CHECK(!file.is_open(), "Unable to open the MM profile file " << fileName << " for writing.");
+  m_fileName = fileName;
+  m_frames.clear();
+  m_enabled = true;
+}
+
+void MMProfiler::countSelected(const CodingStructure &cs)
+{
+  if (!m_enabled) {
+    return;
+  }
+  for (const PredictionUnit *pu : cs.pus) {
+    if (!CU::isInter(*pu->cu)) {
+      continue;
+    }
+    for (int refList = 0; refList < NUM_REF_PIC_LIST_01; refList++) {
+      const MotionModelID motionModel = pu->motionModel[refList];
+      if ((pu->interDir & (1 << refList)) && motionModel >= CLASSIC && motionModel < NUM_MODELS) {
+        add(motionModel, SELECTED);
+      }
+    }
+  }
+}
+
+void MMProfiler::finishFrame(int poc)
+{
+  if (!m_enabled) {
+    return;
+  }
+  Frame frame;
+  frame.poc = poc;
+  for (int model = 0; model < NUM_MODELS; model++) {
+    for (int counter = 0; counter < NUM_COUNTERS; counter++) {
+      frame.counters[model][counter] = m_counters[model][counter].exchange(0, std::memory_order_relaxed);
+    }
+  }
+  m_frames.push_back(frame);
+}
+
+void MMProfiler::close()
+{
+  if (!m_enabled) {
+    return;
+  }
+  // Work after the last picture, e.g. of a flushed GOP, is attributed to the sequence only
+  Frame sequence;
+  sequence.poc = -1;
+  for (int model = 0; model < NUM_MODELS; model++) {
+    for (int counter = 0; counter < NUM_COUNTERS; counter++) {
+      sequence.counters[model][counter] = m_counters[model][counter].exchange(0, std::memory_order_relaxed);
+      for (const Frame &frame : m_frames) {
+        sequence.counters[model][counter] += frame.counters[model][counter];
+      }
+    }
+  }
+
+  std::ofstream file(m_fileName.c_str());
+  CHECK(!file.is_open(), "Unable to open the MM profile file " << m_fileName << " for writing.");
+  const std::string suffix = ".json";
+  const bool json = m_fileName.size() >= suffix.size()
+                    && m_fileName.compare(m_fileName.size() - suffix.size(), suffix.size(), suffix) == 0;
+  if (json) {
+    xWriteJSON(file, sequence);
+  } else {
+    xWriteCSV(file, sequence);
+  }
+  msg(INFO, "\nMM profile of %d pictures written to %s\n", int(m_frames.size()), m_fileName.c_str());
+
+  m_frames.clear();
+  for (auto &rank : m_rankCounters) {
+    for (auto &counter : rank) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+  }
+  m_enabled = false;
+}
+
+std::vector<MMProfiler::TopK> MMProfiler::xTopKReport() const
+{
+  uint64_t counters[NUM_MODELS][NUM_RANK_COUNTERS];
+  int numRanks = 0;
+  uint64_t numChecks = 0, checkTime = 0;
+  for (int rank = 0; rank < NUM_MODELS; rank++) {
+    for (int counter = 0; counter < NUM_RANK_COUNTERS; counter++) {
+      counters[rank][counter] = m_rankCounters[rank][counter].load(std::memory_order_relaxed);
+    }
+    if (counters[rank][RANK_CHECKS] || counters[rank][RANK_SKIPS]) {
+      numRanks = rank + 1;
+    }
+    numChecks += counters[rank][RANK_CHECKS];
+    checkTime += counters[rank][RANK_CHECK_TIME];
+  }
+  // Skipped checks are assumed to take the average time of the checks that were run
+  const double timePerCheck = numChecks ? double(checkTime) / double(numChecks) : 0.0;
+
+  std::vector<TopK> report;
+  for (int k = 1; k < numRanks; k++) {
+    TopK topK = { k, 0, 0.0, 0 };
+    for (int rank = k; rank < numRanks; rank++) {
+      topK.checksSkipped += counters[rank][RANK_CHECKS] + counters[rank][RANK_SKIPS];
+      topK.timeSaved += (double(counters[rank][RANK_CHECK_TIME]) + timePerCheck * double(counters[rank][RANK_SKIPS])) * 1e-6;
+      topK.rdLoss += counters[rank][RANK_RD_GAIN];
+    }
+    report.push_back(topK);
+  }
+  return report;
+}
+
+void MMProfiler::xWriteCSV(std::ostream &os, const Frame &sequence) const
+{
+  os << "scope,poc,model";
+  for (int counter = 0; counter < NUM_COUNTERS; counter++) {
+    os << "," << COUNTER_NAMES[counter];
+  }
+  os << "\n";
+  auto writeRows = [&](const Frame &frame, const char *scope) {
+    for (int model = 0; model < NUM_MODELS; model++) {
+      os << scope << ",";
+      if (frame.poc >= 0) {
+        os << frame.poc;
+      }
+      os << "," << MOTION_MODEL_NAMES[model];
+      for (int counter = 0; counter < NUM_COUNTERS; counter++) {
+        os << ",";
+        writeValue(os, counter, frame.counters[model][counter]);
+      }
+      os << "\n";
+    }
+  };
+  for (const Frame &frame : m_frames) {
+    writeRows(frame, "frame");
+  }
+  writeRows(sequence, "sequence");
+
+  const std::vector<TopK> report = xTopKReport();
+  if (!report.empty()) {
+    os << "\ntop_k,checks_skipped,time_saved_ms,rd_loss\n";
+    for (const TopK &topK : report) {
+      os << topK.k << "," << topK.checksSkipped << "," << std::fixed << std::setprecision(3) << topK.timeSaved << ","
+         << topK.rdLoss << "\n";
+    }
+  }
+}
+
+void MMProfiler::xWriteJSON(std::ostream &os, const Frame &sequence) const
+{
+  auto writeModels = [&](const Frame &frame, const char *indent) {
+    os << "{\n";
+    for (int model = 0; model < NUM_MODELS; model++) {
+      os << indent << "  \"" << MOTION_MODEL_NAMES[model] << "\": {";
+      for (int counter = 0; counter < NUM_COUNTERS; counter++) {
+        os << (counter ? ", " : "") << "\"" << COUNTER_NAMES[counter] << "\": ";
+        writeValue(os, counter, frame.counters[model][counter]);
+      }
+      os << "}" << (model + 1 < NUM_MODELS ? "," : "") << "\n";
+    }
+    os << indent << "}";
+  };
+  os << "{\n  \"frames\": [";
+  for (size_t i = 0; i < m_frames.size(); i++) {
+    os << (i ? "," : "") << "\n    {\n      \"poc\": " << m_frames[i].poc << ",\n      \"models\": ";
+    writeModels(m_frames[i], "      ");
+    os << "\n    }";
+  }
+  os << (m_frames.empty() ? "" : "\n  ") << "],\n  \"sequence\": ";
+  writeModels(sequence, "  ");
+
+  const std::vector<TopK> report = xTopKReport();
+  if (!report.empty()) {
+    os << ",\n  \"preselection\": [";
+    for (size_t i = 0; i < report.size(); i++) {
+      os << (i ? "," : "") << "\n    {\"top_k\": " << report[i].k << ", \"checks_skipped\": " << report[i].checksSkipped
+         << ", \"time_saved_ms\": " << std::fixed << std::setprecision(3) << report[i].timeSaved
+         << ", \"rd_loss\": " << report[i].rdLoss << "}";
+    }
+    os << "\n  ]";
+  }
+  os << "\n}\n";
+}
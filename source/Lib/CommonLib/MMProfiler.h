@@ -0,0 +1,120 @@
+//
+// Runtime profiling of the multi-model inter prediction per motion model.
+//
+
+#pragma once
+
+#include "CommonDef.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+class CodingStructure;
+
+/// Counts calls, runtimes and decisions of the multi-model inter prediction per motion model. Enabled at runtime by
+/// opening an output file (MMProfileFile of encoder and decoder); otherwise every hook reduces to a single branch. The
+/// counters are atomic, as the motion search workers reproject and interpolate concurrently. finishFrame() stores the
+/// counters of the current picture, close() adds the sequence totals and writes all of them as CSV, or as JSON if the
+/// file name ends with ".json". Classic blocks bypass the reprojection, so for CLASSIC only the conversions and the
+/// selected prediction units are counted. The encoder's motion model pre-selection (MMPreselectTopK) is additionally
+/// counted per screening rank; close() turns these counters into a top-K report of the sequence.
+class MMProfiler
+{
+public:
+  enum Counter
+  {
+    PREDICTIONS,                /**< Interpolated blocks, in motion compensation and motion search */
+    REPROJECTIONS,              /**< Subblock reprojections of a block */
+    REPROJECTION_CACHE_HITS,    /**< Reprojections answered by the reprojection cache */
+    REPROJECTION_TIME,          /**< Time of the reprojections in ns */
+    INTERPOLATION_TIME,         /**< Time of the subblock interpolation in ns */
+    MVP_CONVERSIONS,            /**< Motion vector predictor conversions into the motion model */
+    MVP_CONVERSION_CACHE_HITS,  /**< Conversions answered by the conversion cache */
+    MVP_CONVERSION_TIME,        /**< Time of the conversions in ns */
+    SELECTED,                   /**< Coded prediction units per reference list, i.e. the RD decisions of the encoder */
+    NUM_COUNTERS
+  };
+
+  /// Counters of the encoder's motion model pre-selection per screening rank (0: lowest screening distortion)
+  enum RankCounter
+  {
+    RANK_CHECKS,      /**< RD checks of the models of the rank */
+    RANK_CHECK_TIME,  /**< Time of these checks in ns */
+    RANK_RD_GAIN,     /**< Decrease of the best RD cost of the CU by these checks */
+    RANK_SKIPS,       /**< Checks skipped by the pre-selection */
+    NUM_RANK_COUNTERS
+  };
+
+  /// Adds its lifetime, or the time until stop(), to a time counter if the profiler is enabled
+  class ScopedTimer
+  {
+  public:
+    ScopedTimer(MotionModelID motionModel, Counter counter);
+    ~ScopedTimer() { stop(); }
+
+    void stop();
+
+  protected:
+    MotionModelID m_motionModel;
+    Counter m_counter;
+    bool m_active;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+  MMProfiler();
+
+  /** @brief Enable the profiler and write to fileName on close(). Does nothing if fileName is empty or already open. */
+  void open(const std::string &fileName);
+  bool isEnabled() const { return m_enabled; }
+
+  void add(MotionModelID motionModel, Counter counter, uint64_t value = 1)
+  {
+    if (m_enabled) {
+      m_counters[motionModel][counter].fetch_add(value, std::memory_order_relaxed);
+    }
+  }
+
+  void addRank(int rank, RankCounter counter, uint64_t value = 1)
+  {
+    if (m_enabled) {
+      m_rankCounters[rank][counter].fetch_add(value, std::memory_order_relaxed);
+    }
+  }
+
+  /** @brief Count the motion models of the inter prediction units of a coded picture. */
+  void countSelected(const CodingStructure &cs);
+  /** @brief Store the counters since the last call as the statistics of picture poc. */
+  void finishFrame(int poc);
+  /** @brief Write the per picture and per sequence statistics and disable the profiler. */
+  void close();
+
+protected:
+  struct Frame
+  {
+    int poc;
+    uint64_t counters[NUM_MODELS][NUM_COUNTERS];
+  };
+
+  /// Pre-selection with the models of the K best screening ranks, estimated from the checks that were run
+  struct TopK
+  {
+    int k;
+    uint64_t checksSkipped;
+    double timeSaved;  /**< ms */
+    uint64_t rdLoss;  /**< Sum of the RD gains of the checks at rank K and above */
+  };
+
+  std::vector<TopK> xTopKReport() const;
+  void xWriteCSV(std::ostream &os, const Frame &sequence) const;
+  void xWriteJSON(std::ostream &os, const Frame &sequence) const;
+
+  bool m_enabled;
+  std::string m_fileName;
+  std::atomic<uint64_t> m_counters[NUM_MODELS][NUM_COUNTERS];
+  std::atomic<uint64_t> m_rankCounters[NUM_MODELS][NUM_RANK_COUNTERS];  /**< Sequence totals only */
+  std::vector<Frame> m_frames;
+};
+
+extern MMProfiler g_mmProfiler;
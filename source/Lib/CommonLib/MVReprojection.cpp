@@ -3,6 +3,9 @@
 //
 
 #include "MVReprojection.h"
+#include "MMProfiler.h"
+
+#include <cstring>
 
 void MVReprojection::init(const Projection *projection, const Size &resolution, const SPS *sps, const EpipoleList* epipoleList) {
   m_projection = projection;
@@ -10,6 +13,14 @@ void MVReprojection::init(const Projection *projection, const Size &resolution,
   m_offset4x4 = sps->getMMOffset4x4() == 4 ? TCoord(1.5) : TCoord(sps->getMMOffset4x4());
   m_epipoleList = epipoleList;
   fillCache();
+  if (sps->getUseMMFixedPoint()) {
+    const auto *erp = dynamic_cast<const EquirectangularProjection*>(projection);
+    CHECK(erp == nullptr, "Fixed-point reprojection requires the equirectangular projection.");
+    // The motion vector conversion of MMMVP and the MPA and 3DT models are only defined in floating point
+    CHECK(sps->getUseMMMVP() || sps->getUseMPA() || sps->getUse3DT(), "Fixed-point reprojection does not support MMMVP, MPA and 3DT.");
+    const int offset4x4 = sps->getMMOffset4x4() == 4 ? 24 : sps->getMMOffset4x4() << 4;
+    m_fixedPointReprojection.init(resolution, int(std::round(erp->pixelOffset() * 16)), offset4x4, sps->getGEDFlavor());
+  }
 
   for (auto motionModelID : sps->getActiveMotionModels()) {
     MotionModel* motionModel;
@@ -21,7 +32,7 @@ void MVReprojection::init(const Projection *projection, const Size &resolution,
     case MPA_LEFT_RIGHT:
     case MPA_TOP_BOTTOM:
       motionModel = new MotionPlaneAdaptiveMotionModel(projection, motionModelID);
-      static_cast<MotionPlaneAdaptiveMotionModel*>(motionModel)->fillCache({m_cart2DProj[0], m_cart2DProj[1]});
+      static_cast<MotionPlaneAdaptiveMotionModel*>(motionModel)->fillCache(m_sphereTable);
       break;
     case TANGENTIAL:
       motionModel = new TangentialMotionModel(projection, M_PI / resolution.height);
@@ -37,7 +48,6 @@ void MVReprojection::init(const Projection *projection, const Size &resolution,
     case GEODESIC_Z:
     case GEODESIC_CAMPOSE:
       motionModel = new GeodesicMotionModel(projection, M_PI / resolution.height, sps->getGEDFlavor());
-      static_cast<GeodesicMotionModel*>(motionModel)->fillCache({m_cart2DProj[0], m_cart2DProj[1]});
       switch (motionModelID)
       {
       case GEODESIC_X:
@@ -54,6 +64,7 @@ void MVReprojection::init(const Projection *projection, const Size &resolution,
       default:
         CHECK(true, "Broken switch statement.");
       }
+      static_cast<GeodesicMotionModel*>(motionModel)->fillCache(&m_sphereTable);
       break;
     default:
       CHECK(true, "Invalid motion model.");
@@ -66,8 +77,7 @@ void MVReprojection::init(const Projection *projection, const Size &resolution,
 
 void MVReprojection::fillCache()
 {
-  m_cart2DProj[0] = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, 1, Eigen::Dynamic>::LinSpaced(m_resolution.width / 4, m_offset4x4, TCoord(m_resolution.width - 4) + m_offset4x4).replicate(m_resolution.height / 4, 1));
-  m_cart2DProj[1] = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, Eigen::Dynamic, 1>::LinSpaced(m_resolution.height / 4, m_offset4x4, TCoord(m_resolution.height - 4) + m_offset4x4).replicate(1, m_resolution.width / 4));
+  m_sphereTable.fill(m_projection, m_resolution, m_offset4x4);
 }
 
 Size MVReprojection::subblockSize(const ComponentID compID, const ChromaFormat chromaFormat)
@@ -81,88 +91,197 @@ ArrayXXFixedPtrPair
 MVReprojection::reprojectMotionVectorSubblocks(const Position &position, const Size &size,
                                                  const Mv &motionVector, MotionModelID motionModelID,
                                                  ComponentID compID, ChromaFormat chromaFormat,
-                                                 int curPOC, int refPOC)
+                                                 int curPOC, int refPOC,
+                                                 MVReprojectionContext &context) const
 {
-   CHECK(motionModelID == CLASSIC, "This method should not be called with motion model 'CLASSIC'.");
-
-   // Chroma-related parameters
-   const Size subblockSize = MVReprojection::subblockSize(compID, chromaFormat);
-   // Component scale to align to luma scale
-   const TCoord scaleX = std::pow(TCoord(2), TCoord(getComponentScaleX(compID, chromaFormat)));
-   const TCoord scaleY = std::pow(TCoord(2), TCoord(getComponentScaleY(compID, chromaFormat)));
-   // Motion vector and return type precision
-   const int shiftHor = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleX(compID, chromaFormat));
-   const int shiftVer = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleY(compID, chromaFormat));
-
-   // Calculate coordinates or extract from cache.
-  ArrayXXTCoordPtr cart2DProjX, cart2DProjY;
-  ArrayXXTCoordPtr cart2DPersX, cart2DPersY;
-  ArrayXXBoolPtr vip;
-  if (isLuma(compID)) {
-    if (m_lastPosition == position and m_lastSize == size) {
-      cart2DProjX = m_lastCart2DProj[0];
-      cart2DProjY = m_lastCart2DProj[1];
-    } else {
-      cart2DProjX = std::make_shared<ArrayXXTCoord>(m_cart2DProj[0]->block(position.y/subblockSize.height, position.x/subblockSize.width, size.height/subblockSize.height, size.width/subblockSize.width));
-      cart2DProjY = std::make_shared<ArrayXXTCoord>(m_cart2DProj[1]->block(position.y/subblockSize.height, position.x/subblockSize.width, size.height/subblockSize.height, size.width/subblockSize.width));
-      m_lastPosition = position;
-      m_lastSize = size;
-      m_lastCart2DProj[0] = cart2DProjX;
-      m_lastCart2DProj[1] = cart2DProjY;
-    }
-  } else {
-    Array2TCoord lumaScaledStartPos(TCoord(position.x) * scaleX + m_offset4x4,
-                                    TCoord(position.y) * scaleY + m_offset4x4);
-    Array2TCoord lumaScaledEndPos(lumaScaledStartPos.x() + TCoord(size.width - subblockSize.width) * scaleX,
-                                  lumaScaledStartPos.y() + TCoord(size.height - subblockSize.height) * scaleY);
-    cart2DProjX = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, 1, Eigen::Dynamic>::LinSpaced(size.width / subblockSize.width, lumaScaledStartPos.x(), lumaScaledEndPos.x()).replicate(size.height / subblockSize.height, 1));
-    cart2DProjY = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, Eigen::Dynamic, 1>::LinSpaced(size.height / subblockSize.height, lumaScaledStartPos.y(), lumaScaledEndPos.y()).replicate(1, size.width / subblockSize.width));
+  const int shiftHor = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleX(compID, chromaFormat));
+  const int shiftVer = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleY(compID, chromaFormat));
+
+  std::unique_ptr<SubblockPositions> subblockPositions(new SubblockPositions);
+  reprojectMotionVectorSubblocks(position, size, motionVector, motionModelID, compID, chromaFormat, curPOC, refPOC, *subblockPositions, context);
+
+  const SubblockPositions &sbPos = *subblockPositions;
+  ArrayXXFixedPtr cart2DProjMovedFixedX = std::make_shared<ArrayXXFixed>(sbPos.rows, sbPos.cols);
+  ArrayXXFixedPtr cart2DProjMovedFixedY = std::make_shared<ArrayXXFixed>(sbPos.rows, sbPos.cols);
+  for (int i = 0; i < sbPos.rows * sbPos.cols; ++i) {
+    cart2DProjMovedFixedX->coeffRef(i) = (sbPos.xPos[i] << shiftHor) + sbPos.xFrac[i];
+    cart2DProjMovedFixedY->coeffRef(i) = (sbPos.yPos[i] << shiftVer) + sbPos.yFrac[i];
   }
+  return {cart2DProjMovedFixedX, cart2DProjMovedFixedY};
+}
+
+void MVReprojection::reprojectMotionVectorSubblocks(const Position &position, const Size &size,
+                                                    const Mv &motionVector, MotionModelID motionModelID,
+                                                    ComponentID compID, ChromaFormat chromaFormat,
+                                                    int curPOC, int refPOC,
+                                                    SubblockPositions &dst,
+                                                    MVReprojectionContext &context) const
+{
+  CHECK(motionModelID == CLASSIC, "This method should not be called with motion model 'CLASSIC'.");
+  g_mmProfiler.add(motionModelID, MMProfiler::REPROJECTIONS);
+  MMProfiler::ScopedTimer timer(motionModelID, MMProfiler::REPROJECTION_TIME);
+
+  // Chroma-related parameters
+  const Size subblockSize = MVReprojection::subblockSize(compID, chromaFormat);
+  const int rows = int(size.height / subblockSize.height);
+  const int cols = int(size.width / subblockSize.width);
+  CHECK(rows * cols > SubblockPositions::MAX_NUM_SUBBLOCKS, "Block exceeds the subblock position buffer.");
+  dst.rows = rows;
+  dst.cols = cols;
+  // Component scale to align to luma scale
+  const TCoord scaleX = std::pow(TCoord(2), TCoord(getComponentScaleX(compID, chromaFormat)));
+  const TCoord scaleY = std::pow(TCoord(2), TCoord(getComponentScaleY(compID, chromaFormat)));
+  // Motion vector and return type precision
+  const int shiftHor = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleX(compID, chromaFormat));
+  const int shiftVer = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleY(compID, chromaFormat));
 
   // Motion vector as floating point
   const TCoord mvX = TCoord(motionVector.hor >> MV_FRACTIONAL_BITS_INTERNAL) + TCoord(motionVector.hor & ((1 << MV_FRACTIONAL_BITS_INTERNAL) - 1))/TCoord(1 << MV_FRACTIONAL_BITS_INTERNAL);
   const TCoord mvY = TCoord(motionVector.ver >> MV_FRACTIONAL_BITS_INTERNAL) + TCoord(motionVector.ver & ((1 << MV_FRACTIONAL_BITS_INTERNAL) - 1))/TCoord(1 << MV_FRACTIONAL_BITS_INTERNAL);
 
   // Epipole setup
+  Array3TCoord epipole = Array3TCoord::Zero();
   if (motionModelID == GEODESIC_CAMPOSE) {
-    static_cast<GeodesicMotionModel*>(m_motionModels[motionModelID])->setEpipole(m_epipoleList->findEpipole(curPOC, refPOC));
+    epipole = m_epipoleList->findEpipole(curPOC, refPOC);
   }
 
+  // Cached result
+  ReprojectionCache::Key cacheKey;
+  ReprojectionCache &reprojectionCache = context.reprojectionCache;
+  const bool useCache = reprojectionCache.isInitialized();
+  if (useCache) {
+    cacheKey = { position.x, position.y, int(size.width), int(size.height),
+                 int(compID), int(chromaFormat), int(motionModelID),
+                 motionVector.hor, motionVector.ver, { 0, 0, 0 } };
+    for (int i = 0; i < 3; i++) {
+      std::memcpy(&cacheKey.epipole[i], &epipole[i], sizeof(int));
+    }
+    if (reprojectionCache.lookup(cacheKey, dst)) {
+      g_mmProfiler.add(motionModelID, MMProfiler::REPROJECTION_CACHE_HITS);
+      return;
+    }
+  }
+
+  if (m_fixedPointReprojection.isInitialized() && FixedPointReprojection::supports(motionModelID)) {
+    Array3Fixed epipoleFixed(0, 0, 0);
+    if (motionModelID == GEODESIC_CAMPOSE) {
+      epipoleFixed = m_epipoleList->findEpipoleFixed(curPOC, refPOC);
+    } else if (motionModelID != TANGENTIAL && motionModelID != ROTATIONAL) {
+      epipoleFixed[motionModelID - GEODESIC_X] = 1 << EPIPOLE_PRECISION_FIXED;
+    }
+    m_fixedPointReprojection.reprojectSubblocks(position, size, subblockSize, compID, chromaFormat, motionVector, motionModelID,
+                                                epipoleFixed, dst);
+    if (useCache) {
+      reprojectionCache.insert(cacheKey, dst);
+    }
+    return;
+  }
+
+  // Block in the sphere table. Subblocks of all components lie on the 4x4 luma grid.
+  CHECK(position.x % subblockSize.width != 0 || position.y % subblockSize.height != 0, "Block is not aligned to the subblock grid.");
+  const Position tablePosition(position.x / subblockSize.width, position.y / subblockSize.height);
+  const Size tableSize(cols, rows);
+
   // Motion modeling
+  // The luma blocks of MPA are modelled from the frame-wide conversions of its cache, all other blocks on their own.
+  // The frame-wide conversions of the tables are used where they are identical to those of the block.
   ArrayXXTCoordPtrPair cart2DProjMoved;
   Array2TCoord blockCenter = Array2TCoord(position.x, position.y) + (Array2TCoord(size.width, size.height) - 1) / TCoord(2);
-  if (isLuma(compID) && (motionModelID == MPA_FRONT_BACK || motionModelID == MPA_LEFT_RIGHT || motionModelID == MPA_TOP_BOTTOM)) {
-    // Use cached motion modeling method for MPA on luma channel
-    cart2DProjMoved = static_cast<MotionPlaneAdaptiveMotionModel*>(m_motionModels[motionModelID])->modelMotionCached(Position(position.x/subblockSize.width, position.y/subblockSize.height),
-                                                                                                                     Size(size.width/subblockSize.width, size.height/subblockSize.height),
-                                                                                                                     {mvX, mvY}, blockCenter);
-  } else if (isLuma(compID) && (motionModelID == GEODESIC_X || motionModelID == GEODESIC_Y || motionModelID == GEODESIC_Z || motionModelID == GEODESIC_CAMPOSE)) {
-    // Use cached motion modeling method for GED on luma channel
-    cart2DProjMoved = static_cast<GeodesicMotionModel*>(m_motionModels[motionModelID])->modelMotionCached(Position(position.x/subblockSize.width, position.y/subblockSize.height),
-                                                                                                          Size(size.width/subblockSize.width, size.height/subblockSize.height),
-                                                                                                          {mvX, mvY}, blockCenter);
+  const bool isBlockExact = m_sphereTable.isBlockExact(tablePosition, tableSize);
+  if (motionModelID == MPA_FRONT_BACK || motionModelID == MPA_LEFT_RIGHT || motionModelID == MPA_TOP_BOTTOM) {
+    // Use cached motion modeling method for MPA
+    const MotionPlaneAdaptiveMotionModel *mpaModel = static_cast<const MotionPlaneAdaptiveMotionModel*>(m_motionModels[motionModelID]);
+    if (isLuma(compID) || isBlockExact) {
+      cart2DProjMoved = mpaModel->modelMotionCached(tablePosition, tableSize, {mvX, mvY}, blockCenter, context.blockCache[motionModelID]);
+    } else {
+      cart2DProjMoved = mpaModel->modelMotion(m_sphereTable.cart2D(tablePosition, tableSize), {mvX, mvY}, blockCenter);
+    }
+  } else if (motionModelID == GEODESIC_X || motionModelID == GEODESIC_Y || motionModelID == GEODESIC_Z || motionModelID == GEODESIC_CAMPOSE) {
+    // Use cached motion modeling method for GED
+    // Use the rotated sphere table of the fixed epipole, or of the camera pose epipole cached per context
+    const GeodesicMotionModel *geodesicModel = static_cast<const GeodesicMotionModel*>(m_motionModels[motionModelID]);
+    const GeodesicMotionModel::Rotation &rotation = geodesicRotation(motionModelID, epipole, context);
+    if (isChroma(compID) && mvX == 0 && mvY == 0) {
+      // No motion, as in modelMotion()
+      cart2DProjMoved = m_sphereTable.cart2D(tablePosition, tableSize);
+    } else if (isBlockExact) {
+      const GeodesicMotionModel::RotatedSphereTable &rotatedSphereTable = motionModelID == GEODESIC_CAMPOSE
+                                                                          ? context.cameraPoseTables.get(*geodesicModel, rotation)
+                                                                          : geodesicModel->getRotatedSphereTable();
+      cart2DProjMoved = geodesicModel->modelMotionCached(tablePosition, tableSize, {mvX, mvY}, blockCenter, rotation, rotatedSphereTable);
+    } else {
+      cart2DProjMoved = geodesicModel->modelMotionOnRotatedSphere(geodesicModel->toRotatedSphere(m_sphereTable.cart2D(tablePosition, tableSize), rotation),
+                                                                  {mvX, mvY}, blockCenter, rotation);
+    }
+  } else if (isBlockExact) {
+    cart2DProjMoved = m_motionModels[motionModelID]->modelMotionFromTable(m_sphereTable, tablePosition, tableSize, {mvX, mvY}, blockCenter);
   } else {
-    cart2DProjMoved = m_motionModels[motionModelID]->modelMotion({cart2DProjX, cart2DProjY}, {mvX, mvY}, blockCenter);
+    cart2DProjMoved = m_motionModels[motionModelID]->modelMotion(m_sphereTable.cart2D(tablePosition, tableSize), {mvX, mvY}, blockCenter);
   }
 
-  ArrayXXTCoordPtr cart2DProjMovedX = std::get<0>(cart2DProjMoved);
-  ArrayXXTCoordPtr cart2DProjMovedY = std::get<1>(cart2DProjMoved);
+  // Unmoved subblock origins on the luma scale (identical to the subblock grid) for the NaN fallback
+  const TCoord startX = TCoord(position.x) * scaleX + m_offset4x4;
+  const TCoord startY = TCoord(position.y) * scaleY + m_offset4x4;
+  const TCoord stepX = TCoord(subblockSize.width) * scaleX;
+  const TCoord stepY = TCoord(subblockSize.height) * scaleY;
+  const TCoord precisionHor = TCoord(1 << shiftHor);
+  const TCoord precisionVer = TCoord(1 << shiftVer);
+  const int fracMaskHor = (1 << shiftHor) - 1;
+  const int fracMaskVer = (1 << shiftVer) - 1;
 
-  // Perform no motion in case of NaN.
-  ArrayXXBool isNaN = cart2DProjMovedX->isNaN() || cart2DProjMovedY->isNaN();
-  cart2DProjMovedX = std::make_shared<ArrayXXTCoord>(isNaN.select(*cart2DProjX, *cart2DProjMovedX) - m_offset4x4);
-  cart2DProjMovedY = std::make_shared<ArrayXXTCoord>(isNaN.select(*cart2DProjY, *cart2DProjMovedY) - m_offset4x4);
+  // Fallback, offset removal, chroma rescaling, rounding and integer/fractional split in a single pass
+  const TCoord *cart2DProjMovedX = std::get<0>(cart2DProjMoved)->data();
+  const TCoord *cart2DProjMovedY = std::get<1>(cart2DProjMoved)->data();
+  for (int col = 0; col < cols; ++col) {
+    for (int row = 0; row < rows; ++row) {
+      const int i = dst.idx(row, col);
+      TCoord x = cart2DProjMovedX[i];
+      TCoord y = cart2DProjMovedY[i];
+      // Perform no motion in case of NaN.
+      if (std::isnan(x) || std::isnan(y)) {
+        x = startX + TCoord(col) * stepX;
+        y = startY + TCoord(row) * stepY;
+      }
+      x = x - m_offset4x4;
+      y = y - m_offset4x4;
+      // Rescale to chroma if necessary
+      if (isChroma(compID)) {
+        x = x / scaleX;
+        y = y / scaleY;
+      }
+      const int fixedX = int(std::round(x * precisionHor));
+      const int fixedY = int(std::round(y * precisionVer));
+      dst.xPos[i] = fixedX >> shiftHor;
+      dst.yPos[i] = fixedY >> shiftVer;
+      dst.xFrac[i] = fixedX & fracMaskHor;
+      dst.yFrac[i] = fixedY & fracMaskVer;
+    }
+  }
+  if (useCache) {
+    reprojectionCache.insert(cacheKey, dst);
+  }
+}
 
-  // Rescale to chroma if necessary
-  if (isChroma(compID)) {
-    *cart2DProjMovedX = *cart2DProjMovedX / scaleX;
-    *cart2DProjMovedY = *cart2DProjMovedY / scaleY;
+const GeodesicMotionModel::Rotation& MVReprojection::geodesicRotation(MotionModelID motionModelID, const Array3TCoord &epipole,
+                                                                     MVReprojectionContext &context) const
+{
+  if (motionModelID == GEODESIC_CAMPOSE) {
+    context.cameraPoseRotation.setEpipole(epipole);
+    return context.cameraPoseRotation;
   }
+  return static_cast<const GeodesicMotionModel*>(m_motionModels[motionModelID])->getRotation();
+}
 
-  // Return as fixed precision array
-  ArrayXXFixedPtr cart2DProjMovedFixedX = std::make_shared<ArrayXXFixed>((*cart2DProjMovedX * (1 << shiftHor)).round().cast<int>());
-  ArrayXXFixedPtr cart2DProjMovedFixedY = std::make_shared<ArrayXXFixed>((*cart2DProjMovedY * (1 << shiftVer)).round().cast<int>());
-  return {cart2DProjMovedFixedX, cart2DProjMovedFixedY};
+void MVReprojectionContext::enableReprojectionCache()
+{
+  // 16k entries sharing subblock positions worth 256 CTU-sized blocks (4 MB)
+  reprojectionCache.init(1 << 14, 256 * SubblockPositions::MAX_NUM_SUBBLOCKS);
+}
+
+void MVReprojectionContext::enableConversionCache()
+{
+  // 16k converted motion vectors (1.5 MB)
+  conversionCache.init(1 << 14);
 }
 
 Mv MVReprojection::motionVectorInDesiredMotionModel(const Position &position, const Mv &motionVectorOrig,
@@ -170,7 +289,8 @@ Mv MVReprojection::motionVectorInDesiredMotionModel(const Position &position, co
                                                     int shiftHor, int shiftVer,
                                                     int curPOCOrig, int refPOCOrig, int curPOCDesired, int refPOCDesired,
                                                     const Position &candidateBlockPos, const Size &candidateBlockSize,
-                                                    const Position &currentBlockPos, const Size &currentBlockSize) const {
+                                                    const Position &currentBlockPos, const Size &currentBlockSize,
+                                                    MVReprojectionContext &context) const {
   if (motionVectorOrig.hor == 0 && motionVectorOrig.ver == 0) {
     return {0, 0};
   }
@@ -182,28 +302,62 @@ Mv MVReprojection::motionVectorInDesiredMotionModel(const Position &position, co
     }
   }
 
+  g_mmProfiler.add(motionModelIDDesired, MMProfiler::MVP_CONVERSIONS);
+  MMProfiler::ScopedTimer timer(motionModelIDDesired, MMProfiler::MVP_CONVERSION_TIME);
+  MvConversionCache::Key cacheKey = { position.x, position.y, motionVectorOrig.hor, motionVectorOrig.ver,
+                                      int(motionModelIDOrig), int(motionModelIDDesired), shiftHor, shiftVer,
+                                      curPOCOrig, refPOCOrig, curPOCDesired, refPOCDesired,
+                                      candidateBlockPos.x, candidateBlockPos.y, int(candidateBlockSize.width), int(candidateBlockSize.height),
+                                      currentBlockPos.x, currentBlockPos.y, int(currentBlockSize.width), int(currentBlockSize.height) };
+  MvConversionCache &conversionCache = context.conversionCache;
+  const bool useCache = conversionCache.isInitialized();
+  Mv motionVectorDesired;
+  if (useCache && conversionCache.lookup(cacheKey, motionVectorDesired)) {
+    g_mmProfiler.add(motionModelIDDesired, MMProfiler::MVP_CONVERSION_CACHE_HITS);
+    return motionVectorDesired;
+  }
+  motionVectorDesired = convertMotionVector(position, motionVectorOrig, motionModelIDOrig, motionModelIDDesired, shiftHor, shiftVer,
+                                            curPOCOrig, refPOCOrig, curPOCDesired, refPOCDesired,
+                                            candidateBlockPos, candidateBlockSize, currentBlockPos, currentBlockSize);
+  if (useCache) {
+    conversionCache.insert(cacheKey, motionVectorDesired);
+  }
+  return motionVectorDesired;
+}
+
+Mv MVReprojection::convertMotionVector(const Position &position, const Mv &motionVectorOrig,
+                                       MotionModelID motionModelIDOrig, MotionModelID motionModelIDDesired,
+                                       int shiftHor, int shiftVer,
+                                       int curPOCOrig, int refPOCOrig, int curPOCDesired, int refPOCDesired,
+                                       const Position &candidateBlockPos, const Size &candidateBlockSize,
+                                       const Position &currentBlockPos, const Size &currentBlockSize) const
+{
   // Original motion vector as floating point
   const TCoord mvX = TCoord(motionVectorOrig.hor >> shiftHor) + TCoord(motionVectorOrig.hor & ((1 << shiftHor) - 1))/TCoord(1 << shiftHor);
   const TCoord mvY = TCoord(motionVectorOrig.ver >> shiftVer) + TCoord(motionVectorOrig.ver & ((1 << shiftVer) - 1))/TCoord(1 << shiftVer);
 
   // Motion modeling with original motion model
   Array2TCoord blockCenterCandidate = Array2TCoord(candidateBlockPos.x, candidateBlockPos.y) + (Array2TCoord(candidateBlockSize.width, candidateBlockSize.height) - 1) / TCoord(2);
-  ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(Eigen::Index(1), Eigen::Index(1));
-  ArrayXXTCoordPtr cart2DY = std::make_shared<ArrayXXTCoord>(Eigen::Index(1), Eigen::Index(1));
-  cart2DX->coeffRef(0) = TCoord(position.x);
-  cart2DY->coeffRef(0) = TCoord(position.y);
+  const Array2TCoord cart2D(TCoord(position.x), TCoord(position.y));
+  // The camera pose epipole depends on the pictures, its rotation is computed locally to keep this method free of side effects
+  GeodesicMotionModel::Rotation cameraPoseRotation;
+  Array2TCoord shiftedPosition;
   if (motionModelIDOrig == GEODESIC_CAMPOSE) {
-    static_cast<GeodesicMotionModel*>(m_motionModels[motionModelIDOrig])->setEpipole(m_epipoleList->findEpipole(curPOCOrig, refPOCOrig));
+    cameraPoseRotation.setEpipole(m_epipoleList->findEpipole(curPOCOrig, refPOCOrig));
+    shiftedPosition = static_cast<const GeodesicMotionModel*>(m_motionModels[motionModelIDOrig])->modelPointMotion(cart2D, {mvX, mvY}, blockCenterCandidate, cameraPoseRotation);
+  } else {
+    shiftedPosition = m_motionModels[motionModelIDOrig]->modelPointMotion(cart2D, {mvX, mvY}, blockCenterCandidate);
   }
-  const ArrayXXTCoordPtrPair cart2DProjMovedOrig = m_motionModels[motionModelIDOrig]->modelMotion({cart2DX, cart2DY}, {mvX, mvY}, blockCenterCandidate);
 
   // Get equivalent motion vector with desired motion model
-  const Array2TCoord shiftedPosition = Array2TCoord(std::get<0>(cart2DProjMovedOrig)->coeff(0), std::get<1>(cart2DProjMovedOrig)->coeff(0));
+  Array2TCoord blockCenterCurrent = Array2TCoord(currentBlockPos.x, currentBlockPos.y) + (Array2TCoord(currentBlockSize.width, currentBlockSize.height) - 1) / TCoord(2);
+  Array2TCoord mvDesired;
   if (motionModelIDDesired == GEODESIC_CAMPOSE) {
-    static_cast<GeodesicMotionModel*>(m_motionModels[motionModelIDDesired])->setEpipole(m_epipoleList->findEpipole(curPOCDesired, refPOCDesired));
+    cameraPoseRotation.setEpipole(m_epipoleList->findEpipole(curPOCDesired, refPOCDesired));
+    mvDesired = static_cast<const GeodesicMotionModel*>(m_motionModels[motionModelIDDesired])->motionVectorForEquivalentPixelShiftAt(position, shiftedPosition, blockCenterCurrent, cameraPoseRotation);
+  } else {
+    mvDesired = m_motionModels[motionModelIDDesired]->motionVectorForEquivalentPixelShiftAt(position, shiftedPosition, blockCenterCurrent);
   }
-  Array2TCoord blockCenterCurrent = Array2TCoord(currentBlockPos.x, currentBlockPos.y) + (Array2TCoord(currentBlockSize.width, currentBlockSize.height) - 1) / TCoord(2);
-  const Array2TCoord mvDesired = m_motionModels[motionModelIDDesired]->motionVectorForEquivalentPixelShiftAt(position, shiftedPosition, blockCenterCurrent);
 
   // Return zero mv if invalid
   if (std::isnan(mvDesired.x()) || std::isnan(mvDesired.y())) {
@@ -215,3 +369,21 @@ Mv MVReprojection::motionVectorInDesiredMotionModel(const Position &position, co
   int mvYFixed = static_cast<int>(std::round(mvDesired.y() * TCoord(1 << shiftVer)));
   return {mvXFixed, mvYFixed};
 }
+
+void MVReprojection::motionVectorsInDesiredMotionModel(MvConversion *conversions, int numConversions, MotionModelID motionModelIDDesired,
+                                                       int shiftHor, int shiftVer,
+                                                       const Position &currentBlockPos, const Size &currentBlockSize,
+                                                       MVReprojectionContext &context) const
+{
+  for (int i = 0; i < numConversions; i++) {
+    MvConversion &conversion = conversions[i];
+    if (!conversion.valid) {
+      continue;
+    }
+    conversion.mv = motionVectorInDesiredMotionModel(conversion.position, conversion.mv, conversion.motionModelID, motionModelIDDesired,
+                                                     shiftHor, shiftVer, conversion.curPOCOrig, conversion.refPOCOrig,
+                                                     conversion.curPOCDesired, conversion.refPOCDesired,
+                                                     conversion.blockPos, conversion.blockSize, currentBlockPos, currentBlockSize,
+                                                     context);
+  }
+}
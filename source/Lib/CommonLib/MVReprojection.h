@@ -11,15 +11,74 @@
 #include "Picture.h"
 #include "MotionModels/models.h"
 #include "EpipoleList.h"
+#include "SphereTable.h"
+#include "ReprojectionCache.h"
+#include "MvConversionCache.h"
+#include "FixedPointReprojection.h"
 
 #include <iomanip>
 #include <set>
 
+/// Moved subblock origins split into integer sample positions and fractional phases.
+/// Entries are stored column-major (index = col * rows + row) with capacity for one CTU of 4x4 luma subblocks.
+struct SubblockPositions
+{
+  static constexpr int MAX_NUM_SUBBLOCKS = (MAX_CU_SIZE >> 2) * (MAX_CU_SIZE >> 2);
+
+  int rows{0};
+  int cols{0};
+  int xPos[MAX_NUM_SUBBLOCKS];  /**< Integer horizontal sample positions */
+  int yPos[MAX_NUM_SUBBLOCKS];  /**< Integer vertical sample positions */
+  int xFrac[MAX_NUM_SUBBLOCKS]; /**< Horizontal fractional phases */
+  int yFrac[MAX_NUM_SUBBLOCKS]; /**< Vertical fractional phases */
+
+  int idx(int row, int col) const { return col * rows + row; }
+};
+
+/// Motion vector of a candidate to be converted by MVReprojection::motionVectorsInDesiredMotionModel()
+struct MvConversion
+{
+  bool valid{false};  /**< Entries that are not valid are skipped */
+  Position position;  /**< Position at which the motion is matched */
+  Mv mv;  /**< Original motion vector, replaced by the converted one */
+  MotionModelID motionModelID{CLASSIC};  /**< Original motion model */
+  int curPOCOrig{0};
+  int refPOCOrig{0};
+  int curPOCDesired{0};
+  int refPOCDesired{0};
+  Position blockPos;  /**< Position of the candidate block */
+  Size blockSize;  /**< Size of the candidate block */
+};
+
+/// Per-thread mutable state of the motion vector reprojection. MVReprojection and its motion models only hold tables
+/// that are immutable after init(), apart from the memo of converted motion vectors used by the candidate list
+/// construction; everything that changes from call to call lives here, so that threads reprojecting with their own
+/// context do not interfere.
+class MVReprojectionContext
+{
+public:
+  GeodesicMotionModel::Rotation cameraPoseRotation;  /**< Rotation of GEODESIC_CAMPOSE for the epipole of the last call */
+  GeodesicMotionModel::RotatedSphereTableCache cameraPoseTables;  /**< Rotated sphere tables of the recent GEODESIC_CAMPOSE epipoles */
+  MotionModelBlockCache blockCache[NUM_MODELS];  /**< Coordinates of the last block per motion model (MPA) */
+  ReprojectionCache reprojectionCache;  /**< Reprojected subblock positions of the current CTU (encoder only) */
+  MvConversionCache conversionCache;  /**< Results of motionVectorInDesiredMotionModel() of the current picture, with its own hit counter */
+
+  /** @brief Cache the results of the fused subblock reprojection. Used by the encoder, whose motion search evaluates the same block, model and motion vector repeatedly. */
+  void enableReprojectionCache();
+  /** @brief Drop all cached reprojection results, e.g. at the start of a CTU. */
+  void resetReprojectionCache() { if (reprojectionCache.isInitialized()) reprojectionCache.clear(); }
+  /** @brief Memoize the motion vector conversions of the candidate list construction. */
+  void enableConversionCache();
+  /** @brief Drop the memoized conversions. Called at the start of every picture. */
+  void resetConversionCache() { if (conversionCache.isInitialized()) conversionCache.clear(); }
+  void printConversionCacheStatistics() const { conversionCache.printStatistics(); }
+};
+
 class MVReprojection {
 
 public:
 
-  MVReprojection(): m_projection(nullptr), m_offset4x4(0) {};
+  MVReprojection(): m_projection(nullptr), m_epipoleList(nullptr), m_initialized(false), m_offset4x4(0) {};
   ~MVReprojection() {
     for (auto & motionModel : m_motionModels) {
       if(motionModel) {
@@ -31,10 +90,13 @@ public:
 
   void init(const Projection *projection, const Size &resolution, const SPS *sps, const EpipoleList* epipoleList);
   bool isInitialized() const { return m_initialized; }
-  MotionModel* getMotionModel(MotionModelID id) { return m_motionModels[id]; }
+  const Size& getResolution() const { return m_resolution; }
+  const MotionModel* getMotionModel(MotionModelID id) const { return m_motionModels[id]; }
 
 protected:
   void fillCache();
+  /** @brief Epipole rotation of a geodesic motion model. For GEODESIC_CAMPOSE it is updated to the given epipole in the context. */
+  const GeodesicMotionModel::Rotation& geodesicRotation(MotionModelID motionModelID, const Array3TCoord &epipole, MVReprojectionContext &context) const;
 
 public:
   static Size subblockSize(ComponentID compID, ChromaFormat chromaFormat);
@@ -49,20 +111,52 @@ public:
    * @param chromaFormat Chroma format (e.g., 400, 422, 420, 444)
    * @param curPOC Picture order count of current frame for epipole selection
    * @param refPOC Picture order count of reference frame for epipole selection
+   * @param context Per-thread reprojection state
    * @return Moved subblock origin positions with horizontal and vertical precision according to componentScaleX/Y for component id and chroma format
    */
   ArrayXXFixedPtrPair reprojectMotionVectorSubblocks(const Position &position, const Size &size,
                                                      const Mv &motionVector,
                                                      MotionModelID motionModelID,
                                                      ComponentID compID, ChromaFormat chromaFormat,
-                                                     int curPOC, int refPOC);
+                                                     int curPOC, int refPOC,
+                                                     MVReprojectionContext &context) const;
+
+  /** @brief Reproject the motion vector on subblocks and write integer positions and fractional phases to dst.
+   *
+   * Fused variant of reprojectMotionVectorSubblocks() without intermediate fixed precision arrays. The fractional
+   * phases have precision according to componentScaleX/Y for component id and chroma format.
+   */
+  void reprojectMotionVectorSubblocks(const Position &position, const Size &size,
+                                      const Mv &motionVector,
+                                      MotionModelID motionModelID,
+                                      ComponentID compID, ChromaFormat chromaFormat,
+                                      int curPOC, int refPOC,
+                                      SubblockPositions &dst,
+                                      MVReprojectionContext &context) const;
 
   /** @brief Find the motion vector in the desired motion model that leads to the same motion vector at position as the original motion vector in the original motion model. */
   Mv motionVectorInDesiredMotionModel(const Position &position, const Mv &motionVectorOrig, MotionModelID motionModelIDOrig,
                                       MotionModelID motionModelIDDesired, int shiftHor, int shiftVer,
                                       int curPOCOrig, int refPOCOrig, int curPOCDesired, int refPOCDesired,
                                       const Position &candidateBlockPos, const Size &candidateBlockSize,
-                                      const Position &currentBlockPos, const Size &currentBlockSize) const;
+                                      const Position &currentBlockPos, const Size &currentBlockSize,
+                                      MVReprojectionContext &context) const;
+
+  /** @brief Convert the motion vectors of several candidates of the current block to the desired motion model in place.
+   *
+   * Equivalent to calling motionVectorInDesiredMotionModel() for each valid entry.
+   */
+  void motionVectorsInDesiredMotionModel(MvConversion *conversions, int numConversions, MotionModelID motionModelIDDesired,
+                                         int shiftHor, int shiftVer,
+                                         const Position &currentBlockPos, const Size &currentBlockSize,
+                                         MVReprojectionContext &context) const;
+
+protected:
+  Mv convertMotionVector(const Position &position, const Mv &motionVectorOrig, MotionModelID motionModelIDOrig,
+                         MotionModelID motionModelIDDesired, int shiftHor, int shiftVer,
+                         int curPOCOrig, int refPOCOrig, int curPOCDesired, int refPOCDesired,
+                         const Position &candidateBlockPos, const Size &candidateBlockSize,
+                         const Position &currentBlockPos, const Size &currentBlockSize) const;
 
 protected:
   const Projection *m_projection;
@@ -72,10 +166,7 @@ protected:
 
   Size m_resolution;
   TCoord m_offset4x4; /**< Coordinate offset for reprojection within 4x4 subblocks (0.0-3.0) */
-  ArrayXXTCoordPtr m_cart2DProj[2];  /**< Cache for cartesian coordinates of pixels in original image */
-
-  /** Encoder luma caching */
-  Position m_lastPosition;  /**< Last cached block position */
-  Size m_lastSize;  /**< Last cached block size */
-  ArrayXXTCoordPtr m_lastCart2DProj[2];  /**< Cartesian coordinates in original image of last block with position and size */
+  SphereTable m_sphereTable;  /**< Subblock origins of the picture in projection and on the sphere, shared by all motion models */
+  /** Integer-only subblock reprojection of the tangential, rotational and geodesic models, initialized if the SPS enables it */
+  FixedPointReprojection m_fixedPointReprojection;
 };
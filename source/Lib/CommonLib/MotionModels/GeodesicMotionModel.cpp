@@ -6,19 +6,55 @@
 
 #include <cmath>
 
-void GeodesicMotionModel::fillCache(const ArrayXXTCoordPtrPair &cart2DProj)
+void GeodesicMotionModel::fillCache(const SphereTable *sphereTable)
 {
-  m_cachedCart2DProj = cart2DProj;
+  m_sphereTable = sphereTable;
+  // The default epipole is fixed for GEODESIC_X/Y/Z and unset for GEODESIC_CAMPOSE
+  if (!m_rotation.epipole.isNaN().any()) {
+    fillRotatedSphereTable(m_rotation, m_rotatedSphereTable);
+  }
+}
+
+void GeodesicMotionModel::fillRotatedSphereTable(const Rotation &rotation, RotatedSphereTable &table) const
+{
+  const ArrayXXTCoordPtrTriple spherical = rotateToSpherical(m_sphereTable->cart3D(), rotation);
+  table.epipole = rotation.epipole;
+  table.spherical[0] = std::get<0>(spherical);
+  table.spherical[1] = std::get<1>(spherical);
+  table.spherical[2] = std::get<2>(spherical);
+}
+
+ArrayXXTCoordPtrTriple GeodesicMotionModel::RotatedSphereTable::block(const Position &position, const Size &size) const
+{
+  CHECK(position.x + size.width > spherical[0]->cols() || position.y + size.height > spherical[0]->rows(), "Block exceeds the rotated sphere table.");
+  ArrayXXTCoordPtr planes[3];
+  for (int i = 0; i < 3; i++) {
+    planes[i] = std::make_shared<ArrayXXTCoord>(spherical[i]->block(position.y, position.x, size.height, size.width));
+  }
+  return ArrayXXTCoordPtrTriple(planes[0], planes[1], planes[2]);
+}
+
+const GeodesicMotionModel::RotatedSphereTable& GeodesicMotionModel::RotatedSphereTableCache::get(const GeodesicMotionModel &model, const Rotation &rotation)
+{
+  for (const RotatedSphereTable &table : tables) {
+    if (table.isFilled() && (table.epipole == rotation.epipole).all()) {
+      return table;
+    }
+  }
+  RotatedSphereTable &table = tables[next];
+  next = (next + 1) % NUM_TABLES;
+  model.fillRotatedSphereTable(rotation, table);
+  return table;
 }
 
-void GeodesicMotionModel::setEpipole(const Array3TCoord &epipole)
+void GeodesicMotionModel::Rotation::setEpipole(const Array3TCoord &epipole)
 {
   // Avoid recalculating the rotation matrix if not necessary.
-  if ((epipole == m_epipole).all()) {
+  if ((epipole == this->epipole).all()) {
     return;
   }
 
-  m_epipole = epipole;
+  this->epipole = epipole;
 
   // Calculate rotation matrix to rotate default north pole (0, 0, 1) to desired north pole using
   // rodrigues rotation formula
@@ -27,11 +63,13 @@ void GeodesicMotionModel::setEpipole(const Array3TCoord &epipole)
   const auto cart3DCross = Array3TCoord(-polarAxisNormalized.y(), polarAxisNormalized.x(), 0);
   const auto s = std::sqrt(cart3DCross.x() * cart3DCross.x() + cart3DCross.y() * cart3DCross.y() + cart3DCross.z() * cart3DCross.z());
   if (s == 0) {  // epipole is parallel to current north pole.
-    m_rotationMatrix = Eigen::Matrix<TCoord, 3, 3>::Identity();
+    matrix = Eigen::Matrix<TCoord, 3, 3>::Identity();
     if (polarAxisNormalized.z() < 0) {
-      m_rotationMatrix(2, 2) = -1;
+      matrix(2, 2) = -1;
     }
+    isIdentity = polarAxisNormalized.z() > 0;
   } else {
+    isIdentity = false;
     const auto c = std::max(TCoord(-1), std::min(TCoord(1), polarAxisNormalized.z()));
     auto cart3DCrossSkew = Eigen::Matrix<TCoord, 3, 3>::Zero().eval();
     cart3DCrossSkew(0, 1) = -cart3DCross.z();
@@ -40,65 +78,63 @@ void GeodesicMotionModel::setEpipole(const Array3TCoord &epipole)
     cart3DCrossSkew(1, 2) = -cart3DCross.x();
     cart3DCrossSkew(2, 0) = -cart3DCross.y();
     cart3DCrossSkew(2, 1) = cart3DCross.x();
-    m_rotationMatrix = Eigen::Matrix<TCoord, 3, 3>::Identity() + cart3DCrossSkew + (cart3DCrossSkew*cart3DCrossSkew) * ((1-c) / (s*s));
-    m_rotationMatrix.transposeInPlace();
+    matrix = Eigen::Matrix<TCoord, 3, 3>::Identity() + cart3DCrossSkew + (cart3DCrossSkew*cart3DCrossSkew) * ((1-c) / (s*s));
+    matrix.transposeInPlace();
   }
 }
 
-ArrayXXTCoordPtrTriple GeodesicMotionModel::toRotatedSphere(const ArrayXXTCoordPtrPair &cart2D) const
+ArrayXXTCoordPtrTriple GeodesicMotionModel::toRotatedSphere(const ArrayXXTCoordPtrPair &cart2D, const Rotation &rotation) const
 {
   // To sphere
-  const auto cart3D = m_projection->toSphere(cart2D);
+  return rotateToSpherical(m_projection->toSphere(cart2D), rotation);
+}
 
+ArrayXXTCoordPtrTriple GeodesicMotionModel::rotateToSpherical(const ArrayXXTCoordPtrTriple &cart3D, const Rotation &rotation) const
+{
+  if (rotation.isIdentity) {
+    return CoordinateConversion::cartesianToSpherical(cart3D);
+  }
+
+  // Rotation to obtain desired epipole and spherical coordinates in a single pass
   const auto rows = std::get<0>(cart3D)->rows();
   const auto cols = std::get<0>(cart3D)->cols();
-  const auto N = rows * cols;
-
-  // Rotation to obtain desired epipole
-  // - Flatten and stack
-  const auto cart3DXFlat = Eigen::Map<ArrayXTCoord>(std::get<0>(cart3D)->data(), N);
-  const auto cart3DYFlat = Eigen::Map<ArrayXTCoord>(std::get<1>(cart3D)->data(), N);
-  const auto cart3DZFlat = Eigen::Map<ArrayXTCoord>(std::get<2>(cart3D)->data(), N);
-  Eigen::Matrix<TCoord, 3, Eigen::Dynamic> cart3DFlatStacked(Eigen::Index(3), N);
-  cart3DFlatStacked << cart3DXFlat, cart3DYFlat, cart3DZFlat;
-
-  // - Apply rotation matrix
-  const auto cart3DRotFlatStacked = m_rotationMatrix * cart3DFlatStacked;
-
-  // Unstack and reshape
-  const auto cart3DXRot = std::make_shared<ArrayXXTCoord>(Eigen::Map<const ArrayXXTCoord>(cart3DRotFlatStacked.row(0).eval().data(), rows, cols));
-  const auto cart3DYRot = std::make_shared<ArrayXXTCoord>(Eigen::Map<const ArrayXXTCoord>(cart3DRotFlatStacked.row(1).eval().data(), rows, cols));
-  const auto cart3DZRot = std::make_shared<ArrayXXTCoord>(Eigen::Map<const ArrayXXTCoord>(cart3DRotFlatStacked.row(2).eval().data(), rows, cols));
-
-  // To spherical coordinates with desired epipole
-  return CoordinateConversion::cartesianToSpherical({cart3DXRot, cart3DYRot, cart3DZRot});
+  const auto sphericalR = std::make_shared<ArrayXXTCoord>(rows, cols);
+  const auto sphericalTheta = std::make_shared<ArrayXXTCoord>(rows, cols);
+  const auto sphericalPhi = std::make_shared<ArrayXXTCoord>(rows, cols);
+  g_coordOP.rotatedCartesianToSpherical(rotation.matrix.data(), std::get<0>(cart3D)->data(), std::get<1>(cart3D)->data(), std::get<2>(cart3D)->data(),
+                                        sphericalR->data(), sphericalTheta->data(), sphericalPhi->data(), int(rows * cols));
+  return {sphericalR, sphericalTheta, sphericalPhi};
 }
 
-ArrayXXTCoordPtrPair GeodesicMotionModel::fromRotatedSphere(const ArrayXXTCoordPtrTriple &spherical) const
+ArrayXXTCoordPtrPair GeodesicMotionModel::fromRotatedSphere(const ArrayXXTCoordPtrTriple &spherical, const Rotation &rotation) const
 {
-  // Back to cartesian, undo rotation to desired epipole and project back to 2D image plane
-  const auto cart3DRotMoved = CoordinateConversion::sphericalToCartesian(spherical);
-
-  const auto rows = std::get<0>(cart3DRotMoved)->rows();
-  const auto cols = std::get<0>(cart3DRotMoved)->cols();
-  const auto N = rows * cols;
-
-  const auto cart3DXRotMovedFlat = Eigen::Map<ArrayXTCoord>(std::get<0>(cart3DRotMoved)->data(), N);
-  const auto cart3DYRotMovedFlat = Eigen::Map<ArrayXTCoord>(std::get<1>(cart3DRotMoved)->data(), N);
-  const auto cart3DZRotMovedFlat = Eigen::Map<ArrayXTCoord>(std::get<2>(cart3DRotMoved)->data(), N);
-  Eigen::Matrix<TCoord, 3, Eigen::Dynamic> cart3DRotMovedFlatStacked(Eigen::Index(3), N);
-  cart3DRotMovedFlatStacked << cart3DXRotMovedFlat, cart3DYRotMovedFlat, cart3DZRotMovedFlat;
-
-  const auto cart3DMovedFlatStacked = m_rotationMatrix.transpose() * cart3DRotMovedFlatStacked;
-
-  const auto cart3DXMoved = std::make_shared<ArrayXXTCoord>(Eigen::Map<const ArrayXXTCoord>(cart3DMovedFlatStacked.row(0).eval().data(), rows, cols));
-  const auto cart3DYMoved = std::make_shared<ArrayXXTCoord>(Eigen::Map<const ArrayXXTCoord>(cart3DMovedFlatStacked.row(1).eval().data(), rows, cols));
-  const auto cart3DZMoved = std::make_shared<ArrayXXTCoord>(Eigen::Map<const ArrayXXTCoord>(cart3DMovedFlatStacked.row(2).eval().data(), rows, cols));
+  if (rotation.isIdentity) {
+    return m_projection->fromSphere(CoordinateConversion::sphericalToCartesian(spherical));
+  }
 
+  // Back to cartesian and undo rotation to desired epipole in a single pass, then project back to 2D image plane
+  const auto rows = std::get<0>(spherical)->rows();
+  const auto cols = std::get<0>(spherical)->cols();
+  const Eigen::Matrix<TCoord, 3, 3> inverse = rotation.matrix.transpose();
+  const auto cart3DXMoved = std::make_shared<ArrayXXTCoord>(rows, cols);
+  const auto cart3DYMoved = std::make_shared<ArrayXXTCoord>(rows, cols);
+  const auto cart3DZMoved = std::make_shared<ArrayXXTCoord>(rows, cols);
+  g_coordOP.sphericalToRotatedCartesian(inverse.data(), std::get<0>(spherical)->data(), std::get<1>(spherical)->data(), std::get<2>(spherical)->data(),
+                                        cart3DXMoved->data(), cart3DYMoved->data(), cart3DZMoved->data(), int(rows * cols));
   return m_projection->fromSphere({cart3DXMoved, cart3DYMoved, cart3DZMoved});
 }
 
-ArrayXXTCoordPtr GeodesicMotionModel::modelGeodesicMotion(const ArrayXXTCoordPtr &theta, const TCoord motionVectorX, const Array2TCoord &blockCenter) const
+TCoord GeodesicMotionModel::modulationFactor(const TCoord motionVectorX, const Array2TCoord &blockCenter, const Rotation &rotation) const
+{
+  // Block center to rotated sphere to calculate parameter 'k' for geodesic motion modulation
+  const auto cart3DCenter = m_projection->toSphere(blockCenter);
+  const Array3TCoord cart3DCenterRot =
+    rotation.matrix * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
+  const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenterRot);
+  return std::sin(sphericalCenter.coeff(1) + m_angleResolution * motionVectorX) / std::sin(m_angleResolution * motionVectorX);
+}
+
+ArrayXXTCoordPtr GeodesicMotionModel::modelGeodesicMotion(const ArrayXXTCoordPtr &theta, const TCoord motionVectorX, const Array2TCoord &blockCenter, const Rotation &rotation) const
 {
   ArrayXXTCoordPtr thetaMoved;
   switch (m_flavor)
@@ -110,13 +146,7 @@ ArrayXXTCoordPtr GeodesicMotionModel::modelGeodesicMotion(const ArrayXXTCoordPtr
   }
   case VISHWANATH_MODULATED:
   {
-    // Block center to rotated sphere to calculate parameter 'k' for geodesic motion modulation
-    const auto cart3DCenter = m_projection->toSphere(blockCenter);
-    const Array3TCoord cart3DCenterRot =
-      m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
-    const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenterRot);
-    const TCoord k = std::sin(sphericalCenter.coeff(1) + m_angleResolution * motionVectorX)
-                     / std::sin(m_angleResolution * motionVectorX);
+    const TCoord k = modulationFactor(motionVectorX, blockCenter, rotation);
     const auto deltaTheta = (theta->sin() / (k - theta->cos())).atan().eval();
     thetaMoved = std::make_shared<ArrayXXTCoord>(*theta + deltaTheta);
     break;
@@ -126,65 +156,106 @@ ArrayXXTCoordPtr GeodesicMotionModel::modelGeodesicMotion(const ArrayXXTCoordPtr
 }
 
 ArrayXXTCoordPtrPair GeodesicMotionModel::modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  return modelMotion(cart2D, motionVector, blockCenter, m_rotation);
+}
+
+ArrayXXTCoordPtrPair GeodesicMotionModel::modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter, const Rotation &rotation) const
 {
   if (motionVector.x() == 0 && motionVector.y() == 0) {
     return cart2D;
   }
 
   // Block to rotated sphere
-  const auto spherical = toRotatedSphere(cart2D);
+  return modelMotionOnRotatedSphere(toRotatedSphere(cart2D, rotation), motionVector, blockCenter, rotation);
+}
 
-  // Model motion
-  *std::get<1>(spherical) = *modelGeodesicMotion(std::get<1>(spherical), motionVector.x(), blockCenter);
-  *std::get<2>(spherical) = *std::get<2>(spherical) + m_angleResolution * motionVector.y();
+ArrayXXTCoordPtrPair GeodesicMotionModel::modelMotionFromTable(const SphereTable &sphereTable, const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    return sphereTable.cart2D(position, size);
+  }
 
-  // Back to cartesian, undo rotation to desired epipole and project back to 2D image plane
-  return fromRotatedSphere(spherical);
+  // Block to rotated sphere
+  return modelMotionOnRotatedSphere(rotateToSpherical(sphereTable.cart3D(position, size), m_rotation), motionVector, blockCenter, m_rotation);
 }
 
-ArrayXXTCoordPtrPair GeodesicMotionModel::modelMotionCached(const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter)
+ArrayXXTCoordPtrPair GeodesicMotionModel::modelMotionCached(const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter,
+                                                            const Rotation &rotation, const RotatedSphereTable &table) const
 {
+  CHECK(!table.isFilled() || !(table.epipole == rotation.epipole).all(), "Rotated sphere table does not match the rotation.");
+
   // To motion plane
-  ArrayXXTCoordPtr sphericalR;
-  ArrayXXTCoordPtr sphericalTheta;
-  ArrayXXTCoordPtr sphericalPhi;
-  if (position == m_cachedPosition && size == m_cachedSize && (m_epipole == m_cachedEpipole).all()) {
-    sphericalR = m_cachedSpherical[0];
-    sphericalTheta = m_cachedSpherical[1];
-    sphericalPhi = m_cachedSpherical[2];
-  } else {
-    const auto cart2DProjX = std::make_shared<ArrayXXTCoord>(std::get<0>(m_cachedCart2DProj)->block(position.y, position.x, size.height, size.width));
-    const auto cart2DProjY = std::make_shared<ArrayXXTCoord>(std::get<1>(m_cachedCart2DProj)->block(position.y, position.x, size.height, size.width));
-    const auto spherical = toRotatedSphere({ cart2DProjX, cart2DProjY });
-    sphericalR = std::get<0>(spherical);
-    sphericalTheta = std::get<1>(spherical);
-    sphericalPhi = std::get<2>(spherical);
-    m_cachedPosition = position;
-    m_cachedSize = size;
-    m_cachedEpipole = m_epipole;
-    m_cachedSpherical[0] = sphericalR;
-    m_cachedSpherical[1] = sphericalTheta;
-    m_cachedSpherical[2] = sphericalPhi;
-  }
+  return modelMotionOnRotatedSphere(table.block(position, size), motionVector, blockCenter, rotation);
+}
 
+ArrayXXTCoordPtrPair GeodesicMotionModel::modelMotionOnRotatedSphere(const ArrayXXTCoordPtrTriple &spherical, const Array2TCoord &motionVector, const Array2TCoord &blockCenter,
+                                                                     const Rotation &rotation) const
+{
   // Model Motion
-  const ArrayXXTCoordPtr sphericalThetaMoved = modelGeodesicMotion(sphericalTheta, motionVector.x(), blockCenter);
-  const ArrayXXTCoordPtr sphericalPhiMoved = std::make_shared<ArrayXXTCoord>(*sphericalPhi + m_angleResolution * motionVector.y());
+  const ArrayXXTCoordPtr sphericalThetaMoved = modelGeodesicMotion(std::get<1>(spherical), motionVector.x(), blockCenter, rotation);
+  const ArrayXXTCoordPtr sphericalPhiMoved = std::make_shared<ArrayXXTCoord>(*std::get<2>(spherical) + m_angleResolution * motionVector.y());
 
   // Back to cartesian, undo rotation to desired epipole and project back to 2D image plane
-  return fromRotatedSphere({ sphericalR, sphericalThetaMoved, sphericalPhiMoved });
+  return fromRotatedSphere({ std::get<0>(spherical), sphericalThetaMoved, sphericalPhiMoved }, rotation);
+}
+
+Array2TCoord GeodesicMotionModel::modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  return modelPointMotion(cart2D, motionVector, blockCenter, m_rotation);
+}
+
+Array2TCoord GeodesicMotionModel::modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter, const Rotation &rotation) const
+{
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    return cart2D;
+  }
+
+  // Point to rotated sphere
+  const Array3TCoord cart3D = m_projection->pointToSphere(cart2D);
+  const Eigen::Matrix<TCoord, 3, 1> cart3DRot = rotation.matrix * Eigen::Matrix<TCoord, 3, 1>(cart3D.x(), cart3D.y(), cart3D.z());
+  TCoord sphericalR, sphericalTheta, sphericalPhi;
+  g_coordOP.cartesianToSpherical(cart3DRot.data(), cart3DRot.data() + 1, cart3DRot.data() + 2, &sphericalR, &sphericalTheta, &sphericalPhi, 1);
+
+  // Model motion, same operations as in modelGeodesicMotion() for a single element
+  TCoord sphericalThetaMoved = sphericalTheta;
+  switch (m_flavor)
+  {
+  case VISHWANATH_ORIGINAL:
+    sphericalThetaMoved = sphericalTheta + m_angleResolution * motionVector.x();
+    break;
+  case VISHWANATH_MODULATED:
+  {
+    const TCoord k = modulationFactor(motionVector.x(), blockCenter, rotation);
+    sphericalThetaMoved = sphericalTheta + std::atan(std::sin(sphericalTheta) / (k - std::cos(sphericalTheta)));
+    break;
+  }
+  }
+  const TCoord sphericalPhiMoved = sphericalPhi + m_angleResolution * motionVector.y();
+
+  // Back to cartesian, undo rotation to desired epipole and project back to 2D image plane
+  Eigen::Matrix<TCoord, 3, 1> cart3DRotMoved;
+  g_coordOP.sphericalToCartesian(&sphericalR, &sphericalThetaMoved, &sphericalPhiMoved, cart3DRotMoved.data(), cart3DRotMoved.data() + 1, cart3DRotMoved.data() + 2, 1);
+  const Eigen::Matrix<TCoord, 3, 1> cart3DMoved = rotation.matrix.transpose() * cart3DRotMoved;
+  return m_projection->pointFromSphere({cart3DMoved.x(), cart3DMoved.y(), cart3DMoved.z()});
 }
 
 Array2TCoord GeodesicMotionModel::motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const
+{
+  return motionVectorForEquivalentPixelShiftAt(position, shiftedPosition, blockCenter, m_rotation);
+}
+
+Array2TCoord GeodesicMotionModel::motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter,
+                                                                       const Rotation &rotation) const
 {
   // Original position to unit sphere with desired epipole
   const auto cart3D = m_projection->toSphere(Array2TCoord(position.x, position.y));
-  const Array3TCoord cart3DRot = m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3D.x(), cart3D.y(), cart3D.z());
+  const Array3TCoord cart3DRot = rotation.matrix * Eigen::Matrix<TCoord, 3, 1>(cart3D.x(), cart3D.y(), cart3D.z());
   const auto spherical = CoordinateConversion::cartesianToSpherical(cart3DRot);
 
   // Shifted position to unit sphere with desired epipole
   const auto cart3DMoved = m_projection->toSphere(shiftedPosition);
-  const Array3TCoord cart3DMovedRot = m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3DMoved.x(), cart3DMoved.y(), cart3DMoved.z());
+  const Array3TCoord cart3DMovedRot = rotation.matrix * Eigen::Matrix<TCoord, 3, 1>(cart3DMoved.x(), cart3DMoved.y(), cart3DMoved.z());
   const auto sphericalMoved = CoordinateConversion::cartesianToSpherical(cart3DMovedRot);
 
   switch (m_flavor)
@@ -201,7 +272,7 @@ Array2TCoord GeodesicMotionModel::motionVectorForEquivalentPixelShiftAt(const Po
   {
     // Current block center to unit sphere with desired epipole
     const auto cart3DCenter = m_projection->toSphere(blockCenter);
-    const Array3TCoord cart3DCenterRot = m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
+    const Array3TCoord cart3DCenterRot = rotation.matrix * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
     const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenterRot);
 
     // Calculate k and the resulting required delta theta of the block center for geodesic motion modulation
@@ -9,6 +9,7 @@
 #include "Unit.h"
 #include "MotionModel.h"
 
+#include <limits>
 #include <utility>
 
 
@@ -23,35 +24,83 @@ public:
     VISHWANATH_MODULATED
   };
 
+  /// Rotation of the default north pole (0, 0, 1) to the epipole
+  struct Rotation
+  {
+    Array3TCoord epipole{Array3TCoord::Constant(std::numeric_limits<TCoord>::quiet_NaN())};
+    Eigen::Matrix<TCoord, 3, 3> matrix{Eigen::Matrix<TCoord, 3, 3>::Identity()};
+    bool isIdentity{true};  /**< Epipole is the default north pole, the rotation can be skipped */
+
+    void setEpipole(const Array3TCoord &epipole);
+  };
+
+  /// Spherical coordinates of all subblock origins of the sphere table on the sphere rotated to an epipole
+  struct RotatedSphereTable
+  {
+    Array3TCoord epipole{Array3TCoord::Constant(std::numeric_limits<TCoord>::quiet_NaN())};
+    ArrayXXTCoordPtr spherical[3];  /**< Full-frame planes of radius, polar angle and azimuth */
+
+    bool isFilled() const { return spherical[0] != nullptr; }
+    /** Block copies, position and size in units of subblocks */
+    ArrayXXTCoordPtrTriple block(const Position &position, const Size &size) const;
+  };
+
+  /// Rotated sphere tables of the last few epipoles, e.g. the camera pose epipoles of the references of a picture
+  struct RotatedSphereTableCache
+  {
+    static constexpr int NUM_TABLES = 4;
+
+    RotatedSphereTable tables[NUM_TABLES];
+    int next{0};  /**< Table replaced next */
+
+    const RotatedSphereTable& get(const GeodesicMotionModel &model, const Rotation &rotation);
+  };
+
 public:
-  GeodesicMotionModel(): m_projection(nullptr), m_angleResolution(0), m_flavor(), m_epipole(), m_rotationMatrix() {}
+  GeodesicMotionModel(): m_projection(nullptr), m_angleResolution(0), m_flavor(), m_rotation(), m_sphereTable(nullptr) {}
   GeodesicMotionModel(const Projection* projection, TCoord angleResolution, Flavor flavor):
-    m_projection(projection),m_angleResolution(angleResolution), m_flavor(flavor), m_epipole(), m_rotationMatrix() {}
+    m_projection(projection),m_angleResolution(angleResolution), m_flavor(flavor), m_rotation(), m_sphereTable(nullptr) {}
 
+  /** Overrides of the motion model interface use the epipole set with setEpipole(). */
   ArrayXXTCoordPtrPair modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
-  ArrayXXTCoordPtrPair modelMotionCached(const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter);
+  ArrayXXTCoordPtrPair modelMotionFromTable(const SphereTable &sphereTable, const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
+  Array2TCoord modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
   Array2TCoord motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &pixelShift, const Array2TCoord &blockCenter) const override;
 
-  void fillCache(const ArrayXXTCoordPtrPair &cart2DProj);
-  void setEpipole(const Array3TCoord &epipole);
+  /** Variants with an explicit epipole rotation, e.g. for per-picture camera pose epipoles. */
+  ArrayXXTCoordPtrPair modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter, const Rotation &rotation) const;
+  /** Model motion for a block of the sphere table (position and size in subblock units) using the rotated sphere table of the rotation. */
+  ArrayXXTCoordPtrPair modelMotionCached(const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter,
+                                         const Rotation &rotation, const RotatedSphereTable &table) const;
+  /** Model motion for the rotated spherical coordinates of a block, as given by toRotatedSphere() or the rotated sphere table. Unlike modelMotion(), a zero motion vector is modelled as well. */
+  ArrayXXTCoordPtrPair modelMotionOnRotatedSphere(const ArrayXXTCoordPtrTriple &spherical, const Array2TCoord &motionVector, const Array2TCoord &blockCenter, const Rotation &rotation) const;
+  Array2TCoord modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter, const Rotation &rotation) const;
+  Array2TCoord motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &pixelShift, const Array2TCoord &blockCenter, const Rotation &rotation) const;
+  ArrayXXTCoordPtrTriple toRotatedSphere(const ArrayXXTCoordPtrPair &cart2D, const Rotation &rotation) const;
+
+  /** Link the sphere table and, for a default epipole set before, fill its rotated sphere table. */
+  void fillCache(const SphereTable *sphereTable);
+  void fillRotatedSphereTable(const Rotation &rotation, RotatedSphereTable &table) const;
+  const RotatedSphereTable& getRotatedSphereTable() const { return m_rotatedSphereTable; }
+  /** Set the default epipole. Only to be called during initialization, before the model is shared. */
+  void setEpipole(const Array3TCoord &epipole) { m_rotation.setEpipole(epipole); }
+  const Rotation& getRotation() const { return m_rotation; }
 
 protected:
-  ArrayXXTCoordPtrTriple toRotatedSphere(const ArrayXXTCoordPtrPair &cart2D) const;
-  ArrayXXTCoordPtrPair fromRotatedSphere(const ArrayXXTCoordPtrTriple &spherical) const;
-  ArrayXXTCoordPtr modelGeodesicMotion(const ArrayXXTCoordPtr &theta, const TCoord motionVectorX, const Array2TCoord &blockCenter) const;
+  ArrayXXTCoordPtrTriple rotateToSpherical(const ArrayXXTCoordPtrTriple &cart3D, const Rotation &rotation) const;
+  ArrayXXTCoordPtrPair fromRotatedSphere(const ArrayXXTCoordPtrTriple &spherical, const Rotation &rotation) const;
+  /** Parameter 'k' of the modulated geodesic motion */
+  TCoord modulationFactor(const TCoord motionVectorX, const Array2TCoord &blockCenter, const Rotation &rotation) const;
+  ArrayXXTCoordPtr modelGeodesicMotion(const ArrayXXTCoordPtr &theta, const TCoord motionVectorX, const Array2TCoord &blockCenter, const Rotation &rotation) const;
 
 protected:
   const Projection* m_projection;
   const TCoord m_angleResolution;
   const Flavor m_flavor;
 
-  Array3TCoord m_epipole;
-  Eigen::Matrix<TCoord, 3, 3> m_rotationMatrix;
+  Rotation m_rotation;  /**< Default epipole rotation */
 
-  /** Encoder luma caching */
-  ArrayXXTCoordPtrPair m_cachedCart2DProj;
-  Position m_cachedPosition;  /**< Cached block position */
-  Size m_cachedSize;  /**< Cached block size */
-  Array3TCoord m_cachedEpipole;  /**< Cached epipole */
-  ArrayXXTCoordPtr m_cachedSpherical[3];  /**< Rotated spherical coordinates of last block with position, size and epipole */
+  /** Encoder caching */
+  const SphereTable* m_sphereTable;  /**< Frame-wide sphere coordinates of the subblock origins */
+  RotatedSphereTable m_rotatedSphereTable;  /**< Sphere table rotated to the default epipole */
 };
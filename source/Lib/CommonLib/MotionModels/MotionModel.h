@@ -6,10 +6,29 @@
 
 #include "Coordinate.h"
 #include "Unit.h"
+#include "SphereTable.h"
+
+/// Motion model coordinates of the last block of a cached motion modeling call. Owned by the caller (one per thread and
+/// motion model) so that the motion models themselves stay immutable.
+struct MotionModelBlockCache
+{
+  Position position;  /**< Cached block position */
+  Size size;  /**< Cached block size */
+  ArrayXXTCoordPtr coords[3];  /**< Model coordinates of the subblock origins of the block */
+  ArrayXXBoolPtr vip;  /**< Virtual image plane flags (motion plane adaptive motion model) */
+};
 
 class MotionModel
 {
 public:
   virtual ArrayXXTCoordPtrPair modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const = 0;
+  /** Model motion for the subblock origins of a block in the sphere table (position and size in subblock units).
+   *  Models operating on the sphere override this to read the precomputed sphere coordinates instead of projecting to the sphere. */
+  virtual ArrayXXTCoordPtrPair modelMotionFromTable(const SphereTable &sphereTable, const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const {
+    return modelMotion(sphereTable.cart2D(position, size), motionVector, blockCenter);
+  }
+  /** Model motion of a single point. Gives the same result as modelMotion() for a 1x1 block, but without allocating
+   *  arrays, e.g. for the motion vector conversion of multi-model motion vector prediction. */
+  virtual Array2TCoord modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const = 0;
   virtual Array2TCoord motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const = 0;
 };
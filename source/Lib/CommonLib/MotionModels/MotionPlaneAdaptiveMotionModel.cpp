@@ -7,20 +7,6 @@
 MotionPlaneAdaptiveMotionModel::MotionPlaneAdaptiveMotionModel(const Projection *projection, const MotionModelID motionPlane): m_projection(projection), m_motionPlane(motionPlane)
 {
   m_perspective = PerspectiveProjection(projection->focalLength(), Array2TCoord(0, 0));
-  m_lutReal = ReprojectionLUT(-1393, 1393, -1364, 1364, [this](ArrayXXTCoordPtrPair cart2D){
-    auto rows = std::get<0>(cart2D)->rows();
-    auto cols = std::get<0>(cart2D)->cols();
-    ArrayXXBoolPtr vip = std::make_shared<ArrayXXBool>(ArrayXXBool::Zero(rows, cols));
-    return this->toProjection(cart2D, vip);
-  });
-  m_lutVip = ReprojectionLUT(-1393, 1393, -1364, 1364, [this](ArrayXXTCoordPtrPair cart2D){
-    auto rows = std::get<0>(cart2D)->rows();
-    auto cols = std::get<0>(cart2D)->cols();
-    ArrayXXBoolPtr vip = std::make_shared<ArrayXXBool>(ArrayXXBool::Ones(rows, cols));
-    return this->toProjection(cart2D, vip);
-  });
-  m_lutReal.fill();
-  m_lutVip.fill();
 }
 
 ArrayXXTCoordPtrPair MotionPlaneAdaptiveMotionModel::modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
@@ -38,29 +24,29 @@ ArrayXXTCoordPtrPair MotionPlaneAdaptiveMotionModel::modelMotion(ArrayXXTCoordPt
   const ArrayXXTCoordPtr cart2DPersMovedY = std::make_shared<ArrayXXTCoord>(*cart2DPersY + motionVector.y() * mvSign);
 
   // Back to projection
-//  return this->toProjectionLUT({cart2DPersMovedX, cart2DPersMovedY}, vip);
   return this->toProjection({cart2DPersMovedX, cart2DPersMovedY}, vip);
 }
 
-ArrayXXTCoordPtrPair MotionPlaneAdaptiveMotionModel::modelMotionCached(const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter)
+ArrayXXTCoordPtrPair MotionPlaneAdaptiveMotionModel::modelMotionCached(const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter,
+                                                                       MotionModelBlockCache &cache) const
 {
   // To motion plane
   ArrayXXTCoordPtr cart2DPersX;
   ArrayXXTCoordPtr cart2DPersY;
   ArrayXXBoolPtr vip;
-  if (position == m_lastPosition && size == m_lastSize) {
-    cart2DPersX = m_lastCart2DPers[0];
-    cart2DPersY = m_lastCart2DPers[1];
-    vip = m_lastVip;
+  if (position == cache.position && size == cache.size) {
+    cart2DPersX = cache.coords[0];
+    cart2DPersY = cache.coords[1];
+    vip = cache.vip;
   } else {
     cart2DPersX = std::make_shared<ArrayXXTCoord>(m_cart2DPers[0]->block(position.y, position.x, size.height, size.width));
     cart2DPersY = std::make_shared<ArrayXXTCoord>(m_cart2DPers[1]->block(position.y, position.x, size.height, size.width));
     vip = std::make_shared<ArrayXXBool>(m_vip->block(position.y, position.x, size.height, size.width));
-    m_lastPosition = position;
-    m_lastSize = size;
-    m_lastCart2DPers[0] = cart2DPersX;
-    m_lastCart2DPers[1] = cart2DPersY;
-    m_lastVip = vip;
+    cache.position = position;
+    cache.size = size;
+    cache.coords[0] = cart2DPersX;
+    cache.coords[1] = cart2DPersY;
+    cache.vip = vip;
   }
 
   // Translatory motion
@@ -69,10 +55,24 @@ ArrayXXTCoordPtrPair MotionPlaneAdaptiveMotionModel::modelMotionCached(const Pos
   const ArrayXXTCoordPtr cart2DPersMovedY = std::make_shared<ArrayXXTCoord>(*cart2DPersY + motionVector.y() * mvSign);
 
   // Back to projection
-//  return this->toProjectionLUT({cart2DPersMovedX, cart2DPersMovedY}, vip);
   return this->toProjection({cart2DPersMovedX, cart2DPersMovedY}, vip);
 }
 
+Array2TCoord MotionPlaneAdaptiveMotionModel::modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  // To motion plane
+  const std::pair<Array2TCoord, bool> cart2DPersVip = m_perspective.pointFromSphere(sphereToMotionPlane(m_projection->pointToSphere(cart2D)));
+  const Array2TCoord &cart2DPers = cart2DPersVip.first;
+  const bool vip = cart2DPersVip.second;
+
+  // Translatory motion
+  const TCoord mvSign = vip ? TCoord(-1) : TCoord(1);
+  const Array2TCoord cart2DPersMoved(cart2DPers.x() + motionVector.x() * mvSign, cart2DPers.y() + motionVector.y() * mvSign);
+
+  // Back to projection
+  return m_projection->pointFromSphere(motionPlaneToSphere(m_perspective.pointToSphere(cart2DPersMoved, vip)));
+}
+
 Array2TCoord MotionPlaneAdaptiveMotionModel::motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const
 {
   // Original position to motion plane
@@ -99,9 +99,9 @@ Array2TCoord MotionPlaneAdaptiveMotionModel::motionVectorForEquivalentPixelShift
   return {mvXEquivalent, mvYEquivalent};
 }
 
-void MotionPlaneAdaptiveMotionModel::fillCache(const ArrayXXTCoordPtrPair &cart2DProj)
+void MotionPlaneAdaptiveMotionModel::fillCache(const SphereTable &sphereTable)
 {
-  std::tuple<ArrayXXTCoordPtrPair, ArrayXXBoolPtr> cart2DPers_vip = toPerspective(cart2DProj);
+  std::tuple<ArrayXXTCoordPtrPair, ArrayXXBoolPtr> cart2DPers_vip = sphereToPerspective(sphereTable.cart3D());
   ArrayXXTCoordPtrPair cart2DPers = std::get<0>(cart2DPers_vip);
   m_cart2DPers[0] = std::get<0>(cart2DPers);
   m_cart2DPers[1] = std::get<1>(cart2DPers);
@@ -110,7 +110,11 @@ void MotionPlaneAdaptiveMotionModel::fillCache(const ArrayXXTCoordPtrPair &cart2
 
 std::tuple<ArrayXXTCoordPtrPair, ArrayXXBoolPtr> MotionPlaneAdaptiveMotionModel::toPerspective(const ArrayXXTCoordPtrPair &cart2DProj) const
 {
-  const ArrayXXTCoordPtrTriple sphere = m_projection->toSphere(cart2DProj);
+  return sphereToPerspective(m_projection->toSphere(cart2DProj));
+}
+
+std::tuple<ArrayXXTCoordPtrPair, ArrayXXBoolPtr> MotionPlaneAdaptiveMotionModel::sphereToPerspective(const ArrayXXTCoordPtrTriple &sphere) const
+{
   ArrayXXTCoordPtr sphereMotionPlaneX, sphereMotionPlaneY, sphereMotionPlaneZ;
   switch (m_motionPlane) {
   case MPA_FRONT_BACK:
@@ -136,7 +140,11 @@ std::tuple<ArrayXXTCoordPtrPair, ArrayXXBoolPtr> MotionPlaneAdaptiveMotionModel:
 
 std::tuple<Array2TCoord, bool> MotionPlaneAdaptiveMotionModel::toPerspective(const Array2TCoord &cart2DProj) const
 {
-  const Array3TCoord sphere = m_projection->toSphere(cart2DProj);
+  return m_perspective.fromSphere(sphereToMotionPlane(m_projection->toSphere(cart2DProj)));
+}
+
+Array3TCoord MotionPlaneAdaptiveMotionModel::sphereToMotionPlane(const Array3TCoord &sphere) const
+{
   TCoord sphereMotionPlaneX, sphereMotionPlaneY, sphereMotionPlaneZ;
   switch (m_motionPlane) {
   case MPA_FRONT_BACK:
@@ -157,7 +165,32 @@ std::tuple<Array2TCoord, bool> MotionPlaneAdaptiveMotionModel::toPerspective(con
   default:
     CHECK( true, "Invalid motion plane." );
   }
-  return m_perspective.fromSphere({ sphereMotionPlaneX, sphereMotionPlaneY, sphereMotionPlaneZ });
+  return { sphereMotionPlaneX, sphereMotionPlaneY, sphereMotionPlaneZ };
+}
+
+Array3TCoord MotionPlaneAdaptiveMotionModel::motionPlaneToSphere(const Array3TCoord &sphereMotionPlane) const
+{
+  TCoord sphereX, sphereY, sphereZ;
+  switch (m_motionPlane) {
+  case MPA_FRONT_BACK:
+    sphereX = sphereMotionPlane.x();
+    sphereY = sphereMotionPlane.y();
+    sphereZ = sphereMotionPlane.z();
+    break;
+  case MPA_LEFT_RIGHT:
+    sphereX = -sphereMotionPlane.y();
+    sphereY = sphereMotionPlane.x();
+    sphereZ = sphereMotionPlane.z();
+    break;
+  case MPA_TOP_BOTTOM:
+    sphereX = sphereMotionPlane.z();
+    sphereY = sphereMotionPlane.y();
+    sphereZ = -sphereMotionPlane.x();
+    break;
+  default:
+    CHECK( true, "Invalid motion plane." );
+  }
+  return { sphereX, sphereY, sphereZ };
 }
 
 ArrayXXTCoordPtrPair MotionPlaneAdaptiveMotionModel::toProjection(const ArrayXXTCoordPtrPair &cart2DPers, const ArrayXXBoolPtr &virtualImagePlane) const
@@ -185,49 +218,10 @@ ArrayXXTCoordPtrPair MotionPlaneAdaptiveMotionModel::toProjection(const ArrayXXT
   }
   return m_projection->fromSphere({sphereX, sphereY, sphereZ});
 }
-ArrayXXTCoordPtrPair MotionPlaneAdaptiveMotionModel::toProjectionLUT(const ArrayXXTCoordPtrPair& cart2DPers,
-                                                                     const ArrayXXBoolPtr& virtualImagePlane) const
-{
-  ArrayXXTCoordPtr cart2DPersX = std::get<0>(cart2DPers);
-  ArrayXXTCoordPtr cart2DPersY = std::get<1>(cart2DPers);
-  auto rows = cart2DPersX->rows();
-  auto cols = cart2DPersX->cols();
-  ArrayXXTCoordPtr cart2DProjX = std::make_shared<ArrayXXTCoord>(rows, cols);
-  ArrayXXTCoordPtr cart2DProjY = std::make_shared<ArrayXXTCoord>(rows, cols);
-  for (int i = 0; i < rows; ++i) {
-    for (int j = 0; j < cols; ++j) {
-      auto entry = virtualImagePlane->coeff(i, j) ? m_lutVip({ cart2DPersX->coeff(i, j), cart2DPersY->coeff(i, j) }) : m_lutReal({ cart2DPersX->coeff(i, j), cart2DPersY->coeff(i, j) });
-      cart2DProjX->coeffRef(i, j) = entry.x();
-      cart2DProjY->coeffRef(i, j) = entry.y();
-    }
-  }
-  return {cart2DProjX, cart2DProjY};
-}
 
 Array2TCoord MotionPlaneAdaptiveMotionModel::toProjection(Array2TCoord cart2DPers, bool virtualImagePlane) const {
   if (m_motionPlane == CLASSIC) {
     return cart2DPers;
   }
-  const Array3TCoord sphereViewport = m_perspective.toSphere(cart2DPers, virtualImagePlane);
-  TCoord sphereX, sphereY, sphereZ;
-  switch (m_motionPlane) {
-  case MPA_FRONT_BACK:
-    sphereX = sphereViewport.x();
-    sphereY = sphereViewport.y();
-    sphereZ = sphereViewport.z();
-    break;
-  case MPA_LEFT_RIGHT:
-    sphereX = -sphereViewport.y();
-    sphereY = sphereViewport.x();
-    sphereZ = sphereViewport.z();
-    break;
-  case MPA_TOP_BOTTOM:
-    sphereX = sphereViewport.z();
-    sphereY = sphereViewport.y();
-    sphereZ = -sphereViewport.x();
-    break;
-  default:
-    CHECK( true, "Invalid viewport." );
-  }
-  return m_projection->fromSphere({sphereX, sphereY, sphereZ});
+  return m_projection->fromSphere(motionPlaneToSphere(m_perspective.toSphere(cart2DPers, virtualImagePlane)));
 }
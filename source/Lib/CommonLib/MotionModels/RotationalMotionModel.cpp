@@ -10,6 +10,19 @@ ArrayXXTCoordPtrPair RotationalMotionModel::modelMotion(ArrayXXTCoordPtrPair car
   if (motionVector.x() == 0 && motionVector.y() == 0) {
     return cart2D;
   }
+  return modelMotionOnSphere(m_projection->toSphere(cart2D), motionVector, blockCenter);
+}
+
+ArrayXXTCoordPtrPair RotationalMotionModel::modelMotionFromTable(const SphereTable &sphereTable, const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    return sphereTable.cart2D(position, size);
+  }
+  return modelMotionOnSphere(sphereTable.cart3D(position, size), motionVector, blockCenter);
+}
+
+Eigen::Matrix<TCoord, 3, 3> RotationalMotionModel::sphereRotation(const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
   // Get rotation matrix with base vector (1, 0, 0) applying rodrigues rotation formula
   //  const TCoord thetaCenterMoved = M_PI_2 + motionVector.y() * m_angleResolution;
   //  const TCoord phiCenterMoved = motionVector.x() * m_angleResolution;
@@ -52,10 +65,14 @@ ArrayXXTCoordPtrPair RotationalMotionModel::modelMotion(ArrayXXTCoordPtrPair car
   Eigen::Matrix<TCoord, 3, 3> rotationMatrixReally = rotationMatrixUnrotT * (rotationMatrix * rotationMatrixUnrot);
 
   //  std::cout << (rotationMatrixUnrot * Eigen::Matrix<TCoord, 3, 1>(anchor.coeff(0), anchor.coeff(1), anchor.coeff(2))).eval() << std::endl << std::endl;
+  return rotationMatrixReally;
+}
 
+ArrayXXTCoordPtrPair RotationalMotionModel::modelMotionOnSphere(const ArrayXXTCoordPtrTriple &cart3D, const Array2TCoord  &motionVector, const Array2TCoord &blockCenter) const
+{
+  const Eigen::Matrix<TCoord, 3, 3> rotationMatrixReally = sphereRotation(motionVector, blockCenter);
 
-  // To sphere
-  const ArrayXXTCoordPtrTriple cart3D = m_projection->toSphere(cart2D);
+  // Block on sphere
   const ArrayXXTCoord cart3DX = *std::get<0>(cart3D);
   const ArrayXXTCoord cart3DY = *std::get<1>(cart3D);
   const ArrayXXTCoord cart3DZ = *std::get<2>(cart3D);
@@ -77,6 +94,16 @@ ArrayXXTCoordPtrPair RotationalMotionModel::modelMotion(ArrayXXTCoordPtrPair car
   return m_projection->fromSphere({cart3DXMoved, cart3DYMoved, cart3DZMoved});
 }
 
+Array2TCoord RotationalMotionModel::modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    return cart2D;
+  }
+  const Array3TCoord cart3D = m_projection->pointToSphere(cart2D);
+  const Eigen::Matrix<TCoord, 3, 1> cart3DMoved = sphereRotation(motionVector, blockCenter) * Eigen::Matrix<TCoord, 3, 1>(cart3D.x(), cart3D.y(), cart3D.z());
+  return m_projection->pointFromSphere({cart3DMoved.x(), cart3DMoved.y(), cart3DMoved.z()});
+}
+
 Array2TCoord RotationalMotionModel::motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const
 {
   const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(m_projection->toSphere(blockCenter));
@@ -21,8 +21,15 @@ public:
   RotationalMotionModel(const Projection* projection, TCoord angleResolution): m_projection(projection), m_angleResolution(angleResolution) {}
 
   ArrayXXTCoordPtrPair modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
+  ArrayXXTCoordPtrPair modelMotionFromTable(const SphereTable &sphereTable, const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
+  Array2TCoord modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
   Array2TCoord motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &pixelShift, const Array2TCoord &blockCenter) const override;
 
+protected:
+  ArrayXXTCoordPtrPair modelMotionOnSphere(const ArrayXXTCoordPtrTriple &cart3D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const;
+  /** Rotation of the sphere for the motion vector at the block center */
+  Eigen::Matrix<TCoord, 3, 3> sphereRotation(const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const;
+
 protected:
   const Projection* m_projection;
   const TCoord m_angleResolution;
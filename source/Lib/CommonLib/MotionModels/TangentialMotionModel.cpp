@@ -10,6 +10,23 @@ ArrayXXTCoordPtrPair TangentialMotionModel::modelMotion(ArrayXXTCoordPtrPair car
   if (motionVector.x() == 0 && motionVector.y() == 0) {
     return cart2D;
   }
+  // Block coordinates on sphere
+  const ArrayXXTCoordPtrTriple cart3D = m_projection->toSphere(cart2D);
+  const ArrayXXTCoordPtrTriple spherical = CoordinateConversion::cartesianToSpherical(cart3D);
+  return modelMotionOnSphere(std::get<1>(spherical), std::get<2>(spherical), motionVector, blockCenter);
+}
+
+ArrayXXTCoordPtrPair TangentialMotionModel::modelMotionFromTable(const SphereTable &sphereTable, const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    return sphereTable.cart2D(position, size);
+  }
+  const ArrayXXTCoordPtrPair spherical = sphereTable.spherical(position, size);
+  return modelMotionOnSphere(std::get<0>(spherical), std::get<1>(spherical), motionVector, blockCenter);
+}
+
+ArrayXXTCoordPtrPair TangentialMotionModel::modelMotionOnSphere(const ArrayXXTCoordPtr &sphericalTheta, const ArrayXXTCoordPtr &sphericalPhi, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
   // Block center point on sphere
   const Array3TCoord cart3DCenter = m_projection->toSphere(blockCenter);
   const Array3TCoord sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenter);
@@ -17,10 +34,8 @@ ArrayXXTCoordPtrPair TangentialMotionModel::modelMotion(ArrayXXTCoordPtrPair car
   const TCoord alphaSphereCenter = sphericalCenter(2);
 
   // Block coordinates on sphere
-  const ArrayXXTCoordPtrTriple cart3D = m_projection->toSphere(cart2D);
-  const ArrayXXTCoordPtrTriple spherical = CoordinateConversion::cartesianToSpherical(cart3D);
-  const ArrayXXTCoordPtr epsilon = std::make_shared<ArrayXXTCoord>(M_PI_2 - *std::get<1>(spherical));
-  const ArrayXXTCoordPtr alpha = std::get<2>(spherical);
+  const ArrayXXTCoordPtr epsilon = std::make_shared<ArrayXXTCoord>(M_PI_2 - *sphericalTheta);
+  const ArrayXXTCoordPtr &alpha = sphericalPhi;
 
   // Projection to the motion plane
   const ArrayXXTCoord deltaAlpha = *alpha - alphaSphereCenter;
@@ -47,6 +62,52 @@ ArrayXXTCoordPtrPair TangentialMotionModel::modelMotion(ArrayXXTCoordPtrPair car
   return m_projection->fromSphere(cart3DMoved);
 }
 
+Array2TCoord TangentialMotionModel::modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    return cart2D;
+  }
+  // Point on sphere
+  const Array3TCoord cart3D = m_projection->pointToSphere(cart2D);
+  TCoord sphericalR, sphericalTheta, sphericalPhi;
+  g_coordOP.cartesianToSpherical(cart3D.data(), cart3D.data() + 1, cart3D.data() + 2, &sphericalR, &sphericalTheta, &sphericalPhi, 1);
+
+  // Same operations as in modelMotionOnSphere() for a single element
+  const Array3TCoord cart3DCenter = m_projection->toSphere(blockCenter);
+  const Array3TCoord sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenter);
+  const TCoord epsilonSphereCenter = M_PI_2 - sphericalCenter(1);
+  const TCoord alphaSphereCenter = sphericalCenter(2);
+  const TCoord sinEpsilonSphereCenter = sin(epsilonSphereCenter);
+  const TCoord cosEpsilonSphereCenter = cos(epsilonSphereCenter);
+
+  const TCoord epsilon = TCoord(M_PI_2) - sphericalTheta;
+  const TCoord alpha = sphericalPhi;
+
+  // Projection to the motion plane
+  const TCoord deltaAlpha = alpha - alphaSphereCenter;
+  const TCoord cosPsi = sinEpsilonSphereCenter * std::sin(epsilon) + cosEpsilonSphereCenter * std::cos(epsilon) * std::cos(deltaAlpha);
+  const TCoord cart2DYPlane = (std::sin(epsilon) * cosEpsilonSphereCenter - sinEpsilonSphereCenter * std::cos(epsilon) * std::cos(deltaAlpha)) / cosPsi;
+  const TCoord cart2DXPlane = (std::sin(deltaAlpha) * std::cos(epsilon)) / cosPsi;
+
+  // Perform motion
+  const TCoord cart2DYPlaneMoved = cart2DYPlane - motionVector.y() * m_angleResolution;
+  const TCoord cart2DXPlaneMoved = cart2DXPlane - motionVector.x() * m_angleResolution;
+
+  // Projection to the sphere
+  const TCoord rho = std::sqrt(cart2DXPlaneMoved * cart2DXPlaneMoved + cart2DYPlaneMoved * cart2DYPlaneMoved);
+  const TCoord eta = std::atan(rho);
+  const TCoord gamma = rho * cosEpsilonSphereCenter * std::cos(eta) - cart2DYPlaneMoved * sinEpsilonSphereCenter * std::sin(eta);
+  const TCoord alphaMoved = alphaSphereCenter + std::atan((cart2DXPlaneMoved * std::sin(eta)) / gamma);
+  const TCoord epsilonMoved = std::asin(std::cos(eta) * sinEpsilonSphereCenter + (cart2DYPlaneMoved * std::sin(eta) * cosEpsilonSphereCenter) / rho);
+
+  // Moved point in projection
+  const TCoord sphericalRMoved = 1;
+  const TCoord sphericalThetaMoved = TCoord(M_PI_2) - epsilonMoved;
+  Array3TCoord cart3DMoved;
+  g_coordOP.sphericalToCartesian(&sphericalRMoved, &sphericalThetaMoved, &alphaMoved, &cart3DMoved.coeffRef(0), &cart3DMoved.coeffRef(1), &cart3DMoved.coeffRef(2), 1);
+  return m_projection->pointFromSphere(cart3DMoved);
+}
+
 Array2TCoord TangentialMotionModel::motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const
 {
   // Block center point on sphere
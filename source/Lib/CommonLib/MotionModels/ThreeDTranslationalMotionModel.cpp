@@ -9,20 +9,45 @@ ArrayXXTCoordPtrPair ThreeDTranslationalMotionModel::modelMotion(ArrayXXTCoordPt
   if (motionVector.x() == 0 && motionVector.y() == 0) {
     return cart2D;
   }
-  // Derive 3D motion vector
+  return modelMotionOnSphere(m_projection->toSphere(cart2D), motionVector, blockCenter);
+}
+
+ArrayXXTCoordPtrPair ThreeDTranslationalMotionModel::modelMotionFromTable(const SphereTable &sphereTable, const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    return sphereTable.cart2D(position, size);
+  }
+  return modelMotionOnSphere(sphereTable.cart3D(position, size), motionVector, blockCenter);
+}
+
+Array3TCoord ThreeDTranslationalMotionModel::motionVectorOnSphere(const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
   const Array2TCoord cart2DCenterMoved = blockCenter + motionVector;
   const Array3TCoord cart3DCenter = m_projection->toSphere(blockCenter);
   const Array3TCoord cart3DCenterMoved = m_projection->toSphere(cart2DCenterMoved);
-  const Array3TCoord motionVector3D = cart3DCenterMoved - cart3DCenter;
+  return cart3DCenterMoved - cart3DCenter;
+}
+
+ArrayXXTCoordPtrPair ThreeDTranslationalMotionModel::modelMotionOnSphere(const ArrayXXTCoordPtrTriple &cart3D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  // Derive 3D motion vector
+  const Array3TCoord motionVector3D = motionVectorOnSphere(motionVector, blockCenter);
 
   // Perform 3D motion
-  ArrayXXTCoordPtrTriple cart3D = m_projection->toSphere(cart2D);
   const ArrayXXTCoordPtr cart3DXMoved = std::make_shared<ArrayXXTCoord>(*std::get<0>(cart3D) + motionVector3D.x());
   const ArrayXXTCoordPtr cart3DYMoved = std::make_shared<ArrayXXTCoord>(*std::get<1>(cart3D) + motionVector3D.y());
   const ArrayXXTCoordPtr cart3DZMoved = std::make_shared<ArrayXXTCoord>(*std::get<2>(cart3D) + motionVector3D.z());
   return m_projection->fromSphere({cart3DXMoved, cart3DYMoved, cart3DZMoved});
 }
 
+Array2TCoord ThreeDTranslationalMotionModel::modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    return cart2D;
+  }
+  return m_projection->pointFromSphere(m_projection->pointToSphere(cart2D) + motionVectorOnSphere(motionVector, blockCenter));
+}
+
 Array2TCoord ThreeDTranslationalMotionModel::motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const
 {
   // Positions to sphere
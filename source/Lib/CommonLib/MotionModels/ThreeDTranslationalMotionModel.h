@@ -21,8 +21,15 @@ public:
   ThreeDTranslationalMotionModel(const Projection* projection): m_projection(projection) {}
 
   ArrayXXTCoordPtrPair modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
+  ArrayXXTCoordPtrPair modelMotionFromTable(const SphereTable &sphereTable, const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
+  Array2TCoord modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
   Array2TCoord motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &pixelShift, const Array2TCoord &blockCenter) const override;
 
+protected:
+  ArrayXXTCoordPtrPair modelMotionOnSphere(const ArrayXXTCoordPtrTriple &cart3D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const;
+  /** 3D motion vector of the block center on the unit sphere */
+  Array3TCoord motionVectorOnSphere(const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const;
+
 protected:
   const Projection* m_projection;
 };
@@ -11,6 +11,11 @@ ArrayXXTCoordPtrPair TranslationalMotionModel::modelMotion(ArrayXXTCoordPtrPair
   return {cart2DXMoved, cart2DYMoved};
 }
 
+Array2TCoord TranslationalMotionModel::modelPointMotion(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  return {cart2D.x() + motionVector.x(), cart2D.y() + motionVector.y()};
+}
+
 Array2TCoord TranslationalMotionModel::motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const
 {
   return {shiftedPosition.x() - TCoord(position.x), shiftedPosition.y() - TCoord(position.y)};
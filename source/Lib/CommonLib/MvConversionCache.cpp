@@ -0,0 +1,93 @@
+//
+// Bounded memo of motion vector conversions between motion models for candidate list construction.
+//
+
+#include "MvConversionCache.h"
+
+#include <cstring>
+
+bool MvConversionCache::Key::operator==(const Key &other) const
+{
+  return std::memcmp(this, &other, sizeof(Key)) == 0;
+}
+
+void MvConversionCache::init(int numSlots)
+{
+  CHECK(numSlots & (numSlots - 1), "Number of cache slots must be a power of two.");
+  m_slots.assign(numSlots, Slot());
+  for (auto &slot : m_slots) {
+    slot.generation = 0;
+  }
+  m_generation = 1;
+}
+
+void MvConversionCache::clear()
+{
+  m_generation++;
+  if (m_generation == 0) {
+    // Generation counter wrapped around, invalidate all slots explicitly
+    for (auto &slot : m_slots) {
+      slot.generation = 0;
+    }
+    m_generation = 1;
+  }
+}
+
+uint32_t MvConversionCache::hash(const Key &key)
+{
+  const int *values = &key.x;
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < int(sizeof(Key) / sizeof(int)); i++) {
+    h = (h ^ uint32_t(values[i])) * 16777619u;
+  }
+  return h ^ (h >> 15);
+}
+
+bool MvConversionCache::lookup(const Key &key, Mv &mv)
+{
+  m_numLookups++;
+  const uint32_t mask = uint32_t(m_slots.size() - 1);
+  uint32_t idx = hash(key) & mask;
+  for (int probe = 0; probe < MAX_PROBES; probe++, idx = (idx + 1) & mask) {
+    const Slot &slot = m_slots[idx];
+    if (slot.generation != m_generation) {
+      return false;
+    }
+    if (slot.key == key) {
+      mv = slot.mv;
+      m_numHits++;
+      return true;
+    }
+  }
+  return false;
+}
+
+void MvConversionCache::insert(const Key &key, const Mv &mv)
+{
+  const uint32_t mask = uint32_t(m_slots.size() - 1);
+  const uint32_t home = hash(key) & mask;
+  uint32_t idx = home;
+  int probe = 0;
+  while (probe < MAX_PROBES && m_slots[idx].generation == m_generation) {
+    probe++;
+    idx = (idx + 1) & mask;
+  }
+  if (probe == MAX_PROBES) {
+    // Probe window exhausted, replace its first entry
+    idx = home;
+  }
+  Slot &slot = m_slots[idx];
+  slot.key = key;
+  slot.generation = m_generation;
+  slot.mv = mv;
+}
+
+void MvConversionCache::printStatistics() const
+{
+  if (m_numLookups == 0) {
+    return;
+  }
+  msg(INFO, "\nMV conversion cache: %llu lookups, %llu hits (%.2f %%)\n",
+      (unsigned long long) m_numLookups, (unsigned long long) m_numHits,
+      100.0 * double(m_numHits) / double(m_numLookups));
+}
@@ -0,0 +1,60 @@
+//
+// Bounded memo of motion vector conversions between motion models for candidate list construction.
+//
+
+#pragma once
+
+#include "CommonDef.h"
+#include "Mv.h"
+
+#include <vector>
+
+/// Open addressing hash table of motion vectors converted to another motion model, keyed by all inputs of the
+/// conversion. Neighbouring and co-located candidates are converted again for every block that sees them, and the
+/// encoder repeats the candidate list construction in every RD pass. The table has a fixed size; an entry whose probe
+/// window is full replaces the first slot of the window. All entries are dropped at every picture.
+class MvConversionCache
+{
+public:
+  struct Key
+  {
+    int x, y;
+    int mvHor, mvVer;
+    int motionModelOrig, motionModelDesired;
+    int shiftHor, shiftVer;
+    int curPOCOrig, refPOCOrig, curPOCDesired, refPOCDesired;
+    int candidateX, candidateY, candidateWidth, candidateHeight;
+    int currentX, currentY, currentWidth, currentHeight;
+
+    bool operator==(const Key &other) const;
+  };
+
+  MvConversionCache(): m_generation(0), m_numLookups(0), m_numHits(0) {}
+
+  void init(int numSlots);
+  bool isInitialized() const { return !m_slots.empty(); }
+  void clear();
+
+  bool lookup(const Key &key, Mv &mv);
+  void insert(const Key &key, const Mv &mv);
+
+  void printStatistics() const;
+
+protected:
+  static uint32_t hash(const Key &key);
+
+  struct Slot
+  {
+    Key key;
+    uint32_t generation;  /**< Slot is valid if equal to the cache generation */
+    Mv mv;
+  };
+
+  static const int MAX_PROBES = 4;
+
+  std::vector<Slot> m_slots;
+  uint32_t m_generation;
+
+  uint64_t m_numLookups;
+  uint64_t m_numHits;
+};
@@ -78,6 +78,7 @@ Picture::Picture()
   m_isMctfFiltered      = false;
   m_grainCharacteristic = nullptr;
   m_grainBuf            = nullptr;
+  m_numMotionModelPlanes = 0;
 }
 
 #if JVET_Z0120_SII_SEI_PROCESSING
@@ -126,6 +127,10 @@ void Picture::destroy()
     M_BUFS(jId, t).destroy();
   }
   m_hashMap.clearAll();
+  for (int l = 0; l < NUM_REF_PIC_LIST_01; l++)
+  {
+    std::vector<uint16_t>().swap(m_motionModelIntegral[l]);
+  }
   if (cs)
   {
 #if GDR_ENABLED
@@ -273,6 +278,10 @@ void Picture::finalInit( const VPS* vps, const SPS& sps, const PPS& pps, PicHead
   picHeader->setPic(this);
 #endif
   cs->picHeader = picHeader;
+  for (int l = 0; l < NUM_REF_PIC_LIST_01; l++)
+  {
+    m_motionModelIntegral[l].clear();
+  }
   memcpy(cs->alfApss, alfApss, sizeof(cs->alfApss));
   cs->lmcsAps = lmcsAps;
   cs->scalinglistAps = scalingListAps;
@@ -1254,6 +1263,123 @@ void Picture::addPictureToHashMapForInter()
   }
 }
 
+void Picture::countMotionModels(const Area &area, const RefPicList refPicList, int votes[NUM_MODELS + 1]) const
+{
+  const std::vector<uint16_t> &integral = m_motionModelIntegral[refPicList];
+  if (integral.empty())
+  {
+    xBuildMotionModelIntegral(refPicList);
+  }
+
+  CHECKD(!cs->area.Y().contains(area), "Motion model query outside of the picture");
+  const Area miArea     = g_miScaling.scale(area);
+  const int  numPlanes  = m_numMotionModelPlanes;
+  const int  tileWidth  = g_miScaling.scaleHor(cs->pcv->maxCUWidth);
+  const int  tileHeight = g_miScaling.scaleVer(cs->pcv->maxCUHeight);
+  const int  tilesInRow = (g_miScaling.scaleHor(int(cs->area.lwidth())) + tileWidth - 1) / tileWidth;
+
+  int counts[NUM_MODELS + 1] = { 0 };
+
+  // Sum the inclusive prefix counts of every CTU tile the area overlaps, usually a single one
+  for (int ty = miArea.y / tileHeight; ty <= (miArea.y + int(miArea.height) - 1) / tileHeight; ty++)
+  {
+    const int y0 = std::max(int(miArea.y) - ty * tileHeight, 0);
+    const int y1 = std::min(int(miArea.y + miArea.height) - ty * tileHeight, tileHeight) - 1;
+
+    for (int tx = miArea.x / tileWidth; tx <= (miArea.x + int(miArea.width) - 1) / tileWidth; tx++)
+    {
+      const int x0 = std::max(int(miArea.x) - tx * tileWidth, 0);
+      const int x1 = std::min(int(miArea.x + miArea.width) - tx * tileWidth, tileWidth) - 1;
+
+      const uint16_t *tile   = &integral[(ty * tilesInRow + tx) * tileWidth * tileHeight * numPlanes];
+      const uint16_t *bottom = tile + y1 * tileWidth * numPlanes;
+      const uint16_t *top    = y0 > 0 ? tile + (y0 - 1) * tileWidth * numPlanes : nullptr;
+
+      for (int p = 0; p < numPlanes; p++)
+      {
+        int count = bottom[x1 * numPlanes + p];
+        if (x0 > 0)
+        {
+          count -= bottom[(x0 - 1) * numPlanes + p];
+        }
+        if (top)
+        {
+          count -= top[x1 * numPlanes + p];
+          if (x0 > 0)
+          {
+            count += top[(x0 - 1) * numPlanes + p];
+          }
+        }
+        counts[p] += count;
+      }
+    }
+  }
+
+  for (int i = 0; i <= NUM_MODELS; i++)
+  {
+    const int plane = m_motionModelPlanes[i];
+    votes[i] = plane < 0 ? 0 : counts[plane];
+  }
+}
+
+void Picture::xBuildMotionModelIntegral(const RefPicList refPicList) const
+{
+  MotionModelID activeModels[NUM_MODELS];
+  const int numActiveModels = cs->sps->getActiveMotionModels(activeModels);
+
+  // Plane 0 counts the units without motion model, the active models follow
+  std::fill_n(m_motionModelPlanes, NUM_MODELS + 1, -1);
+  m_motionModelPlanes[0] = 0;
+  for (int i = 0; i < numActiveModels; i++)
+  {
+    m_motionModelPlanes[activeModels[i] + 1] = i + 1;
+  }
+  m_numMotionModelPlanes = numActiveModels + 1;
+
+  const CMotionBuf motionBuf  = cs->getMotionBuf();
+  const int        numPlanes  = m_numMotionModelPlanes;
+  const int        tileWidth  = g_miScaling.scaleHor(cs->pcv->maxCUWidth);
+  const int        tileHeight = g_miScaling.scaleVer(cs->pcv->maxCUHeight);
+  const int        tilesInRow = (motionBuf.width + tileWidth - 1) / tileWidth;
+  const int        tileSize   = tileWidth * tileHeight * numPlanes;
+  CHECK(tileWidth * tileHeight > std::numeric_limits<uint16_t>::max(), "CTU too large for 16-bit motion model counts");
+
+  std::vector<uint16_t> &integral = m_motionModelIntegral[refPicList];
+  integral.assign(tilesInRow * ((motionBuf.height + tileHeight - 1) / tileHeight) * tileSize, 0);
+
+  uint16_t rowCounts[NUM_MODELS + 1];
+  for (int y = 0; y < motionBuf.height; y++)
+  {
+    const MotionInfo *mi = motionBuf.buf + y * motionBuf.stride;
+    const int         ly = y % tileHeight;
+    uint16_t         *tileRow = &integral[(y / tileHeight) * tilesInRow * tileSize + ly * tileWidth * numPlanes];
+
+    for (int x = 0; x < motionBuf.width; x++)
+    {
+      const int lx = x % tileWidth;
+      if (lx == 0)
+      {
+        std::fill_n(rowCounts, numPlanes, 0);
+      }
+
+      MotionModelID motionModel = mi[x].motionModel[refPicList];
+      if (motionModel == INVALID)
+      {
+        motionModel = mi[x].motionModel[1 - refPicList];
+      }
+      const int plane = m_motionModelPlanes[motionModel + 1];
+      CHECK(plane < 0, "Motion model is not active in the SPS");
+      rowCounts[plane]++;
+
+      uint16_t *dst = tileRow + (x / tileWidth) * tileSize + lx * numPlanes;
+      for (int p = 0; p < numPlanes; p++)
+      {
+        dst[p] = ly > 0 ? uint16_t(dst[p - tileWidth * numPlanes] + rowCounts[p]) : rowCounts[p];
+      }
+    }
+  }
+}
+
 void Picture::createGrainSynthesizer(bool firstPictureInSequence, SEIFilmGrainSynthesizer *grainCharacteristics, PelStorage *grainBuf, int width, int height, ChromaFormat fmt, int bitDepth)
 {
   m_grainCharacteristic = grainCharacteristics;
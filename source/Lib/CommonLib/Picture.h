@@ -245,6 +245,21 @@ public:
   const TComHash*    getHashMap() const { return &m_hashMap; }
   void               addPictureToHashMapForInter();
 
+  /// Count the motion models of the 4x4 units in area, falling back to the other list where refPicList has none.
+  /// votes[model + 1] receives the count of each model, votes[0] the count of INVALID units.
+  void               countMotionModels(const Area &area, const RefPicList refPicList, int votes[NUM_MODELS + 1]) const;
+
+private:
+  void               xBuildMotionModelIntegral(const RefPicList refPicList) const;
+
+  /// Summed-area tables of the motion model counts at 4x4 granularity, built on the first query after finalInit().
+  /// Each CTU has its own table of 16-bit inclusive counts, stored in CTU raster order; within a CTU,
+  /// entry ((y * ctuWidth + x) * numPlanes + plane) holds the counts of the units up to and including (x, y).
+  mutable std::vector<uint16_t> m_motionModelIntegral[NUM_REF_PIC_LIST_01];
+  mutable int                   m_motionModelPlanes[NUM_MODELS + 1];   ///< plane of model + 1, -1 if inactive
+  mutable int                   m_numMotionModelPlanes;
+
+public:
   CodingStructure*   cs;
   std::deque<Slice*> slices;
   SEIMessages        SEIs;
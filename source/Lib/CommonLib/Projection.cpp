@@ -4,6 +4,21 @@
 
 #include "Projection.h"
 
+Array3TCoord Projection::pointToSphere(const Array2TCoord &cart2D) const {
+  ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(ArrayXXTCoord::Constant(1, 1, cart2D.x()));
+  ArrayXXTCoordPtr cart2DY = std::make_shared<ArrayXXTCoord>(ArrayXXTCoord::Constant(1, 1, cart2D.y()));
+  const ArrayXXTCoordPtrTriple cart3D = toSphere(ArrayXXTCoordPtrPair(cart2DX, cart2DY));
+  return {std::get<0>(cart3D)->coeff(0), std::get<1>(cart3D)->coeff(0), std::get<2>(cart3D)->coeff(0)};
+}
+
+Array2TCoord Projection::pointFromSphere(const Array3TCoord &cart3D) const {
+  ArrayXXTCoordPtr cart3DX = std::make_shared<ArrayXXTCoord>(ArrayXXTCoord::Constant(1, 1, cart3D.x()));
+  ArrayXXTCoordPtr cart3DY = std::make_shared<ArrayXXTCoord>(ArrayXXTCoord::Constant(1, 1, cart3D.y()));
+  ArrayXXTCoordPtr cart3DZ = std::make_shared<ArrayXXTCoord>(ArrayXXTCoord::Constant(1, 1, cart3D.z()));
+  const ArrayXXTCoordPtrPair cart2D = fromSphere(ArrayXXTCoordPtrTriple(cart3DX, cart3DY, cart3DZ));
+  return {std::get<0>(cart2D)->coeff(0), std::get<1>(cart2D)->coeff(0)};
+}
+
 ArrayXXTCoordPtrTriple RadialProjection::toSphere(ArrayXXTCoordPtrPair cart2D) const {
   // r, phi_s = coordinate_conversion.cartesian_to_polar(x - self._optical_center[0], y - self._optical_center[1])
   ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(*std::get<0>(cart2D) - m_opticalCenter.x());
@@ -194,6 +209,32 @@ PerspectiveProjection::fromSphere(const Array3TCoord &cart3D) const {
   return {{cart2DX, cart2DY}, virtualImagePlane};
 }
 
+Array3TCoord PerspectiveProjection::pointToSphere(const Array2TCoord &cart2D, bool virtualImagePlane) const {
+  const TCoord cart2DX = cart2D.x() - m_opticalCenter.x();
+  const TCoord cart2DY = cart2D.y() - m_opticalCenter.y();
+  TCoord polarR, polarPhi;
+  g_coordOP.cartesianToPolar(&cart2DX, &cart2DY, &polarR, &polarPhi, 1);
+  const TCoord sphericalR = 1;
+  TCoord sphericalTheta = this->theta(polarR);
+  sphericalTheta = sphericalTheta - TCoord(virtualImagePlane) * (TCoord(2) * sphericalTheta - TCoord(M_PI));
+  const TCoord sphericalPhi = polarPhi - TCoord(virtualImagePlane) * TCoord(M_PI);
+  TCoord cart3DX, cart3DY, cart3DZ;
+  g_coordOP.sphericalToCartesian(&sphericalR, &sphericalTheta, &sphericalPhi, &cart3DX, &cart3DY, &cart3DZ, 1);
+  return {-cart3DZ, cart3DX, -cart3DY};
+}
+
+std::pair<Array2TCoord, bool> PerspectiveProjection::pointFromSphere(const Array3TCoord &cart3D) const {
+  const TCoord cart3DRotX = cart3D.y();
+  const TCoord cart3DRotY = -cart3D.z();
+  const TCoord cart3DRotZ = -cart3D.x();
+  TCoord sphericalR, sphericalTheta, sphericalPhi;
+  g_coordOP.cartesianToSpherical(&cart3DRotX, &cart3DRotY, &cart3DRotZ, &sphericalR, &sphericalTheta, &sphericalPhi, 1);
+  const TCoord polarR = this->radius(sphericalTheta);
+  TCoord cart2DX, cart2DY;
+  g_coordOP.polarToCartesian(&polarR, &sphericalPhi, &cart2DX, &cart2DY, 1);
+  return {{cart2DX + m_opticalCenter.x(), cart2DY + m_opticalCenter.y()}, polarR < 0};
+}
+
 ArrayXXTCoordPtr PerspectiveProjection::radius(ArrayXXTCoordPtr theta) const {
   return std::make_shared<ArrayXXTCoord>(m_focalLength * theta->tan());
 }
@@ -211,8 +252,13 @@ TCoord PerspectiveProjection::theta(TCoord radius) const {
 }
 
 ArrayXXTCoordPtrTriple EquirectangularProjection::toSphere(ArrayXXTCoordPtrPair cart2D) const {
-  ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(*std::get<0>(cart2D) + m_pixelOffset);
-  ArrayXXTCoordPtr cart2DY = std::make_shared<ArrayXXTCoord>(*std::get<1>(cart2D) + m_pixelOffset);
+  const ArrayXXTCoord &x = *std::get<0>(cart2D);
+  const ArrayXXTCoord &y = *std::get<1>(cart2D);
+  if (isSeparableGrid(x, y)) {
+    return toSphereSeparable(x.row(0), y.col(0).transpose());
+  }
+  ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(x + m_pixelOffset);
+  ArrayXXTCoordPtr cart2DY = std::make_shared<ArrayXXTCoord>(y + m_pixelOffset);
   ArrayXXTCoordPtr sphericalR = std::make_shared<ArrayXXTCoord>(ArrayXXTCoord::Ones(cart2DX->rows(), cart2DX->cols()));
   ArrayXXTCoordPtr sphericalPhi = std::make_shared<ArrayXXTCoord>(-(*cart2DX / TCoord(m_resolution.width)) * TCoord(2) * TCoord(M_PI));
   ArrayXXTCoordPtr sphericalTheta = std::make_shared<ArrayXXTCoord>((*cart2DY / TCoord(m_resolution.height)) * TCoord(M_PI));
@@ -220,6 +266,62 @@ ArrayXXTCoordPtrTriple EquirectangularProjection::toSphere(ArrayXXTCoordPtrPair
   return cart3D;
 }
 
+bool EquirectangularProjection::isSeparableGrid(const ArrayXXTCoord &x, const ArrayXXTCoord &y) {
+  if (x.size() == 0) {
+    return false;
+  }
+  for (Eigen::Index col = 0; col < x.cols(); col++) {
+    for (Eigen::Index row = 1; row < x.rows(); row++) {
+      if (x(row, col) != x(0, col) || y(row, col) != y(row, 0)) {
+        return false;
+      }
+    }
+    if (y(0, col) != y(0, 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+ArrayXXTCoordPtrTriple EquirectangularProjection::toSphereSeparable(const ArrayXTCoord &x, const ArrayXTCoord &y) const {
+  // Same arithmetic as the element-wise path, so both give identical results
+  const Eigen::Index cols = x.size();
+  const Eigen::Index rows = y.size();
+  const Eigen::Index size = rows * cols;
+  const Eigen::Index packetEnd = CoordTrig::packetEnd(int(size));
+  auto phi = [&](Eigen::Index col) { return -((x(col) + m_pixelOffset) / TCoord(m_resolution.width)) * TCoord(2) * TCoord(M_PI); };
+  auto theta = [&](Eigen::Index row) { return ((y(row) + m_pixelOffset) / TCoord(m_resolution.height)) * TCoord(M_PI); };
+  ArrayXTCoord sinPhi(cols), cosPhi(cols);
+  for (Eigen::Index col = 0; col < cols; col++) {
+    CoordTrig::sincos(phi(col), sinPhi(col), cosPhi(col), true);
+  }
+  ArrayXTCoord sinTheta(rows), cosTheta(rows);
+  for (Eigen::Index row = 0; row < rows; row++) {
+    CoordTrig::sincos(theta(row), sinTheta(row), cosTheta(row), true);
+  }
+
+  ArrayXXTCoordPtr cart3DX = std::make_shared<ArrayXXTCoord>(rows, cols);
+  ArrayXXTCoordPtr cart3DY = std::make_shared<ArrayXXTCoord>(rows, cols);
+  ArrayXXTCoordPtr cart3DZ = std::make_shared<ArrayXXTCoord>(rows, cols);
+  for (Eigen::Index col = 0; col < cols; col++) {
+    for (Eigen::Index row = 0; row < rows; row++) {
+      (*cart3DX)(row, col) = sinTheta(row) * cosPhi(col);
+      (*cart3DY)(row, col) = sinTheta(row) * sinPhi(col);
+      (*cart3DZ)(row, col) = cosTheta(row);
+    }
+  }
+  // The trailing elements that do not fill a packet are evaluated with the scalar functions, as in the element-wise path
+  for (Eigen::Index i = packetEnd; i < size; i++) {
+    TCoord sinPhiTail, cosPhiTail, sinThetaTail, cosThetaTail;
+    CoordTrig::sincos(phi(i / rows), sinPhiTail, cosPhiTail, false);
+    CoordTrig::sincos(theta(i % rows), sinThetaTail, cosThetaTail, false);
+    (*cart3DX)(i) = sinThetaTail * cosPhiTail;
+    (*cart3DY)(i) = sinThetaTail * sinPhiTail;
+    (*cart3DZ)(i) = cosThetaTail;
+  }
+  return {cart3DX, cart3DY, cart3DZ};
+}
+
 Array3TCoord EquirectangularProjection::toSphere(const Array2TCoord &cart2D) const {
   const TCoord sphericalPhi = -((cart2D.x() + m_pixelOffset) / TCoord(m_resolution.width)) * TCoord(2) * TCoord(M_PI);
   const TCoord sphericalTheta = ((cart2D.y() + m_pixelOffset) / TCoord(m_resolution.height)) * TCoord(M_PI);
@@ -228,13 +330,22 @@ Array3TCoord EquirectangularProjection::toSphere(const Array2TCoord &cart2D) con
 }
 
 ArrayXXTCoordPtrPair EquirectangularProjection::fromSphere(ArrayXXTCoordPtrTriple cart3D) const {
-  ArrayXXTCoordPtrTriple spherical = CoordinateConversion::cartesianToSpherical(cart3D);
-  ArrayXXTCoordPtr sphericalTheta = std::make_shared<ArrayXXTCoord>(*std::get<1>(spherical));
-  ArrayXXTCoordPtr sphericalPhi = std::make_shared<ArrayXXTCoord>(*std::get<2>(spherical));
-  ArrayXXBool condition = *sphericalPhi > 0;
-  sphericalPhi = std::make_shared<ArrayXXTCoord>(condition.select(*sphericalPhi - TCoord(2) * TCoord(M_PI), *sphericalPhi));
-  ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(-(*sphericalPhi / (TCoord(2) * TCoord(M_PI))) * TCoord(m_resolution.width) - m_pixelOffset);
-  ArrayXXTCoordPtr cart2DY = std::make_shared<ArrayXXTCoord>((*sphericalTheta / TCoord(M_PI)) * TCoord(m_resolution.height) - m_pixelOffset);
+  const ArrayXXTCoord &cart3DX = *std::get<0>(cart3D);
+  const Eigen::Index rows = cart3DX.rows();
+  const Eigen::Index cols = cart3DX.cols();
+  // The azimuth and polar angle are converted in place of the projected coordinates
+  ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(rows, cols);
+  ArrayXXTCoordPtr cart2DY = std::make_shared<ArrayXXTCoord>(rows, cols);
+  ArrayXXTCoord sphericalR(rows, cols);
+  g_coordOP.cartesianToSpherical(cart3DX.data(), std::get<1>(cart3D)->data(), std::get<2>(cart3D)->data(),
+                                 sphericalR.data(), cart2DY->data(), cart2DX->data(), int(cart3DX.size()));
+  TCoord *x = cart2DX->data();
+  TCoord *y = cart2DY->data();
+  for (Eigen::Index i = 0; i < cart3DX.size(); i++) {
+    const TCoord sphericalPhi = x[i] > 0 ? x[i] - TCoord(2) * TCoord(M_PI) : x[i];
+    x[i] = -(sphericalPhi / (TCoord(2) * TCoord(M_PI))) * TCoord(m_resolution.width) - m_pixelOffset;
+    y[i] = (y[i] / TCoord(M_PI)) * TCoord(m_resolution.height) - m_pixelOffset;
+  }
   return {cart2DX, cart2DY};
 }
 
@@ -247,3 +358,21 @@ Array2TCoord EquirectangularProjection::fromSphere(const Array3TCoord &cart3D) c
   const TCoord cart2DY = (sphericalTheta / TCoord(M_PI)) * TCoord(m_resolution.height) - m_pixelOffset;
   return {cart2DX, cart2DY};
 }
+
+Array3TCoord EquirectangularProjection::pointToSphere(const Array2TCoord &cart2D) const {
+  const TCoord sphericalPhi = -((cart2D.x() + m_pixelOffset) / TCoord(m_resolution.width)) * TCoord(2) * TCoord(M_PI);
+  const TCoord sphericalTheta = ((cart2D.y() + m_pixelOffset) / TCoord(m_resolution.height)) * TCoord(M_PI);
+  TCoord sinPhi, cosPhi, sinTheta, cosTheta;
+  CoordTrig::sincos(sphericalPhi, sinPhi, cosPhi);
+  CoordTrig::sincos(sphericalTheta, sinTheta, cosTheta);
+  return {sinTheta * cosPhi, sinTheta * sinPhi, cosTheta};
+}
+
+Array2TCoord EquirectangularProjection::pointFromSphere(const Array3TCoord &cart3D) const {
+  TCoord sphericalR, sphericalTheta, sphericalPhi;
+  g_coordOP.cartesianToSpherical(cart3D.data(), cart3D.data() + 1, cart3D.data() + 2, &sphericalR, &sphericalTheta, &sphericalPhi, 1);
+  sphericalPhi = sphericalPhi > 0 ? sphericalPhi - TCoord(2) * TCoord(M_PI) : sphericalPhi;
+  const TCoord cart2DX = -(sphericalPhi / (TCoord(2) * TCoord(M_PI))) * TCoord(m_resolution.width) - m_pixelOffset;
+  const TCoord cart2DY = (sphericalTheta / TCoord(M_PI)) * TCoord(m_resolution.height) - m_pixelOffset;
+  return {cart2DX, cart2DY};
+}
@@ -31,6 +31,11 @@ public:
   virtual ArrayXXTCoordPtrPair fromSphere(ArrayXXTCoordPtrTriple cart3D) const = 0;
   virtual Array2TCoord fromSphere(const Array3TCoord &cart3D) const = 0;
 
+  /// Single point variants of the array methods with identical results. The scalar toSphere() and fromSphere() use the
+  /// libm functions instead of the batched coordinate conversion and may differ in the last bits.
+  virtual Array3TCoord pointToSphere(const Array2TCoord &cart2D) const;
+  virtual Array2TCoord pointFromSphere(const Array3TCoord &cart3D) const;
+
   TCoord focalLength() const { return m_focalLength; }
 
 protected:
@@ -109,6 +114,10 @@ public:
   std::pair<ArrayXXTCoordPtrPair, ArrayXXBoolPtr> fromSphere(ArrayXXTCoordPtrTriple cart3D) const;
   std::pair<Array2TCoord, bool> fromSphere(const Array3TCoord &cart3D) const;
 
+  /// Single point variants of the array methods with identical results
+  Array3TCoord pointToSphere(const Array2TCoord &cart2D, bool virtualImagePlane) const;
+  std::pair<Array2TCoord, bool> pointFromSphere(const Array3TCoord &cart3D) const;
+
   ArrayXXTCoordPtr radius(ArrayXXTCoordPtr theta) const;
   TCoord radius(TCoord theta) const;
 
@@ -135,7 +144,18 @@ public:
   ArrayXXTCoordPtrPair fromSphere(ArrayXXTCoordPtrTriple cart3D) const override;
   Array2TCoord fromSphere(const Array3TCoord &cart3D) const override;
 
+  Array3TCoord pointToSphere(const Array2TCoord &cart2D) const override;
+  Array2TCoord pointFromSphere(const Array3TCoord &cart3D) const override;
+
+  TCoord pixelOffset() const { return m_pixelOffset; }
+
 protected:
+  /// True if x is constant along the columns and y along the rows, e.g. for the subblock grid of a block.
+  static bool isSeparableGrid(const ArrayXXTCoord &x, const ArrayXXTCoord &y);
+  /// toSphere of the grid spanned by the column coordinates x and row coordinates y. The azimuth depends on the
+  /// column and the polar angle on the row only, so the trigonometric functions are evaluated once per column and row.
+  ArrayXXTCoordPtrTriple toSphereSeparable(const ArrayXTCoord &x, const ArrayXTCoord &y) const;
+
   Size m_resolution;
   TCoord m_pixelOffset;
 };
@@ -0,0 +1,128 @@
+//
+// Bounded cache of reprojected subblock positions for the encoder's motion search.
+//
+
+#include "ReprojectionCache.h"
+#include "MVReprojection.h"
+
+#include <algorithm>
+
+bool ReprojectionCache::Key::operator==(const Key &other) const
+{
+  return x == other.x && y == other.y && width == other.width && height == other.height
+         && compID == other.compID && chromaFormat == other.chromaFormat && motionModel == other.motionModel
+         && mvHor == other.mvHor && mvVer == other.mvVer
+         && epipole[0] == other.epipole[0] && epipole[1] == other.epipole[1] && epipole[2] == other.epipole[2];
+}
+
+void ReprojectionCache::init(int numSlots, int numSubblocks)
+{
+  CHECK(numSlots & (numSlots - 1), "Number of cache slots must be a power of two.");
+  m_slots.assign(numSlots, Slot());
+  for (auto &slot : m_slots) {
+    slot.generation = 0;
+  }
+  m_pool.assign(4 * numSubblocks, 0);
+  m_generation = 1;
+  m_poolUsed = 0;
+}
+
+void ReprojectionCache::clear()
+{
+  m_generation++;
+  if (m_generation == 0) {
+    // Generation counter wrapped around, invalidate all slots explicitly
+    for (auto &slot : m_slots) {
+      slot.generation = 0;
+    }
+    m_generation = 1;
+  }
+  m_poolUsed = 0;
+}
+
+uint32_t ReprojectionCache::hash(const Key &key)
+{
+  const int *values = &key.x;
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < int(sizeof(Key) / sizeof(int)); i++) {
+    h = (h ^ uint32_t(values[i])) * 16777619u;
+  }
+  return h ^ (h >> 15);
+}
+
+bool ReprojectionCache::lookup(const Key &key, SubblockPositions &dst)
+{
+  m_stats.numLookups++;
+  const uint32_t mask = uint32_t(m_slots.size() - 1);
+  uint32_t idx = hash(key) & mask;
+  for (int probe = 0; probe < MAX_PROBES; probe++, idx = (idx + 1) & mask) {
+    const Slot &slot = m_slots[idx];
+    if (slot.generation != m_generation) {
+      return false;
+    }
+    if (slot.key == key) {
+      const int num = slot.rows * slot.cols;
+      const int *src = &m_pool[slot.offset * 4];
+      dst.rows = slot.rows;
+      dst.cols = slot.cols;
+      std::copy_n(src, num, dst.xPos);
+      std::copy_n(src + num, num, dst.yPos);
+      std::copy_n(src + 2 * num, num, dst.xFrac);
+      std::copy_n(src + 3 * num, num, dst.yFrac);
+      m_stats.numHits++;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ReprojectionCache::insert(const Key &key, const SubblockPositions &src)
+{
+  const int num = src.rows * src.cols;
+  if (4 * (m_poolUsed + num) > int(m_pool.size())) {
+    // Start over with the most recent results
+    m_stats.numFlushes++;
+    clear();
+  }
+  const uint32_t mask = uint32_t(m_slots.size() - 1);
+  uint32_t idx = hash(key) & mask;
+  for (int probe = 0; probe < MAX_PROBES; probe++, idx = (idx + 1) & mask) {
+    Slot &slot = m_slots[idx];
+    if (slot.generation != m_generation) {
+      slot.key = key;
+      slot.generation = m_generation;
+      slot.rows = src.rows;
+      slot.cols = src.cols;
+      slot.offset = m_poolUsed;
+      int *dst = &m_pool[m_poolUsed * 4];
+      std::copy_n(src.xPos, num, dst);
+      std::copy_n(src.yPos, num, dst + num);
+      std::copy_n(src.xFrac, num, dst + 2 * num);
+      std::copy_n(src.yFrac, num, dst + 3 * num);
+      m_poolUsed += num;
+      return;
+    }
+  }
+  // Probe window exhausted, start over with the most recent results
+  m_stats.numFlushes++;
+  clear();
+  insert(key, src);
+}
+
+ReprojectionCache::Statistics &ReprojectionCache::Statistics::operator+=(const Statistics &other)
+{
+  numLookups += other.numLookups;
+  numHits += other.numHits;
+  numFlushes += other.numFlushes;
+  return *this;
+}
+
+void ReprojectionCache::Statistics::print() const
+{
+  if (numLookups == 0) {
+    return;
+  }
+  msg(INFO, "\nReprojection cache: %llu lookups, %llu hits (%.2f %%), %llu flushes when full\n",
+      (unsigned long long) numLookups, (unsigned long long) numHits,
+      100.0 * double(numHits) / double(numLookups), (unsigned long long) numFlushes);
+}
@@ -0,0 +1,71 @@
+//
+// Bounded cache of reprojected subblock positions for the encoder's motion search.
+//
+
+#pragma once
+
+#include "CommonDef.h"
+
+#include <vector>
+
+struct SubblockPositions;
+
+/// Open addressing hash table of reprojected subblock positions keyed by block geometry, component, motion model,
+/// epipole and motion vector. The subblock positions of all entries share one preallocated pool. Entries are not
+/// evicted individually; when the table or the pool is full, the cache is flushed and refilled with the most recent
+/// results. The encoder additionally clears the cache at every CTU.
+class ReprojectionCache
+{
+public:
+  struct Key
+  {
+    int x, y, width, height;
+    int compID, chromaFormat, motionModel;
+    int mvHor, mvVer;
+    int epipole[3];  /**< Bit pattern of the epipole for GEODESIC_CAMPOSE, zero otherwise */
+
+    bool operator==(const Key &other) const;
+  };
+
+  struct Statistics
+  {
+    uint64_t numLookups{0};
+    uint64_t numHits{0};
+    uint64_t numFlushes{0};  /**< Clears because the table or the pool was full */
+
+    Statistics &operator+=(const Statistics &other);
+    void print() const;
+  };
+
+  ReprojectionCache(): m_generation(0), m_poolUsed(0) {}
+
+  void init(int numSlots, int numSubblocks);
+  bool isInitialized() const { return !m_slots.empty(); }
+  void clear();
+
+  bool lookup(const Key &key, SubblockPositions &dst);
+  void insert(const Key &key, const SubblockPositions &src);
+
+  const Statistics &getStatistics() const { return m_stats; }
+  void printStatistics() const { m_stats.print(); }
+
+protected:
+  static uint32_t hash(const Key &key);
+
+  struct Slot
+  {
+    Key key;
+    uint32_t generation;  /**< Slot is valid if equal to the cache generation */
+    int rows, cols;
+    int offset;  /**< First subblock in the pool */
+  };
+
+  static const int MAX_PROBES = 8;
+
+  std::vector<Slot> m_slots;
+  std::vector<int> m_pool;  /**< xPos, yPos, xFrac, yFrac per subblock */
+  uint32_t m_generation;
+  int m_poolUsed;
+
+  Statistics m_stats;
+};
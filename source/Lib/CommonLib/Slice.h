@@ -1924,6 +1924,7 @@ void                    setCCALFEnabledFlag( bool b )
   // Multi-Model
   bool      getUseMultiModel() const { return m_mmConfig->getUseMultiModel(); }
   std::vector<MotionModelID> getActiveMotionModels() const { return m_mmConfig->getActiveMotionModels(); }
+  int       getActiveMotionModels(MotionModelID *models) const { return m_mmConfig->getActiveMotionModels(models); }
   void      setUseMPA(bool b) { m_mmConfig->MPA = b; }
   bool      getUseMPA() const { return m_mmConfig->MPA; }
   void      setUse3DT(bool b) { m_mmConfig->T3D = b; }
@@ -1940,6 +1941,10 @@ void                    setCCALFEnabledFlag( bool b )
   GeodesicMotionModel::Flavor getGEDFlavor() const { return m_mmConfig->GEDFlavor; }
   void      setUseMMMVP(bool b) { m_mmConfig->MMMVP = b; }
   bool      getUseMMMVP() const { return m_mmConfig->MMMVP; }
+  void      setUseMMFixedPoint(bool b) { m_mmConfig->MMFixedPoint = b; }
+  bool      getUseMMFixedPoint() const { return m_mmConfig->MMFixedPoint; }
+  void      setUseMMDMVRWindow(bool b) { m_mmConfig->MMDMVRWindow = b; }
+  bool      getUseMMDMVRWindow() const { return m_mmConfig->MMDMVRWindow; }
   void      setMMOffset4x4(int value) { m_mmConfig->MMOffset4x4 = value; }
   int       getMMOffset4x4() const { return m_mmConfig->MMOffset4x4; }
   void      setProjectionFct(int value) { m_mmConfig->projectionFct = value; }
@@ -0,0 +1,51 @@
+//
+// Frame-wide sphere coordinates of the subblock origins used for motion vector reprojection.
+//
+
+#include "SphereTable.h"
+
+void SphereTable::fill(const Projection *projection, const Size &resolution, TCoord offset4x4)
+{
+  m_rows = int(resolution.height / 4);
+  m_cols = int(resolution.width / 4);
+
+  m_cart2D[0] = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, 1, Eigen::Dynamic>::LinSpaced(m_cols, offset4x4, TCoord(resolution.width - 4) + offset4x4).replicate(m_rows, 1));
+  m_cart2D[1] = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, Eigen::Dynamic, 1>::LinSpaced(m_rows, offset4x4, TCoord(resolution.height - 4) + offset4x4).replicate(1, m_cols));
+
+  const ArrayXXTCoordPtrTriple cart3D = projection->toSphere(cart2D());
+  m_cart3D[0] = std::get<0>(cart3D);
+  m_cart3D[1] = std::get<1>(cart3D);
+  m_cart3D[2] = std::get<2>(cart3D);
+
+  const ArrayXXTCoordPtrTriple spherical = CoordinateConversion::cartesianToSpherical(cart3D);
+  m_spherical[0] = std::get<1>(spherical);
+  m_spherical[1] = std::get<2>(spherical);
+}
+
+ArrayXXTCoordPtr SphereTable::block(const ArrayXXTCoordPtr &plane, const Position &position, const Size &size) const
+{
+  CHECK(position.x + size.width > m_cols || position.y + size.height > m_rows, "Block exceeds the sphere table.");
+  return std::make_shared<ArrayXXTCoord>(plane->block(position.y, position.x, size.height, size.width));
+}
+
+ArrayXXTCoordPtrPair SphereTable::cart2D(const Position &position, const Size &size) const
+{
+  return {block(m_cart2D[0], position, size), block(m_cart2D[1], position, size)};
+}
+
+ArrayXXTCoordPtrTriple SphereTable::cart3D(const Position &position, const Size &size) const
+{
+  return ArrayXXTCoordPtrTriple(block(m_cart3D[0], position, size), block(m_cart3D[1], position, size), block(m_cart3D[2], position, size));
+}
+
+ArrayXXTCoordPtrPair SphereTable::spherical(const Position &position, const Size &size) const
+{
+  return {block(m_spherical[0], position, size), block(m_spherical[1], position, size)};
+}
+
+bool SphereTable::isBlockExact(const Position &position, const Size &size) const
+{
+  const int blockSize = int(size.area());
+  const int lastIndex = (position.x + int(size.width) - 1) * m_rows + position.y + int(size.height) - 1;
+  return CoordTrig::packetEnd(blockSize) == blockSize && lastIndex < CoordTrig::packetEnd(m_rows * m_cols);
+}
@@ -0,0 +1,46 @@
+//
+// Frame-wide sphere coordinates of the subblock origins used for motion vector reprojection.
+//
+
+#pragma once
+
+#include "Coordinate.h"
+#include "Projection.h"
+#include "Unit.h"
+
+/// Table of the subblock origins of a projected picture in 2D projection, unit sphere cartesian and spherical
+/// coordinates. The origins lie on the 4x4 luma subblock grid, which is shared by all components and chroma formats
+/// as a chroma subblock always covers 4x4 luma samples. Positions and sizes are given in units of subblocks.
+class SphereTable
+{
+public:
+  SphereTable(): m_rows(0), m_cols(0) {}
+
+  void fill(const Projection *projection, const Size &resolution, TCoord offset4x4);
+  bool isFilled() const { return m_rows > 0; }
+  int rows() const { return m_rows; }
+  int cols() const { return m_cols; }
+
+  /** Full-frame planes */
+  ArrayXXTCoordPtrPair cart2D() const { return {m_cart2D[0], m_cart2D[1]}; }
+  ArrayXXTCoordPtrTriple cart3D() const { return ArrayXXTCoordPtrTriple(m_cart3D[0], m_cart3D[1], m_cart3D[2]); }
+
+  /** Block copies */
+  ArrayXXTCoordPtrPair cart2D(const Position &position, const Size &size) const;
+  ArrayXXTCoordPtrTriple cart3D(const Position &position, const Size &size) const;
+  /** @return Polar angle theta and azimuth phi */
+  ArrayXXTCoordPtrPair spherical(const Position &position, const Size &size) const;
+  /** Whether the block copies are identical to the conversions of the block on its own. The vectorized and scalar
+      functions of the conversions differ in the last bits (see CoordTrig), so this only holds if the vectorized
+      functions are applied to all elements in both cases. */
+  bool isBlockExact(const Position &position, const Size &size) const;
+
+protected:
+  ArrayXXTCoordPtr block(const ArrayXXTCoordPtr &plane, const Position &position, const Size &size) const;
+
+  int m_rows;
+  int m_cols;
+  ArrayXXTCoordPtr m_cart2D[2];     /**< Subblock origins in the projection */
+  ArrayXXTCoordPtr m_cart3D[3];     /**< Subblock origins on the unit sphere */
+  ArrayXXTCoordPtr m_spherical[2];  /**< Polar angle and azimuth of the subblock origins */
+};
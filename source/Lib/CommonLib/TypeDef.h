@@ -188,6 +188,11 @@ typedef std::pair<int, int>  TrCost;
 #endif
 #endif
 
+// This can be enabled by the makefile
+#ifndef MM_FAST_TRIG
+#define MM_FAST_TRIG                                      0 ///< 0 (default): the reprojection of the motion models uses the vectorized trigonometric functions of Eigen and the C library for the trailing array elements, 1: polynomial approximations (FastTrig). NORMATIVE: 1 changes the reprojected sample positions and hence the decoded output of multi-model bitstreams, encoder and decoder have to be built with the same setting
+#endif
+
 // SIMD optimizations
 #define SIMD_ENABLE                                       1                                                 ///< Enable SIMD optimizations if available on compilation environment
 #ifdef TARGET_SIMD_X86
@@ -200,6 +205,7 @@ typedef std::pair<int, int>  TrCost;
 #define ENABLE_SIMD_OPT_DIST                            ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the distortion calculations(SAD,SSE,HADAMARD), no impact on RD performance
 #define ENABLE_SIMD_OPT_AFFINE_ME                       ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for affine ME, no impact on RD performance
 #define ENABLE_SIMD_OPT_ALF                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for ALF
+#define ENABLE_SIMD_OPT_COORDINATE                      ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the batched coordinate conversion of the projections, bit-exact with the scalar path
 #if ENABLE_SIMD_OPT_BUFFER
 #define ENABLE_SIMD_OPT_BCW                               1                                                 ///< SIMD optimization for Bcw
 #endif
@@ -768,6 +774,7 @@ enum FastInterSearchMode
 enum SPSExtensionFlagIndex
 {
   SPS_EXT__REXT           = 0,
+  SPS_EXT__MM             = 1, ///< multi-model extension, carries the multi-model syntax elements added after the first version
   NUM_SPS_EXTENSION_FLAGS = 8
 };
 
@@ -2162,6 +2162,103 @@ void PU::fillIBCMvpCand(PredictionUnit &pu, AMVPInfo &amvpInfo)
 }
 
 
+/// Order the active motion models of the PU by the motion model prediction of mmPredType, returns their number
+int PU::getMotionModelCandidates(const PredictionUnit &pu, const int mmPredType, MotionModelID *candidates)
+{
+  const Slice &slice = *pu.cs->slice;
+  const int numCandidates = pu.cs->sps->getActiveMotionModels(candidates);
+
+  MotionModelID mmPred = INVALID;
+  switch (mmPredType)
+  {
+  case 0:   // none
+    return numCandidates;
+  case 1:   // center-point
+  {
+    const Position blockCenter = pu.lumaPos().offset(int(pu.lumaSize().width / 2), int(pu.lumaSize().height / 2));
+    mmPred = slice.getRefPic(RefPicList(slice.isInterB() ? 1 - slice.getColFromL0Flag() : 0), int(slice.getColRefIdx()))
+               ->cs->getMotionInfo(blockCenter)
+               .motionModel[RefPicList(slice.getColFromL0Flag())];
+    break;
+  }
+  case 2:   // voted
+  {
+    const Picture *const pColPic =
+      slice.getRefPic(RefPicList(slice.isInterB() ? 1 - slice.getColFromL0Flag() : 0), int(slice.getColRefIdx()));
+    const RefPicList eColRefPicList = slice.getCheckLDC() ? REF_PIC_LIST_0 : RefPicList(slice.getColFromL0Flag());
+    int votes[NUM_MODELS + 1];
+    pColPic->countMotionModels(pu.Y(), eColRefPicList, votes);
+
+    // Most votes, the lowest motion model id wins ties
+    int maxVotes = 0;
+    for (int i = 0; i <= NUM_MODELS; i++)
+    {
+      if (votes[i] > maxVotes)
+      {
+        maxVotes = votes[i];
+        mmPred   = MotionModelID(i - 1);
+      }
+    }
+    break;
+  }
+  case 3:   // sorted
+  {
+    const Picture *const pColPic =
+      slice.getRefPic(RefPicList(slice.isInterB() ? 1 - slice.getColFromL0Flag() : 0), int(slice.getColRefIdx()));
+    const RefPicList eColRefPicList = slice.getCheckLDC() ? REF_PIC_LIST_0 : RefPicList(slice.getColFromL0Flag());
+    Area votingArea(pu.lumaPos(), pu.lumaSize());
+
+    // Ensure minimum voting area size
+    if (votingArea.width < 32) {
+      votingArea.x -= (32 - int(votingArea.width)) >> 1;
+      votingArea.width = 32;
+      if (votingArea.x < 0) {
+        votingArea.width = votingArea.width + votingArea.x;
+        votingArea.x = 0;
+      }
+      if (votingArea.x + votingArea.width > slice.getPic()->lwidth()) {
+        votingArea.width -= (votingArea.x + votingArea.width) - slice.getPic()->lwidth();
+      }
+    }
+    if (votingArea.height < 32) {
+      votingArea.y -= (32 - int(votingArea.height)) >> 1;
+      votingArea.height = 32;
+      if (votingArea.y < 0) {
+        votingArea.height = votingArea.height + votingArea.y;
+        votingArea.y = 0;
+      }
+      if (votingArea.y + votingArea.height > slice.getPic()->lheight()) {
+        votingArea.height -= (votingArea.y + votingArea.height) - slice.getPic()->lheight();
+      }
+    }
+    int votes[NUM_MODELS + 1];
+    pColPic->countMotionModels(votingArea, eColRefPicList, votes);
+
+    // Stable sort by vote, candidates with equal votes keep their order
+    for (int i = 1; i < numCandidates; i++)
+    {
+      const MotionModelID candidate = candidates[i];
+      int j = i;
+      for (; j > 0 && votes[candidates[j - 1] + 1] < votes[candidate + 1]; j--)
+      {
+        candidates[j] = candidates[j - 1];
+      }
+      candidates[j] = candidate;
+    }
+    return numCandidates;
+  }
+  default: CHECK(true, "Invalid mmPredType '" + std::to_string(mmPredType) + "'.");
+  }
+
+  // Place mmPred at front
+  MotionModelID *mmPredIt = std::find(candidates, candidates + numCandidates, mmPred);
+  if (mmPredIt != candidates + numCandidates)
+  {
+    std::rotate(candidates, mmPredIt, mmPredIt + 1);
+  }
+  return numCandidates;
+}
+
 /** Constructs a list of candidates for AMVP (See specification, section "Derivation process for motion vector predictor candidates")
 * \param uiPartIdx
 * \param uiPartAddr
@@ -2169,7 +2266,7 @@ void PU::fillIBCMvpCand(PredictionUnit &pu, AMVPInfo &amvpInfo)
 * \param iRefIdx
 * \param pInfo
 */
-void PU::fillMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, AMVPInfo &amvpInfo, MVReprojection* mvReprojection)
+void PU::fillMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, AMVPInfo &amvpInfo, MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext)
 {
   CodingStructure &cs = *pu.cs;
 
@@ -2192,26 +2289,26 @@ void PU::fillMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const in
   bool &allCandSolidInAbove = amvpInfo.allCandSolidInAbove;
 #endif
   {
-    bool added = addMVPCandUnscaled( pu, eRefPicList, refIdx, posLB, MD_BELOW_LEFT, *pInfo, mvReprojection );
+    bool added = addMVPCandUnscaled( pu, eRefPicList, refIdx, posLB, MD_BELOW_LEFT, *pInfo, mvReprojection, mvReprojectionContext );
 
     if (!added)
     {
-      added = addMVPCandUnscaled( pu, eRefPicList, refIdx, posLB, MD_LEFT, *pInfo, mvReprojection );
+      added = addMVPCandUnscaled( pu, eRefPicList, refIdx, posLB, MD_LEFT, *pInfo, mvReprojection, mvReprojectionContext );
 
     }
   }
 
   // Above predictor search
   {
-    bool added = addMVPCandUnscaled( pu, eRefPicList, refIdx, posRT, MD_ABOVE_RIGHT, *pInfo, mvReprojection );
+    bool added = addMVPCandUnscaled( pu, eRefPicList, refIdx, posRT, MD_ABOVE_RIGHT, *pInfo, mvReprojection, mvReprojectionContext );
 
     if (!added)
     {
-      added = addMVPCandUnscaled( pu, eRefPicList, refIdx, posRT, MD_ABOVE, *pInfo, mvReprojection );
+      added = addMVPCandUnscaled( pu, eRefPicList, refIdx, posRT, MD_ABOVE, *pInfo, mvReprojection, mvReprojectionContext );
 
       if (!added)
       {
-        addMVPCandUnscaled( pu, eRefPicList, refIdx, posLT, MD_ABOVE_LEFT, *pInfo, mvReprojection );
+        addMVPCandUnscaled( pu, eRefPicList, refIdx, posLT, MD_ABOVE_LEFT, *pInfo, mvReprojection, mvReprojectionContext );
       }
     }
   }
@@ -2271,7 +2368,7 @@ void PU::fillMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const in
         cColMv =
           mvReprojection->motionVectorInDesiredMotionModel(posC0, cColMv, eColMotionModel, pu.motionModel[eRefPicList],
                                                            MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-                                                           colCurPOC, colRefPOC, curPOC, refPOC, colBlockPos, colBlockSize, pu.lumaPos(), pu.lumaSize());
+                                                           colCurPOC, colRefPOC, curPOC, refPOC, colBlockPos, colBlockSize, pu.lumaPos(), pu.lumaSize(), mvReprojectionContext);
       }
 #if GDR_ENABLED
       if (isEncodeGdrClean)
@@ -2301,7 +2398,7 @@ void PU::fillMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const in
         cColMv =
           mvReprojection->motionVectorInDesiredMotionModel(posC1, cColMv, eColMotionModel, pu.motionModel[eRefPicList],
                                                            MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-                                                           colCurPOC, colRefPOC, curPOC, refPOC, colBlockPos, colBlockSize, pu.lumaPos(), pu.lumaSize());
+                                                           colCurPOC, colRefPOC, curPOC, refPOC, colBlockPos, colBlockSize, pu.lumaPos(), pu.lumaSize(), mvReprojectionContext);
       }
 #if GDR_ENABLED
       if (isEncodeGdrClean)
@@ -2329,7 +2426,7 @@ void PU::fillMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const in
   if (pInfo->numCand < AMVP_MAX_NUM_CANDS)
   {
     const int currRefPOC = cs.slice->getRefPic(eRefPicList, refIdx)->getPOC();
-    addAMVPHMVPCand(pu, eRefPicList, currRefPOC, *pInfo, mvReprojection);
+    addAMVPHMVPCand(pu, eRefPicList, currRefPOC, *pInfo, mvReprojection, mvReprojectionContext);
   }
 
   if (pInfo->numCand > AMVP_MAX_NUM_CANDS)
@@ -2663,7 +2760,7 @@ void PU::xInheritedAffineMv( const PredictionUnit &pu, const PredictionUnit* puN
 }
 
 
-void PU::fillAffineMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, AffineAMVPInfo &affiAMVPInfo, MVReprojection* mvReprojection)
+void PU::fillAffineMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, AffineAMVPInfo &affiAMVPInfo, MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext)
 {
   CHECK(pu.motionModel[eRefPicList] != CLASSIC, "Motion model must be 'CLASSIC' for affine MVP candidate derivation.")
   affiAMVPInfo.numCand = 0;
@@ -2748,14 +2845,14 @@ void PU::fillAffineMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, co
 #endif
 
   // A->C: Above Left, Above, Left
-  addMVPCandUnscaled( pu, eRefPicList, refIdx, posLT, MD_ABOVE_LEFT, amvpInfo0, mvReprojection );
+  addMVPCandUnscaled( pu, eRefPicList, refIdx, posLT, MD_ABOVE_LEFT, amvpInfo0, mvReprojection, mvReprojectionContext );
   if ( amvpInfo0.numCand < 1 )
   {
-    addMVPCandUnscaled( pu, eRefPicList, refIdx, posLT, MD_ABOVE, amvpInfo0, mvReprojection );
+    addMVPCandUnscaled( pu, eRefPicList, refIdx, posLT, MD_ABOVE, amvpInfo0, mvReprojection, mvReprojectionContext );
   }
   if ( amvpInfo0.numCand < 1 )
   {
-    addMVPCandUnscaled( pu, eRefPicList, refIdx, posLT, MD_LEFT, amvpInfo0, mvReprojection );
+    addMVPCandUnscaled( pu, eRefPicList, refIdx, posLT, MD_LEFT, amvpInfo0, mvReprojection, mvReprojectionContext );
   }
   cornerMVPattern = cornerMVPattern | amvpInfo0.numCand;
 
@@ -2776,10 +2873,10 @@ void PU::fillAffineMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, co
 #endif
 
   // D->E: Above, Above Right
-  addMVPCandUnscaled( pu, eRefPicList, refIdx, posRT, MD_ABOVE, amvpInfo1, mvReprojection );
+  addMVPCandUnscaled( pu, eRefPicList, refIdx, posRT, MD_ABOVE, amvpInfo1, mvReprojection, mvReprojectionContext );
   if ( amvpInfo1.numCand < 1 )
   {
-    addMVPCandUnscaled( pu, eRefPicList, refIdx, posRT, MD_ABOVE_RIGHT, amvpInfo1, mvReprojection );
+    addMVPCandUnscaled( pu, eRefPicList, refIdx, posRT, MD_ABOVE_RIGHT, amvpInfo1, mvReprojection, mvReprojectionContext );
   }
   cornerMVPattern = cornerMVPattern | (amvpInfo1.numCand << 1);
 
@@ -2800,10 +2897,10 @@ void PU::fillAffineMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, co
 #endif
 
   // F->G: Left, Below Left
-  addMVPCandUnscaled( pu, eRefPicList, refIdx, posLB, MD_LEFT, amvpInfo2, mvReprojection );
+  addMVPCandUnscaled( pu, eRefPicList, refIdx, posLB, MD_LEFT, amvpInfo2, mvReprojection, mvReprojectionContext );
   if ( amvpInfo2.numCand < 1 )
   {
-    addMVPCandUnscaled( pu, eRefPicList, refIdx, posLB, MD_BELOW_LEFT, amvpInfo2, mvReprojection );
+    addMVPCandUnscaled( pu, eRefPicList, refIdx, posLB, MD_BELOW_LEFT, amvpInfo2, mvReprojection, mvReprojectionContext );
   }
   cornerMVPattern = cornerMVPattern | (amvpInfo2.numCand << 2);
 
@@ -2931,7 +3028,7 @@ void PU::fillAffineMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, co
         {
           cColMv = mvReprojection->motionVectorInDesiredMotionModel(
             posC0, cColMv, eColMotionModel, CLASSIC, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-            colCurPOC, colRefPOC, curPOC, refPOC, colBlockPos, colBlockSize, pu.lumaPos(), pu.lumaSize());
+            colCurPOC, colRefPOC, curPOC, refPOC, colBlockPos, colBlockSize, pu.lumaPos(), pu.lumaSize(), mvReprojectionContext);
         }
         cColMv.roundAffinePrecInternal2Amvr(pu.cu->imv);
         affiAMVPInfo.mvCandLT[affiAMVPInfo.numCand] = cColMv;
@@ -2991,7 +3088,7 @@ void PU::fillAffineMvpCand(PredictionUnit &pu, const RefPicList &eRefPicList, co
         {
           cColMv = mvReprojection->motionVectorInDesiredMotionModel(
             posC1, cColMv, eColMotionModel, CLASSIC, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-            colCurPOC, colRefPOC, curPOC, refPOC, colBlockPos, colBlockSize, pu.lumaPos(), pu.lumaSize());
+            colCurPOC, colRefPOC, curPOC, refPOC, colBlockPos, colBlockSize, pu.lumaPos(), pu.lumaSize(), mvReprojectionContext);
         }
         cColMv.roundAffinePrecInternal2Amvr(pu.cu->imv);
         affiAMVPInfo.mvCandLT[affiAMVPInfo.numCand] = cColMv;
@@ -3091,7 +3188,7 @@ bool PU::addMVPCandUnscaled(const PredictionUnit &pu,
                             const Position &pos,
                             const MvpDir &eDir,
                             AMVPInfo &info,
-                            MVReprojection* mvReprojection)
+                            MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext)
 {
   CodingStructure &cs = *pu.cs;
 
@@ -3164,7 +3261,7 @@ bool PU::addMVPCandUnscaled(const PredictionUnit &pu,
                                                               neibPU->cu->slice->getPOC(), neibPU->cu->slice->getRefPOC(eRefPicListIndex, neibRefIdx),
                                                               pu.cu->slice->getPOC(), currRefPOC,
                                                               neibMi.blockPos[eRefPicListIndex], neibMi.blockSize[eRefPicListIndex],
-                                                              pu.lumaPos(), pu.lumaSize());
+                                                              pu.lumaPos(), pu.lumaSize(), mvReprojectionContext);
       }
       info.mvCand[info.numCand++] = mv;
       return true;
@@ -3175,7 +3272,7 @@ bool PU::addMVPCandUnscaled(const PredictionUnit &pu,
 }
 
 
-void PU::addAMVPHMVPCand(const PredictionUnit &pu, const RefPicList eRefPicList, const int currRefPOC, AMVPInfo &info, MVReprojection* mvReprojection)
+void PU::addAMVPHMVPCand(const PredictionUnit &pu, const RefPicList eRefPicList, const int currRefPOC, AMVPInfo &info, MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext)
 {
   const Slice &slice = *(*pu.cs).slice;
 
@@ -3467,7 +3564,35 @@ const int getAvailableAffineNeighboursForAbovePredictor( const PredictionUnit &p
   return num;
 }
 
-void PU::getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx, const MVReprojection* mvReprojection, const int mrgCandIdx )
+/// Convert the motion of a spatial neighbour in both reference picture lists to the classic motion model
+static void convertNeighbourMvsToClassic(const PredictionUnit &pu, const PredictionUnit &puNeigh, const Position &pos, MotionInfo &mi,
+                                         const MVReprojection *mvReprojection, MVReprojectionContext &mvReprojectionContext)
+{
+  // For neighboring PUs, curPOC is identical as both belong to the same slice.
+  // For neighboring PUs, refPOC is identical as both share the ref pic list and the ref idx is taken over from the neighboring PU in merge mode.
+  const Slice &slice = *pu.cs->slice;
+  MvConversion conversions[NUM_REF_PIC_LIST_01];
+  for (int l = 0; l < NUM_REF_PIC_LIST_01; l++)
+  {
+    MvConversion &conversion = conversions[l];
+    conversion.valid = true;
+    conversion.position = pos;
+    conversion.mv = mi.mv[l];
+    conversion.motionModelID = mi.motionModel[l];
+    conversion.curPOCOrig = conversion.curPOCDesired = slice.getPOC();
+    conversion.refPOCOrig = conversion.refPOCDesired = slice.getRefPOC(RefPicList(l), puNeigh.refIdx[l]);
+    conversion.blockPos = mi.blockPos[l];
+    conversion.blockSize = mi.blockSize[l];
+  }
+  mvReprojection->motionVectorsInDesiredMotionModel(conversions, NUM_REF_PIC_LIST_01, CLASSIC, MV_FRACTIONAL_BITS_INTERNAL,
+                                                    MV_FRACTIONAL_BITS_INTERNAL, pu.lumaPos(), pu.lumaSize(), mvReprojectionContext);
+  for (int l = 0; l < NUM_REF_PIC_LIST_01; l++)
+  {
+    mi.mv[l] = conversions[l].mv;
+  }
+}
+
+void PU::getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx, const MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext, const int mrgCandIdx )
 {
   const CodingStructure &cs = *pu.cs;
   const Slice &slice = *pu.cs->slice;
@@ -3704,17 +3829,7 @@ void PU::getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx
 
           if(slice.getSPS()->getUseMultiModel()) {
             if (slice.getSPS()->getUseMMMVP()) {
-              // For neighboring PUs, curPOC is identical as both belong to the same slice.
-              // For neighboring PUs, refPOC is identical as both share the ref pic list and the ref idx is taken over from the neighboring PU in merge mode.
-              int curPOC = slice.getPOC();
-              int refPOC0 = slice.getRefPOC(REF_PIC_LIST_0, puNeigh->refIdx[0]);
-              int refPOC1 = slice.getRefPOC(REF_PIC_LIST_1, puNeigh->refIdx[1]);
-              mi[0].mv[0] = mvReprojection->motionVectorInDesiredMotionModel(
-                pos, mi[0].mv[0], mi[0].motionModel[0], CLASSIC, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-                curPOC, refPOC0, curPOC, refPOC0, mi[0].blockPos[0], mi[0].blockSize[0], pu.lumaPos(), pu.lumaSize());
-              mi[0].mv[1] = mvReprojection->motionVectorInDesiredMotionModel(
-                pos, mi[0].mv[1], mi[0].motionModel[1], CLASSIC, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-                curPOC, refPOC1, curPOC, refPOC1, mi[0].blockPos[1], mi[0].blockSize[1], pu.lumaPos(), pu.lumaSize());
+              convertNeighbourMvsToClassic(pu, *puNeigh, pos, mi[0], mvReprojection, mvReprojectionContext);
             }
             mi[0].motionModel[0] = CLASSIC;
             mi[0].motionModel[1] = CLASSIC;
@@ -3745,15 +3860,7 @@ void PU::getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx
 
           if(slice.getSPS()->getUseMultiModel()) {
             if(slice.getSPS()->getUseMMMVP()) {
-              int curPOC = slice.getPOC();
-              int refPOC0 = slice.getRefPOC(REF_PIC_LIST_0, puNeigh->refIdx[0]);
-              int refPOC1 = slice.getRefPOC(REF_PIC_LIST_1, puNeigh->refIdx[1]);
-              mi[1].mv[0] = mvReprojection->motionVectorInDesiredMotionModel(
-                pos, mi[1].mv[0], mi[1].motionModel[0], CLASSIC, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-                curPOC, refPOC0, curPOC, refPOC0, mi[1].blockPos[0], mi[1].blockSize[0], pu.lumaPos(), pu.lumaSize());
-              mi[1].mv[1] = mvReprojection->motionVectorInDesiredMotionModel(
-                pos, mi[1].mv[1], mi[1].motionModel[1], CLASSIC, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-                curPOC, refPOC1, curPOC, refPOC1, mi[1].blockPos[1], mi[1].blockSize[1], pu.lumaPos(), pu.lumaSize());
+              convertNeighbourMvsToClassic(pu, *puNeigh, pos, mi[1], mvReprojection, mvReprojectionContext);
             }
             mi[1].motionModel[0] = CLASSIC;
             mi[1].motionModel[1] = CLASSIC;
@@ -3783,15 +3890,7 @@ void PU::getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx
 
           if(slice.getSPS()->getUseMultiModel()) {
             if(slice.getSPS()->getUseMMMVP()) {
-              int curPOC = slice.getPOC();
-              int refPOC0 = slice.getRefPOC(REF_PIC_LIST_0, puNeigh->refIdx[0]);
-              int refPOC1 = slice.getRefPOC(REF_PIC_LIST_1, puNeigh->refIdx[1]);
-              mi[2].mv[0] = mvReprojection->motionVectorInDesiredMotionModel(
-                pos, mi[2].mv[0], mi[2].motionModel[0], CLASSIC, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-                curPOC, refPOC0, curPOC, refPOC0, mi[2].blockPos[0], mi[2].blockSize[0], pu.lumaPos(), pu.lumaSize());
-              mi[2].mv[1] = mvReprojection->motionVectorInDesiredMotionModel(
-                pos, mi[2].mv[1], mi[2].motionModel[1], CLASSIC, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-                curPOC, refPOC1, curPOC, refPOC1, mi[2].blockPos[1], mi[2].blockSize[1], pu.lumaPos(), pu.lumaSize());
+              convertNeighbourMvsToClassic(pu, *puNeigh, pos, mi[2], mvReprojection, mvReprojectionContext);
             }
             mi[2].motionModel[0] = CLASSIC;
             mi[2].motionModel[1] = CLASSIC;
@@ -3856,7 +3955,7 @@ void PU::getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx
             if(slice.getSPS()->getUseMMMVP()) {
               mi[3].mv[0] = mvReprojection->motionVectorInDesiredMotionModel(
                 posC0, mi[3].mv[0], mi[3].motionModel[0], CLASSIC, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
-                colCurPOC, colRefPOC, curPOC, refPOC, mi[3].blockPos[0], mi[3].blockSize[0], pu.lumaPos(), pu.lumaSize());
+                colCurPOC, colRefPOC, curPOC, refPOC, mi[3].blockPos[0], mi[3].blockSize[0], pu.lumaPos(), pu.lumaSize(), mvReprojectionContext);
             }
             mi[3].motionModel[0] = CLASSIC;
           }
@@ -3891,7 +3990,7 @@ void PU::getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx
                                                                                CLASSIC,
                                                                                MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
                                                                                colCurPOC, colRefPOC, curPOC, refPOC, mi[3].blockPos[1], mi[3].blockSize[1],
-                                                                               pu.lumaPos(), pu.lumaSize());
+                                                                               pu.lumaPos(), pu.lumaSize(), mvReprojectionContext);
               }
               mi[3].motionModel[1] = CLASSIC;
             }
@@ -4428,7 +4527,7 @@ void PU::applyImv( PredictionUnit& pu, MergeCtx &mrgCtx, InterPrediction *interP
         PU::fillIBCMvpCand(pu, amvpInfo);
       }
       else
-      PU::fillMvpCand(pu, REF_PIC_LIST_0, pu.refIdx[0], amvpInfo, interPred->getMVReprojection());
+      PU::fillMvpCand(pu, REF_PIC_LIST_0, pu.refIdx[0], amvpInfo, interPred->getMVReprojection(), interPred->getMVReprojectionContext());
       pu.mvpNum[0] = amvpInfo.numCand;
       pu.mvpIdx[0] = mvpIdx;
       pu.mv[0]     = amvpInfo.mvCand[mvpIdx] + pu.mvd[0];
@@ -4443,7 +4542,7 @@ void PU::applyImv( PredictionUnit& pu, MergeCtx &mrgCtx, InterPrediction *interP
       }
       unsigned mvpIdx = pu.mvpIdx[1];
       AMVPInfo amvpInfo;
-      PU::fillMvpCand(pu, REF_PIC_LIST_1, pu.refIdx[1], amvpInfo, interPred->getMVReprojection());
+      PU::fillMvpCand(pu, REF_PIC_LIST_1, pu.refIdx[1], amvpInfo, interPred->getMVReprojection(), interPred->getMVReprojectionContext());
       pu.mvpNum[1] = amvpInfo.numCand;
       pu.mvpIdx[1] = mvpIdx;
       pu.mv[1]     = amvpInfo.mvCand[mvpIdx] + pu.mvd[1];
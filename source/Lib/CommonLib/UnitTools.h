@@ -157,10 +157,11 @@ namespace PU
   bool getColocatedMVP                (const PredictionUnit &pu, const RefPicList &eRefPicList, const Position &pos, Mv& rcMv,
                        MotionModelID &reMotionModel, int &curPOC, int &refPOC, int &colCurPOC, int &colRefPOC,
                        Position &neighborBlockPos, Size &neighborBlockSize, const int &refIdx, bool sbFlag);
-  void fillMvpCand                    (      PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, AMVPInfo &amvpInfo, MVReprojection* mvReprojection );
+  int  getMotionModelCandidates       (const PredictionUnit &pu, const int mmPredType, MotionModelID *candidates);
+  void fillMvpCand                    (      PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, AMVPInfo &amvpInfo, MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext );
   void fillIBCMvpCand                 (PredictionUnit &pu, AMVPInfo &amvpInfo);
-  void fillAffineMvpCand              (      PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, AffineAMVPInfo &affiAMVPInfo, MVReprojection* mvReprojection);
-  bool addMVPCandUnscaled             (const PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, const Position &pos, const MvpDir &eDir, AMVPInfo &amvpInfo, MVReprojection* mvReprojection);
+  void fillAffineMvpCand              (      PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, AffineAMVPInfo &affiAMVPInfo, MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext);
+  bool addMVPCandUnscaled             (const PredictionUnit &pu, const RefPicList &eRefPicList, const int &refIdx, const Position &pos, const MvpDir &eDir, AMVPInfo &amvpInfo, MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext);
 #if GDR_ENABLED
   void xInheritedAffineMv(const PredictionUnit &pu, const PredictionUnit* puNeighbour, RefPicList eRefPicList, Mv rcMv[3], bool rcMvSolid[3], MvpType rcMvType[3], Position rcMvPos[3]);
 #endif
@@ -174,7 +175,7 @@ namespace PU
     , bool &allCandSolidInAbove
 #endif
   );
-  void addAMVPHMVPCand                (const PredictionUnit &pu, const RefPicList eRefPicList, const int currRefPOC, AMVPInfo &info, MVReprojection* mvReprojection);
+  void addAMVPHMVPCand                (const PredictionUnit &pu, const RefPicList eRefPicList, const int currRefPOC, AMVPInfo &info, MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext);
   bool addAffineMVPCandUnscaled       ( const PredictionUnit &pu, const RefPicList &refPicList, const int &refIdx, const Position &pos, const MvpDir &dir, AffineAMVPInfo &affiAmvpInfo );
   bool isBipredRestriction            (const PredictionUnit &pu);
   void spanMotionInfo                 (      PredictionUnit &pu, const MergeCtx &mrgCtx = MergeCtx() );
@@ -184,7 +185,7 @@ namespace PU
 #else
   void getAffineControlPointCand(const PredictionUnit &pu, MotionInfo mi[4], bool isAvailable[4], int verIdx[4], int8_t bcwIdx, int modelIdx, int verNum, AffineMergeCtx& affMrgCtx);
 #endif
-  void getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx, const MVReprojection* mvReprojection, const int mrgCandIdx = -1 );
+  void getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx, const MVReprojection* mvReprojection, MVReprojectionContext &mvReprojectionContext, const int mrgCandIdx = -1 );
   void setAllAffineMvField            (      PredictionUnit &pu, MvField *mvField, RefPicList eRefList );
   void setAllAffineMv                 (      PredictionUnit &pu, Mv affLT, Mv affRT, Mv affLB, RefPicList eRefList, bool clipCPMVs = false );
   bool getInterMergeSubPuMvpCand(const PredictionUnit &pu, MergeCtx &mrgCtx, const int count, int mmvdList);
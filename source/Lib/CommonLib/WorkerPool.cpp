@@ -0,0 +1,95 @@
+//
+// Fixed-size pool of worker threads for data-parallel loops.
+//
+
+#include "WorkerPool.h"
+
+#include "CommonDef.h"
+
+void WorkerPool::create(int numWorkers)
+{
+  CHECK(!m_threads.empty(), "Worker pool already created.");
+  m_numWorkers = std::max(numWorkers, 1);
+  m_shutdown = false;
+  for (int worker = 1; worker < m_numWorkers; worker++) {
+    m_threads.emplace_back(&WorkerPool::workerLoop, this, worker);
+  }
+}
+
+void WorkerPool::destroy()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shutdown = true;
+  }
+  m_startCondition.notify_all();
+  for (auto &thread : m_threads) {
+    thread.join();
+  }
+  m_threads.clear();
+  m_numWorkers = 1;
+}
+
+void WorkerPool::parallelFor(int numIterations, const Task &task)
+{
+  if (m_threads.empty() || numIterations <= 1) {
+    for (int i = 0; i < numIterations; i++) {
+      task(i, 0);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_task = &task;
+    m_numIterations = numIterations;
+    m_nextIteration = 0;
+    m_numActive = int(m_threads.size());
+    m_generation++;
+  }
+  m_startCondition.notify_all();
+
+  runIterations(0);
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_doneCondition.wait(lock, [this] { return m_numActive == 0; });
+  m_task = nullptr;
+}
+
+void WorkerPool::workerLoop(int worker)
+{
+  unsigned generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_startCondition.wait(lock, [&] { return m_shutdown || m_generation != generation; });
+      if (m_shutdown) {
+        return;
+      }
+      generation = m_generation;
+    }
+
+    runIterations(worker);
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_numActive--;
+    }
+    m_doneCondition.notify_one();
+  }
+}
+
+void WorkerPool::runIterations(int worker)
+{
+  while (true) {
+    int iteration;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_nextIteration >= m_numIterations) {
+        return;
+      }
+      iteration = m_nextIteration++;
+    }
+    (*m_task)(iteration, worker);
+  }
+}
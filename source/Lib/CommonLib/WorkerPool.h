@@ -0,0 +1,47 @@
+//
+// Fixed-size pool of worker threads for data-parallel loops.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Runs the iterations of a loop on a fixed set of threads. The calling thread takes part as worker 0, so a pool of
+/// size one runs everything inline without any synchronization. Iterations are handed out dynamically; callers that
+/// need deterministic results write per-iteration outputs and reduce them in iteration order afterwards.
+class WorkerPool
+{
+public:
+  typedef std::function<void(int iteration, int worker)> Task;
+
+  WorkerPool(): m_numWorkers(1), m_task(nullptr), m_numIterations(0), m_nextIteration(0), m_numActive(0), m_generation(0), m_shutdown(false) {}
+  ~WorkerPool() { destroy(); }
+
+  void create(int numWorkers);
+  void destroy();
+  int  getNumWorkers() const { return m_numWorkers; }
+
+  /** @brief Run task for iterations 0 .. numIterations - 1 and return when all have finished. */
+  void parallelFor(int numIterations, const Task &task);
+
+protected:
+  void workerLoop(int worker);
+  void runIterations(int worker);
+
+  int m_numWorkers;
+  std::vector<std::thread> m_threads;
+
+  std::mutex m_mutex;
+  std::condition_variable m_startCondition;
+  std::condition_variable m_doneCondition;
+  const Task *m_task;
+  int m_numIterations;
+  int m_nextIteration;  /**< Next iteration to hand out, protected by m_mutex */
+  int m_numActive;  /**< Helper threads still working on the current loop */
+  unsigned m_generation;  /**< Incremented for every loop to wake the helper threads */
+  bool m_shutdown;
+};
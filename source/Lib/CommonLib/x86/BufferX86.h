@@ -957,6 +957,104 @@ void roundIntVector_SIMD(int* v, int size, unsigned int nShift, const int dmvLim
   }
 }
 
+// The products of four samples are computed in parallel. They are added to ssd one by one in sample order, so that the
+// result is identical to calcRowWeightedSSDCore and to the per sample loop of the WS-PSNR.
+template< X86_VEXT vext >
+double calcRowWeightedSSD_SIMD( const Pel* org, const Pel* rec, const double* weight, int width, int orgShift, int recShift, double ssd )
+{
+  const __m128i vOrgShift = _mm_cvtsi32_si128( orgShift );
+  const __m128i vRecShift = _mm_cvtsi32_si128( recShift );
+  ALIGN_DATA( 32, double prod[4] );
+  int x = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    for( ; x + 4 <= width; x += 4 )
+    {
+      __m128i vorg  = _mm_sll_epi32( _mm_cvtepi16_epi32( _mm_loadl_epi64( ( const __m128i* ) &org[x] ) ), vOrgShift );
+      __m128i vrec  = _mm_sll_epi32( _mm_cvtepi16_epi32( _mm_loadl_epi64( ( const __m128i* ) &rec[x] ) ), vRecShift );
+      __m128i vdiff = _mm_sub_epi32( vorg, vrec );
+      __m256d vsqr  = _mm256_cvtepi32_pd( _mm_mullo_epi32( vdiff, vdiff ) );
+      _mm256_store_pd( prod, _mm256_mul_pd( vsqr, _mm256_loadu_pd( &weight[x] ) ) );
+      ssd += prod[0];
+      ssd += prod[1];
+      ssd += prod[2];
+      ssd += prod[3];
+    }
+  }
+  else
+#endif
+  {
+    for( ; x + 4 <= width; x += 4 )
+    {
+      __m128i vorg  = _mm_sll_epi32( _mm_cvtepi16_epi32( _mm_loadl_epi64( ( const __m128i* ) &org[x] ) ), vOrgShift );
+      __m128i vrec  = _mm_sll_epi32( _mm_cvtepi16_epi32( _mm_loadl_epi64( ( const __m128i* ) &rec[x] ) ), vRecShift );
+      __m128i vdiff = _mm_sub_epi32( vorg, vrec );
+      __m128i vsqr  = _mm_mullo_epi32( vdiff, vdiff );
+      _mm_store_pd( &prod[0], _mm_mul_pd( _mm_cvtepi32_pd( vsqr ), _mm_loadu_pd( &weight[x] ) ) );
+      _mm_store_pd( &prod[2], _mm_mul_pd( _mm_cvtepi32_pd( _mm_unpackhi_epi64( vsqr, vsqr ) ), _mm_loadu_pd( &weight[x + 2] ) ) );
+      ssd += prod[0];
+      ssd += prod[1];
+      ssd += prod[2];
+      ssd += prod[3];
+    }
+  }
+  for( ; x < width; x++ )
+  {
+    const int diff = ( org[x] << orgShift ) - ( rec[x] << recShift );
+    ssd += ( double ) ( diff * diff ) * weight[x];
+  }
+  return ssd;
+}
+
+// The squared differences are accumulated in 64 bit lanes; the integer sum is identical to calcRowSSDCore.
+template< X86_VEXT vext >
+uint64_t calcRowSSD_SIMD( const Pel* org, const Pel* rec, int width, int orgShift, int recShift )
+{
+  const __m128i vOrgShift = _mm_cvtsi32_si128( orgShift );
+  const __m128i vRecShift = _mm_cvtsi32_si128( recShift );
+  uint64_t ssd = 0;
+  int x = 0;
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    __m256i vsum = _mm256_setzero_si256();
+    for( ; x + 8 <= width; x += 8 )
+    {
+      __m256i vorg  = _mm256_sll_epi32( _mm256_cvtepi16_epi32( _mm_loadu_si128( ( const __m128i* ) &org[x] ) ), vOrgShift );
+      __m256i vrec  = _mm256_sll_epi32( _mm256_cvtepi16_epi32( _mm_loadu_si128( ( const __m128i* ) &rec[x] ) ), vRecShift );
+      __m256i vdiff = _mm256_sub_epi32( vorg, vrec );
+      __m256i vsqr  = _mm256_mullo_epi32( vdiff, vdiff );
+      vsum = _mm256_add_epi64( vsum, _mm256_cvtepu32_epi64( _mm256_castsi256_si128( vsqr ) ) );
+      vsum = _mm256_add_epi64( vsum, _mm256_cvtepu32_epi64( _mm256_extracti128_si256( vsqr, 1 ) ) );
+    }
+    __m128i vsum128 = _mm_add_epi64( _mm256_castsi256_si128( vsum ), _mm256_extracti128_si256( vsum, 1 ) );
+    ssd = uint64_t( _mm_cvtsi128_si64( vsum128 ) ) + uint64_t( _mm_extract_epi64( vsum128, 1 ) );
+  }
+  else
+#endif
+  {
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vsum = vzero;
+    for( ; x + 4 <= width; x += 4 )
+    {
+      __m128i vorg  = _mm_sll_epi32( _mm_cvtepi16_epi32( _mm_loadl_epi64( ( const __m128i* ) &org[x] ) ), vOrgShift );
+      __m128i vrec  = _mm_sll_epi32( _mm_cvtepi16_epi32( _mm_loadl_epi64( ( const __m128i* ) &rec[x] ) ), vRecShift );
+      __m128i vdiff = _mm_sub_epi32( vorg, vrec );
+      __m128i vsqr  = _mm_mullo_epi32( vdiff, vdiff );
+      vsum = _mm_add_epi64( vsum, _mm_unpacklo_epi32( vsqr, vzero ) );
+      vsum = _mm_add_epi64( vsum, _mm_unpackhi_epi32( vsqr, vzero ) );
+    }
+    ssd = uint64_t( _mm_cvtsi128_si64( vsum ) ) + uint64_t( _mm_extract_epi64( vsum, 1 ) );
+  }
+  for( ; x < width; x++ )
+  {
+    const int diff = ( org[x] << orgShift ) - ( rec[x] << recShift );
+    ssd += uint32_t( diff * diff );
+  }
+  return ssd;
+}
+
 template< X86_VEXT vext, bool PAD = true>
 void gradFilter_SSE(Pel* src, int srcStride, int width, int height, int gradStride, Pel* gradX, Pel* gradY, const int bitDepth)
 {
@@ -1830,6 +1928,9 @@ void PelBufferOps::_initPelBufOpsX86()
 #endif
   profGradFilter = gradFilter_SSE<vext, false>;
   applyPROF      = applyPROF_SSE<vext>;
+
+  calcRowWeightedSSD        = calcRowWeightedSSD_SIMD<vext>;
+  calcRowSSD                = calcRowSSD_SIMD<vext>;
 #endif
   roundIntVector = roundIntVector_SIMD<vext>;
 }
@@ -0,0 +1,542 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2022, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     CoordinateX86.h
+    \brief    Batched coordinate conversion, SIMD version
+*/
+
+#include <algorithm>
+#include "CommonDefX86.h"
+#include "../Coordinate.h"
+
+#if ENABLE_SIMD_OPT_COORDINATE
+#ifdef TARGET_SIMD_X86
+
+// With MM_FAST_TRIG, the kernels evaluate the polynomials of FastTrig in Coordinate.h with the same operations in the
+// same order, hence they are bit-exact with the scalar implementation (up to the sign of NaN results).
+// Without MM_FAST_TRIG, the kernels evaluate the packets of the Eigen array expressions with the vectorized functions
+// of Eigen and the C library per lane where Eigen does not vectorize. The trailing elements that do not fill a packet
+// are evaluated by the scalar kernels, as by Eigen.
+
+struct CoordVecSSE
+{
+  typedef __m128  F;
+  typedef __m128i I;
+  static const int N = 4;
+
+  static inline F load( const TCoord* p )       { return _mm_loadu_ps( p ); }
+  static inline void store( TCoord* p, F a )    { _mm_storeu_ps( p, a ); }
+  static inline F set1( TCoord a )              { return _mm_set1_ps( a ); }
+  static inline F zero()                        { return _mm_setzero_ps(); }
+  static inline F add( F a, F b )               { return _mm_add_ps( a, b ); }
+  static inline F sub( F a, F b )               { return _mm_sub_ps( a, b ); }
+  static inline F mul( F a, F b )               { return _mm_mul_ps( a, b ); }
+  static inline F div( F a, F b )               { return _mm_div_ps( a, b ); }
+  static inline F sqrt( F a )                   { return _mm_sqrt_ps( a ); }
+  static inline F min( F a, F b )               { return _mm_min_ps( a, b ); }
+  static inline F max( F a, F b )               { return _mm_max_ps( a, b ); }
+  static inline F band( F a, F b )              { return _mm_and_ps( a, b ); }
+  static inline F bandnot( F a, F b )           { return _mm_andnot_ps( a, b ); }
+  static inline F bor( F a, F b )               { return _mm_or_ps( a, b ); }
+  static inline F bxor( F a, F b )              { return _mm_xor_ps( a, b ); }
+  static inline F cmpgt( F a, F b )             { return _mm_cmpgt_ps( a, b ); }
+  static inline F cmplt( F a, F b )             { return _mm_cmplt_ps( a, b ); }
+  static inline F cmpeq( F a, F b )             { return _mm_cmpeq_ps( a, b ); }
+  static inline F blend( F a, F b, F mask )     { return _mm_blendv_ps( a, b, mask ); }
+  static inline I cvtt( F a )                   { return _mm_cvttps_epi32( a ); }
+  static inline F cvt( I a )                    { return _mm_cvtepi32_ps( a ); }
+  static inline I iset1( int a )                { return _mm_set1_epi32( a ); }
+  static inline I iadd( I a, I b )              { return _mm_add_epi32( a, b ); }
+  static inline I iand( I a, I b )              { return _mm_and_si128( a, b ); }
+  static inline I icmpeq( I a, I b )            { return _mm_cmpeq_epi32( a, b ); }
+  static inline I islli( I a, int s )           { return _mm_slli_epi32( a, s ); }
+  static inline F cast( I a )                   { return _mm_castsi128_ps( a ); }
+};
+
+#ifdef USE_AVX2
+struct CoordVecAVX2
+{
+  typedef __m256  F;
+  typedef __m256i I;
+  static const int N = 8;
+
+  static inline F load( const TCoord* p )       { return _mm256_loadu_ps( p ); }
+  static inline void store( TCoord* p, F a )    { _mm256_storeu_ps( p, a ); }
+  static inline F set1( TCoord a )              { return _mm256_set1_ps( a ); }
+  static inline F zero()                        { return _mm256_setzero_ps(); }
+  static inline F add( F a, F b )               { return _mm256_add_ps( a, b ); }
+  static inline F sub( F a, F b )               { return _mm256_sub_ps( a, b ); }
+  static inline F mul( F a, F b )               { return _mm256_mul_ps( a, b ); }
+  static inline F div( F a, F b )               { return _mm256_div_ps( a, b ); }
+  static inline F sqrt( F a )                   { return _mm256_sqrt_ps( a ); }
+  static inline F min( F a, F b )               { return _mm256_min_ps( a, b ); }
+  static inline F max( F a, F b )               { return _mm256_max_ps( a, b ); }
+  static inline F band( F a, F b )              { return _mm256_and_ps( a, b ); }
+  static inline F bandnot( F a, F b )           { return _mm256_andnot_ps( a, b ); }
+  static inline F bor( F a, F b )               { return _mm256_or_ps( a, b ); }
+  static inline F bxor( F a, F b )              { return _mm256_xor_ps( a, b ); }
+  static inline F cmpgt( F a, F b )             { return _mm256_cmp_ps( a, b, _CMP_GT_OQ ); }
+  static inline F cmplt( F a, F b )             { return _mm256_cmp_ps( a, b, _CMP_LT_OQ ); }
+  static inline F cmpeq( F a, F b )             { return _mm256_cmp_ps( a, b, _CMP_EQ_OQ ); }
+  static inline F blend( F a, F b, F mask )     { return _mm256_blendv_ps( a, b, mask ); }
+  static inline I cvtt( F a )                   { return _mm256_cvttps_epi32( a ); }
+  static inline F cvt( I a )                    { return _mm256_cvtepi32_ps( a ); }
+  static inline I iset1( int a )                { return _mm256_set1_epi32( a ); }
+  static inline I iadd( I a, I b )              { return _mm256_add_epi32( a, b ); }
+  static inline I iand( I a, I b )              { return _mm256_and_si256( a, b ); }
+  static inline I icmpeq( I a, I b )            { return _mm256_cmpeq_epi32( a, b ); }
+  static inline I islli( I a, int s )           { return _mm256_slli_epi32( a, s ); }
+  static inline F cast( I a )                   { return _mm256_castsi256_ps( a ); }
+};
+#endif
+
+#if MM_FAST_TRIG
+template<class V>
+static inline typename V::F signMask()
+{
+  return V::set1( -0.0f );
+}
+
+template<class V>
+static inline void sincos_SIMD( typename V::F x, typename V::F &s, typename V::F &c )
+{
+  typedef typename V::F F;
+  typedef typename V::I I;
+  const F sign = V::band( x, signMask<V>() );
+  const F ax   = V::bandnot( signMask<V>(), x );
+
+  I j = V::cvtt( V::mul( ax, V::set1( FastTrig::FOUR_OVER_PI ) ) );
+  j = V::iand( V::iadd( j, V::iset1( 1 ) ), V::iset1( ~1 ) );
+  const F y = V::cvt( j );
+
+  F xr = V::sub( ax, V::mul( y, V::set1( FastTrig::PI_4_DP1 ) ) );
+  xr   = V::sub( xr, V::mul( y, V::set1( FastTrig::PI_4_DP2 ) ) );
+  xr   = V::sub( xr, V::mul( y, V::set1( FastTrig::PI_4_DP3 ) ) );
+  const F z = V::mul( xr, xr );
+
+  F polyCos = V::add( V::mul( V::set1( FastTrig::COS_C0 ), z ), V::set1( FastTrig::COS_C1 ) );
+  polyCos   = V::add( V::mul( polyCos, z ), V::set1( FastTrig::COS_C2 ) );
+  polyCos   = V::mul( V::mul( polyCos, z ), z );
+  polyCos   = V::sub( polyCos, V::mul( V::set1( 0.5f ), z ) );
+  polyCos   = V::add( polyCos, V::set1( 1.0f ) );
+
+  F polySin = V::add( V::mul( V::set1( FastTrig::SIN_C0 ), z ), V::set1( FastTrig::SIN_C1 ) );
+  polySin   = V::add( V::mul( polySin, z ), V::set1( FastTrig::SIN_C2 ) );
+  polySin   = V::mul( V::mul( polySin, z ), xr );
+  polySin   = V::add( polySin, xr );
+
+  const F swap    = V::cast( V::icmpeq( V::iand( j, V::iset1( 2 ) ), V::iset1( 2 ) ) );
+  const F sinSign = V::bxor( V::cast( V::islli( V::iand( j, V::iset1( 4 ) ), 29 ) ), sign );
+  const F cosSign = V::cast( V::islli( V::iand( V::iadd( j, V::iset1( 2 ) ), V::iset1( 4 ) ), 29 ) );
+
+  s = V::bxor( V::blend( polySin, polyCos, swap ), sinSign );
+  c = V::bxor( V::blend( polyCos, polySin, swap ), cosSign );
+}
+
+template<class V>
+static inline typename V::F atan_SIMD( typename V::F x )
+{
+  typedef typename V::F F;
+  const F sign = V::band( x, signMask<V>() );
+  const F ax   = V::bandnot( signMask<V>(), x );
+  const F one  = V::set1( 1.0f );
+
+  const F big  = V::cmpgt( ax, V::set1( FastTrig::TAN_3PI_8 ) );
+  const F mid  = V::bandnot( big, V::cmpgt( ax, V::set1( FastTrig::TAN_PI_8 ) ) );
+  F xr = V::blend( ax, V::div( V::sub( ax, one ), V::add( ax, one ) ), mid );
+  xr   = V::blend( xr, V::div( V::set1( -1.0f ), ax ), big );
+  F y0 = V::band( mid, V::set1( FastTrig::PI_4 ) );
+  y0   = V::blend( y0, V::set1( FastTrig::PI_2 ), big );
+
+  const F z = V::mul( xr, xr );
+  F r = V::add( V::mul( V::set1( FastTrig::ATAN_C0 ), z ), V::set1( FastTrig::ATAN_C1 ) );
+  r   = V::add( V::mul( r, z ), V::set1( FastTrig::ATAN_C2 ) );
+  r   = V::add( V::mul( r, z ), V::set1( FastTrig::ATAN_C3 ) );
+  r   = V::mul( V::mul( r, z ), xr );
+  r   = V::add( V::add( r, xr ), y0 );
+  return V::bxor( r, sign );
+}
+
+template<class V>
+static inline typename V::F atan2_SIMD( typename V::F y, typename V::F x )
+{
+  typedef typename V::F F;
+  const F zero = V::zero();
+  F r = atan_SIMD<V>( V::div( y, x ) );
+  const F piSigned = V::bor( V::set1( FastTrig::PI ), V::band( y, signMask<V>() ) );
+  r = V::blend( r, V::add( r, piSigned ), V::cmplt( x, zero ) );
+
+  F rZero = V::band( V::cmpgt( y, zero ), V::set1( FastTrig::PI_2 ) );
+  rZero   = V::blend( rZero, V::set1( -FastTrig::PI_2 ), V::cmplt( y, zero ) );
+  return V::blend( r, rZero, V::cmpeq( x, zero ) );
+}
+
+template<class V>
+static inline typename V::F acos_SIMD( typename V::F x )
+{
+  typedef typename V::F F;
+  const F ax  = V::bandnot( signMask<V>(), x );
+  const F big = V::cmpgt( ax, V::set1( 0.5f ) );
+  const F z   = V::blend( V::mul( ax, ax ), V::mul( V::set1( 0.5f ), V::sub( V::set1( 1.0f ), ax ) ), big );
+  const F xs  = V::blend( ax, V::sqrt( z ), big );
+
+  F p = V::add( V::mul( V::set1( FastTrig::ASIN_C0 ), z ), V::set1( FastTrig::ASIN_C1 ) );
+  p   = V::add( V::mul( p, z ), V::set1( FastTrig::ASIN_C2 ) );
+  p   = V::add( V::mul( p, z ), V::set1( FastTrig::ASIN_C3 ) );
+  p   = V::add( V::mul( p, z ), V::set1( FastTrig::ASIN_C4 ) );
+  p   = V::add( V::mul( V::mul( p, z ), xs ), xs );
+
+  const F neg = V::cmplt( x, V::zero() );
+  const F p2  = V::mul( V::set1( 2.0f ), p );
+  const F rBig   = V::blend( p2, V::sub( V::set1( FastTrig::PI ), p2 ), neg );
+  const F rSmall = V::blend( V::sub( V::set1( FastTrig::PI_2 ), p ), V::add( V::set1( FastTrig::PI_2 ), p ), neg );
+  return V::blend( rSmall, rBig, big );
+}
+
+template<class V>
+static inline typename V::F sqrt_SIMD( typename V::F x )
+{
+  return V::sqrt( x );
+}
+
+#else
+// Scalar kernels for the trailing elements
+static const CoordinateOps g_scalarCoordOP;
+
+template<class V>
+static inline void sincos_SIMD( typename V::F x, typename V::F &s, typename V::F &c )
+{
+  s = Eigen::internal::psin( x );
+  c = Eigen::internal::pcos( x );
+}
+
+template<class V>
+static inline typename V::F sqrt_SIMD( typename V::F x )
+{
+  return Eigen::internal::psqrt( x );
+}
+
+template<class V>
+static inline typename V::F atan2_SIMD( typename V::F y, typename V::F x )
+{
+  TCoord bufY[V::N], bufX[V::N];
+  V::store( bufY, y );
+  V::store( bufX, x );
+  for( int k = 0; k < V::N; k++ )
+  {
+    bufY[k] = CoordTrig::atan2( bufY[k], bufX[k] );
+  }
+  return V::load( bufY );
+}
+
+template<class V>
+static inline typename V::F acos_SIMD( typename V::F x )
+{
+  TCoord buf[V::N];
+  V::store( buf, x );
+  for( int k = 0; k < V::N; k++ )
+  {
+    buf[k] = CoordTrig::acos( buf[k] );
+  }
+  return V::load( buf );
+}
+#endif
+
+template<class V>
+static inline void sphericalToCartesianBlock( const TCoord* r, const TCoord* theta, const TCoord* phi, TCoord* x, TCoord* y, TCoord* z )
+{
+  typename V::F sinTheta, cosTheta, sinPhi, cosPhi;
+  sincos_SIMD<V>( V::load( theta ), sinTheta, cosTheta );
+  sincos_SIMD<V>( V::load( phi ), sinPhi, cosPhi );
+  const typename V::F radius    = V::load( r );
+  const typename V::F rSinTheta = V::mul( radius, sinTheta );
+  V::store( x, V::mul( rSinTheta, cosPhi ) );
+  V::store( y, V::mul( rSinTheta, sinPhi ) );
+  V::store( z, V::mul( radius, cosTheta ) );
+}
+
+template<class V>
+static inline void storeSpherical( typename V::F vx, typename V::F vy, typename V::F vz, TCoord* r, TCoord* theta, TCoord* phi )
+{
+  typedef typename V::F F;
+  const F radius = sqrt_SIMD<V>( V::add( V::add( V::mul( vx, vx ), V::mul( vy, vy ) ), V::mul( vz, vz ) ) );
+  const F cosTheta = V::max( V::set1( -1.0f ), V::min( V::set1( 1.0f ), V::div( vz, radius ) ) );
+  V::store( r, radius );
+  V::store( theta, acos_SIMD<V>( cosTheta ) );
+  V::store( phi, atan2_SIMD<V>( vy, vx ) );
+}
+
+template<class V>
+static inline void cartesianToSphericalBlock( const TCoord* x, const TCoord* y, const TCoord* z, TCoord* r, TCoord* theta, TCoord* phi )
+{
+  storeSpherical<V>( V::load( x ), V::load( y ), V::load( z ), r, theta, phi );
+}
+
+template<class V>
+static inline typename V::F rotateRow( const TCoord* m, int row, typename V::F vx, typename V::F vy, typename V::F vz )
+{
+  return V::add( V::mul( V::set1( m[row] ), vx ), V::add( V::mul( V::set1( m[row + 3] ), vy ), V::mul( V::set1( m[row + 6] ), vz ) ) );
+}
+
+template<class V>
+static inline void rotatedCartesianToSphericalBlock( const TCoord* m, const TCoord* x, const TCoord* y, const TCoord* z, TCoord* r, TCoord* theta, TCoord* phi )
+{
+  const typename V::F vx = V::load( x );
+  const typename V::F vy = V::load( y );
+  const typename V::F vz = V::load( z );
+  storeSpherical<V>( rotateRow<V>( m, 0, vx, vy, vz ), rotateRow<V>( m, 1, vx, vy, vz ), rotateRow<V>( m, 2, vx, vy, vz ), r, theta, phi );
+}
+
+template<class V>
+static inline void sphericalToRotatedCartesianBlock( const TCoord* m, const TCoord* r, const TCoord* theta, const TCoord* phi, TCoord* x, TCoord* y, TCoord* z )
+{
+  typename V::F sinTheta, cosTheta, sinPhi, cosPhi;
+  sincos_SIMD<V>( V::load( theta ), sinTheta, cosTheta );
+  sincos_SIMD<V>( V::load( phi ), sinPhi, cosPhi );
+  const typename V::F radius    = V::load( r );
+  const typename V::F rSinTheta = V::mul( radius, sinTheta );
+  const typename V::F vx        = V::mul( rSinTheta, cosPhi );
+  const typename V::F vy        = V::mul( rSinTheta, sinPhi );
+  const typename V::F vz        = V::mul( radius, cosTheta );
+  V::store( x, rotateRow<V>( m, 0, vx, vy, vz ) );
+  V::store( y, rotateRow<V>( m, 1, vx, vy, vz ) );
+  V::store( z, rotateRow<V>( m, 2, vx, vy, vz ) );
+}
+
+template<class V>
+static inline void polarToCartesianBlock( const TCoord* r, const TCoord* phi, TCoord* x, TCoord* y )
+{
+  typename V::F sinPhi, cosPhi;
+  sincos_SIMD<V>( V::load( phi ), sinPhi, cosPhi );
+  const typename V::F radius = V::load( r );
+  V::store( x, V::mul( radius, cosPhi ) );
+  V::store( y, V::mul( radius, sinPhi ) );
+}
+
+template<class V>
+static inline void cartesianToPolarBlock( const TCoord* x, const TCoord* y, TCoord* r, TCoord* phi )
+{
+  const typename V::F vx = V::load( x );
+  const typename V::F vy = V::load( y );
+  V::store( r, sqrt_SIMD<V>( V::add( V::mul( vx, vx ), V::mul( vy, vy ) ) ) );
+  V::store( phi, atan2_SIMD<V>( vy, vx ) );
+}
+
+// With MM_FAST_TRIG, the remainder of each array is processed on a zero padded copy so that the tail is computed
+// bit-exactly as well.
+
+template<class V>
+void sphericalToCartesian_SIMD( const TCoord* r, const TCoord* theta, const TCoord* phi, TCoord* x, TCoord* y, TCoord* z, int n )
+{
+  int i = 0;
+  for( ; i + V::N <= n; i += V::N )
+  {
+    sphericalToCartesianBlock<V>( r + i, theta + i, phi + i, x + i, y + i, z + i );
+  }
+  if( i < n )
+  {
+#if MM_FAST_TRIG
+    const int rem = n - i;
+    TCoord bufR[V::N] = { 0 }, bufTheta[V::N] = { 0 }, bufPhi[V::N] = { 0 }, bufX[V::N], bufY[V::N], bufZ[V::N];
+    std::copy_n( r + i, rem, bufR );
+    std::copy_n( theta + i, rem, bufTheta );
+    std::copy_n( phi + i, rem, bufPhi );
+    sphericalToCartesianBlock<V>( bufR, bufTheta, bufPhi, bufX, bufY, bufZ );
+    std::copy_n( bufX, rem, x + i );
+    std::copy_n( bufY, rem, y + i );
+    std::copy_n( bufZ, rem, z + i );
+#else
+    g_scalarCoordOP.sphericalToCartesian( r + i, theta + i, phi + i, x + i, y + i, z + i, n - i );
+#endif
+  }
+}
+
+template<class V>
+void cartesianToSpherical_SIMD( const TCoord* x, const TCoord* y, const TCoord* z, TCoord* r, TCoord* theta, TCoord* phi, int n )
+{
+  int i = 0;
+  for( ; i + V::N <= n; i += V::N )
+  {
+    cartesianToSphericalBlock<V>( x + i, y + i, z + i, r + i, theta + i, phi + i );
+  }
+  if( i < n )
+  {
+#if MM_FAST_TRIG
+    const int rem = n - i;
+    TCoord bufX[V::N] = { 0 }, bufY[V::N] = { 0 }, bufZ[V::N] = { 0 }, bufR[V::N], bufTheta[V::N], bufPhi[V::N];
+    std::copy_n( x + i, rem, bufX );
+    std::copy_n( y + i, rem, bufY );
+    std::copy_n( z + i, rem, bufZ );
+    cartesianToSphericalBlock<V>( bufX, bufY, bufZ, bufR, bufTheta, bufPhi );
+    std::copy_n( bufR, rem, r + i );
+    std::copy_n( bufTheta, rem, theta + i );
+    std::copy_n( bufPhi, rem, phi + i );
+#else
+    g_scalarCoordOP.cartesianToSpherical( x + i, y + i, z + i, r + i, theta + i, phi + i, n - i );
+#endif
+  }
+}
+
+template<class V>
+void rotatedCartesianToSpherical_SIMD( const TCoord* m, const TCoord* x, const TCoord* y, const TCoord* z, TCoord* r, TCoord* theta, TCoord* phi, int n )
+{
+  int i = 0;
+  for( ; i + V::N <= n; i += V::N )
+  {
+    rotatedCartesianToSphericalBlock<V>( m, x + i, y + i, z + i, r + i, theta + i, phi + i );
+  }
+  if( i < n )
+  {
+#if MM_FAST_TRIG
+    const int rem = n - i;
+    TCoord bufX[V::N] = { 0 }, bufY[V::N] = { 0 }, bufZ[V::N] = { 0 }, bufR[V::N], bufTheta[V::N], bufPhi[V::N];
+    std::copy_n( x + i, rem, bufX );
+    std::copy_n( y + i, rem, bufY );
+    std::copy_n( z + i, rem, bufZ );
+    rotatedCartesianToSphericalBlock<V>( m, bufX, bufY, bufZ, bufR, bufTheta, bufPhi );
+    std::copy_n( bufR, rem, r + i );
+    std::copy_n( bufTheta, rem, theta + i );
+    std::copy_n( bufPhi, rem, phi + i );
+#else
+    g_scalarCoordOP.rotatedCartesianToSpherical( m, x + i, y + i, z + i, r + i, theta + i, phi + i, n - i );
+#endif
+  }
+}
+
+template<class V>
+void sphericalToRotatedCartesian_SIMD( const TCoord* m, const TCoord* r, const TCoord* theta, const TCoord* phi, TCoord* x, TCoord* y, TCoord* z, int n )
+{
+  int i = 0;
+  for( ; i + V::N <= n; i += V::N )
+  {
+    sphericalToRotatedCartesianBlock<V>( m, r + i, theta + i, phi + i, x + i, y + i, z + i );
+  }
+  if( i < n )
+  {
+#if MM_FAST_TRIG
+    const int rem = n - i;
+    TCoord bufR[V::N] = { 0 }, bufTheta[V::N] = { 0 }, bufPhi[V::N] = { 0 }, bufX[V::N], bufY[V::N], bufZ[V::N];
+    std::copy_n( r + i, rem, bufR );
+    std::copy_n( theta + i, rem, bufTheta );
+    std::copy_n( phi + i, rem, bufPhi );
+    sphericalToRotatedCartesianBlock<V>( m, bufR, bufTheta, bufPhi, bufX, bufY, bufZ );
+    std::copy_n( bufX, rem, x + i );
+    std::copy_n( bufY, rem, y + i );
+    std::copy_n( bufZ, rem, z + i );
+#else
+    g_scalarCoordOP.sphericalToRotatedCartesian( m, r + i, theta + i, phi + i, x + i, y + i, z + i, n - i );
+#endif
+  }
+}
+
+template<class V>
+void polarToCartesian_SIMD( const TCoord* r, const TCoord* phi, TCoord* x, TCoord* y, int n )
+{
+  int i = 0;
+  for( ; i + V::N <= n; i += V::N )
+  {
+    polarToCartesianBlock<V>( r + i, phi + i, x + i, y + i );
+  }
+  if( i < n )
+  {
+#if MM_FAST_TRIG
+    const int rem = n - i;
+    TCoord bufR[V::N] = { 0 }, bufPhi[V::N] = { 0 }, bufX[V::N], bufY[V::N];
+    std::copy_n( r + i, rem, bufR );
+    std::copy_n( phi + i, rem, bufPhi );
+    polarToCartesianBlock<V>( bufR, bufPhi, bufX, bufY );
+    std::copy_n( bufX, rem, x + i );
+    std::copy_n( bufY, rem, y + i );
+#else
+    g_scalarCoordOP.polarToCartesian( r + i, phi + i, x + i, y + i, n - i );
+#endif
+  }
+}
+
+template<class V>
+void cartesianToPolar_SIMD( const TCoord* x, const TCoord* y, TCoord* r, TCoord* phi, int n )
+{
+  int i = 0;
+  for( ; i + V::N <= n; i += V::N )
+  {
+    cartesianToPolarBlock<V>( x + i, y + i, r + i, phi + i );
+  }
+  if( i < n )
+  {
+#if MM_FAST_TRIG
+    const int rem = n - i;
+    TCoord bufX[V::N] = { 0 }, bufY[V::N] = { 0 }, bufR[V::N], bufPhi[V::N];
+    std::copy_n( x + i, rem, bufX );
+    std::copy_n( y + i, rem, bufY );
+    cartesianToPolarBlock<V>( bufX, bufY, bufR, bufPhi );
+    std::copy_n( bufR, rem, r + i );
+    std::copy_n( bufPhi, rem, phi + i );
+#else
+    g_scalarCoordOP.cartesianToPolar( x + i, y + i, r + i, phi + i, n - i );
+#endif
+  }
+}
+
+template<X86_VEXT vext>
+void CoordinateOps::_initCoordinateOpsX86()
+{
+#ifdef USE_AVX2
+  if( vext >= AVX2 )
+  {
+    sphericalToCartesian = sphericalToCartesian_SIMD<CoordVecAVX2>;
+    cartesianToSpherical = cartesianToSpherical_SIMD<CoordVecAVX2>;
+    polarToCartesian     = polarToCartesian_SIMD<CoordVecAVX2>;
+    cartesianToPolar     = cartesianToPolar_SIMD<CoordVecAVX2>;
+    rotatedCartesianToSpherical = rotatedCartesianToSpherical_SIMD<CoordVecAVX2>;
+    sphericalToRotatedCartesian = sphericalToRotatedCartesian_SIMD<CoordVecAVX2>;
+    return;
+  }
+#endif
+  sphericalToCartesian = sphericalToCartesian_SIMD<CoordVecSSE>;
+  cartesianToSpherical = cartesianToSpherical_SIMD<CoordVecSSE>;
+  polarToCartesian     = polarToCartesian_SIMD<CoordVecSSE>;
+  cartesianToPolar     = cartesianToPolar_SIMD<CoordVecSSE>;
+  rotatedCartesianToSpherical = rotatedCartesianToSpherical_SIMD<CoordVecSSE>;
+  sphericalToRotatedCartesian = sphericalToRotatedCartesian_SIMD<CoordVecSSE>;
+}
+
+#if MM_FAST_TRIG
+template void CoordinateOps::_initCoordinateOpsX86<SIMDX86>();
+#elif defined( USE_SSE41 )
+// Only the SSE4.1 kernels process the packets of Eigen, see CoordinateOps::initCoordinateOpsX86()
+static_assert( CoordTrig::PACKET_SIZE == CoordVecSSE::N, "the SIMD kernels process the packets of Eigen" );
+template void CoordinateOps::_initCoordinateOpsX86<SIMDX86>();
+#endif
+
+#endif // TARGET_SIMD_X86
+#endif
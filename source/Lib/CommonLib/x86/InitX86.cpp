@@ -43,6 +43,7 @@
 #include "CommonLib/TrQuant.h"
 #include "CommonLib/RdCost.h"
 #include "CommonLib/Buffer.h"
+#include "CommonLib/Coordinate.h"
 
 #include "CommonLib/AffineGradientSearch.h"
 
@@ -97,6 +98,35 @@ void PelBufferOps::initPelBufOpsX86()
 }
 #endif
 
+#if ENABLE_SIMD_OPT_COORDINATE
+void CoordinateOps::initCoordinateOpsX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext){
+#if MM_FAST_TRIG
+    case AVX512:
+    case AVX2:
+      _initCoordinateOpsX86<AVX2>();
+      break;
+    case AVX:
+      _initCoordinateOpsX86<AVX>();
+      break;
+#else
+    // The array expressions of Eigen are evaluated with SSE packets, wider vectors would change the results
+    case AVX512:
+    case AVX2:
+    case AVX:
+#endif
+    case SSE42:
+    case SSE41:
+      _initCoordinateOpsX86<SSE41>();
+      break;
+    default:
+      break;
+  }
+}
+#endif
+
 
 
 
@@ -2466,6 +2466,234 @@ void xWeightedGeoBlk_SSE(const PredictionUnit &pu, const uint32_t width, const u
   }
 }
 
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+// Separable 8-tap interpolation of one 4x4 subblock, both passes kept in registers
+template<X86_VEXT vext, bool isLast>
+static void simdFilterSubblock4x4_2D(const ClpRng &clpRng, Pel const *src, const ptrdiff_t srcStride, Pel *dst,
+                                     const ptrdiff_t dstStride, TFilterCoeff const *coeffH, TFilterCoeff const *coeffV)
+{
+  const int headRoom = IF_INTERNAL_FRAC_BITS(clpRng.bd);
+  const int shift1   = IF_FILTER_PREC - headRoom;
+  const int shift2   = isLast ? IF_FILTER_PREC + headRoom : IF_FILTER_PREC;
+
+  const __m128i mmShift1  = _mm_cvtsi32_si128(shift1);
+  const __m128i mmShift2  = _mm_cvtsi32_si128(shift2);
+  const __m128i mmOffset1 = _mm_set1_epi32(-(IF_INTERNAL_OFFS << shift1));
+  const __m128i mmOffset2 =
+    _mm_set1_epi32(isLast ? (1 << (shift2 - 1)) + (IF_INTERNAL_OFFS << IF_FILTER_PREC) : 0);
+  const __m128i mmMin = _mm_set1_epi32(clpRng.min);
+  const __m128i mmMax = _mm_set1_epi32(clpRng.max);
+
+  const __m128i mmCoeffH = _mm_loadu_si128((const __m128i *) coeffH);
+  __m128i       mmCoeffV[4];
+  for (int k = 0; k < 4; k++)
+  {
+    mmCoeffV[k] = _mm_set1_epi32((int(coeffV[2 * k + 1]) << 16) | (coeffV[2 * k] & 0xffff));
+  }
+
+  // horizontal pass over the 4 + 7 rows required by the vertical taps
+  __m128i rows[4 + 7];
+  src -= 3 * srcStride + 3;
+  for (int y = 0; y < 4 + 7; y++, src += srcStride)
+  {
+    const __m128i s0 = _mm_madd_epi16(_mm_loadu_si128((const __m128i *) (src + 0)), mmCoeffH);
+    const __m128i s1 = _mm_madd_epi16(_mm_loadu_si128((const __m128i *) (src + 1)), mmCoeffH);
+    const __m128i s2 = _mm_madd_epi16(_mm_loadu_si128((const __m128i *) (src + 2)), mmCoeffH);
+    const __m128i s3 = _mm_madd_epi16(_mm_loadu_si128((const __m128i *) (src + 3)), mmCoeffH);
+
+    __m128i sum = _mm_hadd_epi32(_mm_hadd_epi32(s0, s1), _mm_hadd_epi32(s2, s3));
+    sum         = _mm_sra_epi32(_mm_add_epi32(sum, mmOffset1), mmShift1);
+    rows[y]     = _mm_packs_epi32(sum, sum);
+  }
+
+  // vertical pass on interleaved row pairs
+  for (int y = 0; y < 4; y++)
+  {
+    __m128i sum = mmOffset2;
+    for (int k = 0; k < 4; k++)
+    {
+      sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi16(rows[y + 2 * k], rows[y + 2 * k + 1]), mmCoeffV[k]));
+    }
+    sum = _mm_sra_epi32(sum, mmShift2);
+    if (isLast)
+    {
+      sum = _mm_min_epi32(mmMax, _mm_max_epi32(sum, mmMin));
+    }
+    _mm_storel_epi64((__m128i *) (dst + y * dstStride), _mm_packs_epi32(sum, sum));
+  }
+}
+
+#ifdef USE_AVX2
+// Two independent 4x4 subblocks of simdFilterSubblock4x4_2D, one in each 128-bit lane
+template<X86_VEXT vext, bool isLast>
+static void simdFilterSubblock4x4_2D_AVX2(const ClpRng &clpRng, Pel const *srcA, Pel const *srcB,
+                                          const ptrdiff_t srcStride, Pel *dstA, Pel *dstB, const ptrdiff_t dstStride,
+                                          TFilterCoeff const *coeffHA, TFilterCoeff const *coeffVA,
+                                          TFilterCoeff const *coeffHB, TFilterCoeff const *coeffVB)
+{
+  const int headRoom = IF_INTERNAL_FRAC_BITS(clpRng.bd);
+  const int shift1   = IF_FILTER_PREC - headRoom;
+  const int shift2   = isLast ? IF_FILTER_PREC + headRoom : IF_FILTER_PREC;
+
+  const __m128i mmShift1  = _mm_cvtsi32_si128(shift1);
+  const __m128i mmShift2  = _mm_cvtsi32_si128(shift2);
+  const __m256i mmOffset1 = _mm256_set1_epi32(-(IF_INTERNAL_OFFS << shift1));
+  const __m256i mmOffset2 =
+    _mm256_set1_epi32(isLast ? (1 << (shift2 - 1)) + (IF_INTERNAL_OFFS << IF_FILTER_PREC) : 0);
+  const __m256i mmMin = _mm256_set1_epi32(clpRng.min);
+  const __m256i mmMax = _mm256_set1_epi32(clpRng.max);
+
+  const __m256i mmCoeffH = _mm256_inserti128_si256(
+    _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) coeffHA)), _mm_loadu_si128((const __m128i *) coeffHB), 1);
+  __m256i mmCoeffV[4];
+  for (int k = 0; k < 4; k++)
+  {
+    const __m128i cA = _mm_set1_epi32((int(coeffVA[2 * k + 1]) << 16) | (coeffVA[2 * k] & 0xffff));
+    const __m128i cB = _mm_set1_epi32((int(coeffVB[2 * k + 1]) << 16) | (coeffVB[2 * k] & 0xffff));
+    mmCoeffV[k]      = _mm256_inserti128_si256(_mm256_castsi128_si256(cA), cB, 1);
+  }
+
+  __m256i rows[4 + 7];
+  srcA -= 3 * srcStride + 3;
+  srcB -= 3 * srcStride + 3;
+  for (int y = 0; y < 4 + 7; y++, srcA += srcStride, srcB += srcStride)
+  {
+    __m256i s[4];
+    for (int i = 0; i < 4; i++)
+    {
+      const __m256i src2 = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (srcA + i))), _mm_loadu_si128((const __m128i *) (srcB + i)), 1);
+      s[i] = _mm256_madd_epi16(src2, mmCoeffH);
+    }
+
+    __m256i sum = _mm256_hadd_epi32(_mm256_hadd_epi32(s[0], s[1]), _mm256_hadd_epi32(s[2], s[3]));
+    sum         = _mm256_sra_epi32(_mm256_add_epi32(sum, mmOffset1), mmShift1);
+    rows[y]     = _mm256_packs_epi32(sum, sum);
+  }
+
+  for (int y = 0; y < 4; y++)
+  {
+    __m256i sum = mmOffset2;
+    for (int k = 0; k < 4; k++)
+    {
+      sum = _mm256_add_epi32(
+        sum, _mm256_madd_epi16(_mm256_unpacklo_epi16(rows[y + 2 * k], rows[y + 2 * k + 1]), mmCoeffV[k]));
+    }
+    sum = _mm256_sra_epi32(sum, mmShift2);
+    if (isLast)
+    {
+      sum = _mm256_min_epi32(mmMax, _mm256_max_epi32(sum, mmMin));
+    }
+    sum = _mm256_packs_epi32(sum, sum);
+    _mm_storel_epi64((__m128i *) (dstA + y * dstStride), _mm256_castsi256_si128(sum));
+    _mm_storel_epi64((__m128i *) (dstB + y * dstStride), _mm256_extracti128_si256(sum, 1));
+  }
+}
+#endif
+#endif
+
+template<X86_VEXT vext, int N, bool isLast>
+static void simdFilterSubblocks(const ClpRng &clpRng, Pel const *src, const ptrdiff_t srcStride, Pel *dst,
+                                const ptrdiff_t dstStride, int sbWidth, int sbHeight, int numRows, int numCols,
+                                const int *xPos, const int *yPos, const int *xFrac, const int *yFrac,
+                                const Position &minPos, const Position &maxPos, TFilterCoeff const *coeffTable)
+{
+  CHECK(sbWidth > 4 || sbHeight > 4, "Unsupported subblock size");
+  Pel tmp[4 * (4 + N - 1)];
+
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+  const bool fused2D = N == 8 && sbWidth == 4 && sbHeight == 4;
+#ifdef USE_AVX2
+  // a 2D subblock waiting for a second one to fill the other AVX2 lane
+  int pending = -1;
+  Pel *pendingDst = nullptr;
+#endif
+#endif
+
+  for (int col = 0; col < numCols; col++)
+  {
+    for (int row = 0; row < numRows; row++)
+    {
+      const int i = col * numRows + row;
+      Pel *dstBlk = dst + row * sbHeight * dstStride + col * sbWidth;
+      if (xPos[i] < minPos.x || yPos[i] < minPos.y || xPos[i] >= maxPos.x || yPos[i] >= maxPos.y)
+      {
+        for (int y = 0; y < sbHeight; y++)
+        {
+          ::memset(dstBlk + y * dstStride, 0, sbWidth * sizeof(Pel));
+        }
+        continue;
+      }
+
+      const Pel *srcBlk = src + yPos[i] * srcStride + xPos[i];
+      if (yFrac[i] == 0)
+      {
+        if (xFrac[i] == 0)
+        {
+#if RExt__HIGH_BIT_DEPTH_SUPPORT
+          simdFilterCopy_HBD<vext, true, isLast>(clpRng, srcBlk, srcStride, dstBlk, dstStride, sbWidth, sbHeight, false);
+#else
+          simdFilterCopy<vext, true, isLast>(clpRng, srcBlk, srcStride, dstBlk, dstStride, sbWidth, sbHeight, false);
+#endif
+        }
+        else
+        {
+          simdFilter<vext, N, false, true, isLast>(clpRng, srcBlk, srcStride, dstBlk, dstStride, sbWidth, sbHeight,
+                                                   coeffTable + xFrac[i] * N, false);
+        }
+        continue;
+      }
+      if (xFrac[i] == 0)
+      {
+        simdFilter<vext, N, true, true, isLast>(clpRng, srcBlk, srcStride, dstBlk, dstStride, sbWidth, sbHeight,
+                                                coeffTable + yFrac[i] * N, false);
+        continue;
+      }
+
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+      if (fused2D)
+      {
+#ifdef USE_AVX2
+        if (vext >= AVX2)
+        {
+          if (pending < 0)
+          {
+            pending    = i;
+            pendingDst = dstBlk;
+          }
+          else
+          {
+            simdFilterSubblock4x4_2D_AVX2<vext, isLast>(
+              clpRng, src + yPos[pending] * srcStride + xPos[pending], srcBlk, srcStride, pendingDst, dstBlk, dstStride,
+              coeffTable + xFrac[pending] * N, coeffTable + yFrac[pending] * N, coeffTable + xFrac[i] * N,
+              coeffTable + yFrac[i] * N);
+            pending = -1;
+          }
+          continue;
+        }
+#endif
+        simdFilterSubblock4x4_2D<vext, isLast>(clpRng, srcBlk, srcStride, dstBlk, dstStride, coeffTable + xFrac[i] * N,
+                                               coeffTable + yFrac[i] * N);
+        continue;
+      }
+#endif
+      simdFilter<vext, N, false, true, false>(clpRng, srcBlk - (N / 2 - 1) * srcStride, srcStride, tmp, sbWidth,
+                                              sbWidth, sbHeight + N - 1, coeffTable + xFrac[i] * N, false);
+      simdFilter<vext, N, true, false, isLast>(clpRng, tmp + (N / 2 - 1) * sbWidth, sbWidth, dstBlk, dstStride,
+                                               sbWidth, sbHeight, coeffTable + yFrac[i] * N, false);
+    }
+  }
+
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT && defined(USE_AVX2)
+  if (pending >= 0)
+  {
+    simdFilterSubblock4x4_2D<vext, isLast>(clpRng, src + yPos[pending] * srcStride + xPos[pending], srcStride,
+                                           pendingDst, dstStride, coeffTable + xFrac[pending] * N,
+                                           coeffTable + yFrac[pending] * N);
+  }
+#endif
+}
+
 template <X86_VEXT vext>
 void InterpolationFilter::_initInterpolationFilterX86()
 {
@@ -2511,6 +2739,11 @@ void InterpolationFilter::_initInterpolationFilterX86()
   m_filterCopy[1][0] = simdFilterCopy_HBD<vext, true, false>;
   m_filterCopy[1][1] = simdFilterCopy_HBD<vext, true, true>;
 
+  m_filterSubblocks[0][0] = simdFilterSubblocks<vext, 8, false>;
+  m_filterSubblocks[0][1] = simdFilterSubblocks<vext, 8, true>;
+  m_filterSubblocks[1][0] = simdFilterSubblocks<vext, 4, false>;
+  m_filterSubblocks[1][1] = simdFilterSubblocks<vext, 4, true>;
+
   m_weightedGeoBlk = xWeightedGeoBlk_HBD_SIMD<vext>;
 #else
   // [taps][bFirst][bLast]
@@ -2559,6 +2792,11 @@ void InterpolationFilter::_initInterpolationFilterX86()
   m_filterCopy[1][0]   = simdFilterCopy<vext, true, false>;
   m_filterCopy[1][1]   = simdFilterCopy<vext, true, true>;
 
+  m_filterSubblocks[0][0] = simdFilterSubblocks<vext, 8, false>;
+  m_filterSubblocks[0][1] = simdFilterSubblocks<vext, 8, true>;
+  m_filterSubblocks[1][0] = simdFilterSubblocks<vext, 4, false>;
+  m_filterSubblocks[1][1] = simdFilterSubblocks<vext, 4, true>;
+
   m_weightedGeoBlk = xWeightedGeoBlk_SSE<vext>;
 #endif
 }
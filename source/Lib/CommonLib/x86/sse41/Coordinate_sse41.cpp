@@ -0,0 +1 @@
+#include "../CoordinateX86.h"
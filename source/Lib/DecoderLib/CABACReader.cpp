@@ -2178,128 +2178,12 @@ void CABACReader::motion_model(PredictionUnit &pu)
   {
     RExt__DECODER_DEBUG_BIT_STATISTICS_CREATE_SET(STATS__CABAC_BITS__MOTIONMODEL);
 
-    std::vector<MotionModelID> motionModelCandidates = pu.cs->sps->getActiveMotionModels();
-    switch (m_mmPredType)
-    {
-    case 0:   // none
-      break;
-    case 1:   // center-point
-    {
-      MotionModelID mmPred = INVALID;
-      const Position blockCenter = pu.lumaPos().offset(int(pu.lumaSize().width / 2), int(pu.lumaSize().height / 2));
-      mmPred                     = pu.cs->slice
-                 ->getRefPic(RefPicList(pu.cs->slice->isInterB() ? 1 - pu.cs->slice->getColFromL0Flag() : 0),
-                             int(pu.cs->slice->getColRefIdx()))
-                 ->cs->getMotionInfo(blockCenter)
-                 .motionModel[RefPicList(pu.cs->slice->getColFromL0Flag())];
-
-      // Place mmPred at front
-      const auto mmPredIt = std::find(motionModelCandidates.begin(), motionModelCandidates.end(), mmPred);
-      motionModelCandidates.erase(mmPredIt);
-      motionModelCandidates.insert(motionModelCandidates.begin(), mmPred);
-      break;
-    }
-    case 2:   // voted
-    {
-      MotionModelID mmPred = INVALID;
-      const Slice         &slice = *pu.cs->slice;
-      const Picture *const pColPic =
-        slice.getRefPic(RefPicList(slice.isInterB() ? 1 - slice.getColFromL0Flag() : 0), int(slice.getColRefIdx()));
-      const RefPicList eColRefPicList = slice.getCheckLDC() ? REF_PIC_LIST_0 : RefPicList(slice.getColFromL0Flag());
-      const CMotionBuf motionBuf          = pColPic->cs->getMotionBuf(pu);
-
-      std::map<MotionModelID, int> motionModelVotingMap;
-      for (int x = 0; x < motionBuf.width; ++x)
-      {
-        for (int y = 0; y < motionBuf.height; ++y)
-        {
-          const MotionInfo &mi = motionBuf.at(x, y);
-          MotionModelID motionModel = mi.motionModel[eColRefPicList];
-          if (motionModel == INVALID) {
-            motionModel = mi.motionModel[1 - eColRefPicList];
-          }
-          motionModelVotingMap[motionModel]++;
-        }
-      }
-
-      int maxVotes = 0;
-      for (const auto &motionModelVote: motionModelVotingMap)
-      {
-        if (motionModelVote.second > maxVotes)
-        {
-          maxVotes = motionModelVote.second;
-          mmPred   = motionModelVote.first;
-        }
-      }
-
-      // Place mmPred at front
-      const auto mmPredIt = std::find(motionModelCandidates.begin(), motionModelCandidates.end(), mmPred);
-      motionModelCandidates.erase(mmPredIt);
-      motionModelCandidates.insert(motionModelCandidates.begin(), mmPred);
-      break;
-    }
-    case 3:   // sorted
-    {
-      const Slice         &slice = *pu.cs->slice;
-      const Picture *const pColPic =
-        slice.getRefPic(RefPicList(slice.isInterB() ? 1 - slice.getColFromL0Flag() : 0), int(slice.getColRefIdx()));
-      const RefPicList eColRefPicList = slice.getCheckLDC() ? REF_PIC_LIST_0 : RefPicList(slice.getColFromL0Flag());
-      Area votingArea(pu.lumaPos(), pu.lumaSize());
-
-      // Ensure minimum voting area size
-      if (votingArea.width < 32) {
-        votingArea.x -= (32 - int(votingArea.width)) >> 1;
-        votingArea.width = 32;
-        if (votingArea.x < 0) {
-          votingArea.width = votingArea.width + votingArea.x;
-          votingArea.x = 0;
-        }
-        if (votingArea.x + votingArea.width > slice.getPic()->lwidth()) {
-          votingArea.width -= (votingArea.x + votingArea.width) - slice.getPic()->lwidth();
-        }
-      }
-      if (votingArea.height < 32) {
-        votingArea.y -= (32 - int(votingArea.height)) >> 1;
-        votingArea.height = 32;
-        if (votingArea.y < 0) {
-          votingArea.height = votingArea.height + votingArea.y;
-          votingArea.y = 0;
-        }
-        if (votingArea.y + votingArea.height > slice.getPic()->lheight()) {
-          votingArea.height -= (votingArea.y + votingArea.height) - slice.getPic()->lheight();
-        }
-      }
-      const CMotionBuf motionBuf = pColPic->cs->getMotionBuf(votingArea);
-
-      // Vote
-      std::map<MotionModelID, int> motionModelVotingMap;
-      for (int x = 0; x < motionBuf.width; ++x)
-      {
-        for (int y = 0; y < motionBuf.height; ++y)
-        {
-          const MotionInfo &mi = motionBuf.at(x, y);
-          MotionModelID motionModel = mi.motionModel[eColRefPicList];
-          if (motionModel == INVALID) {
-            motionModel = mi.motionModel[1 - eColRefPicList];
-          }
-          motionModelVotingMap[motionModel]++;
-        }
-      }
-
-      // Sort by vote
-      std::sort(motionModelCandidates.begin(),
-                motionModelCandidates.end(),
-                [&motionModelVotingMap](const MotionModelID& lhs, const MotionModelID& rhs){
-                  return motionModelVotingMap[lhs] > motionModelVotingMap[rhs];
-                });
-      break;
-    }
-    default: CHECK(true, "Invalid mmPredType '" + std::to_string(m_mmPredType) + "'.");
-    }
+    MotionModelID motionModelCandidates[NUM_MODELS];
+    const std::size_t numCandidates = PU::getMotionModelCandidates(pu, m_mmPredType, motionModelCandidates);
 
-    for (std::size_t i = 0; i < motionModelCandidates.size(); ++i) {
+    for (std::size_t i = 0; i < numCandidates; ++i) {
       const auto &motionModel = motionModelCandidates[i];
-      const bool  isLast      = (i == motionModelCandidates.size() - 1);
+      const bool  isLast      = (i == numCandidates - 1);
       if (!isLast) {
         if (i < m_mmCodingDepth) {
           if (m_BinDecoder.decodeBin(Ctx::MotionModel(motionModel))) {
@@ -2308,7 +2192,7 @@ void CABACReader::motion_model(PredictionUnit &pu)
             break;
           }
         } else {
-          unsigned mmIdx = m_BinDecoder.decodeBinsEP(motionModelCandidates.size() - m_mmCodingDepth);
+          unsigned mmIdx = m_BinDecoder.decodeBinsEP(numCandidates - m_mmCodingDepth);
           pu.motionModel[0] = motionModelCandidates[m_mmCodingDepth + mmIdx];
           pu.motionModel[1] = motionModelCandidates[m_mmCodingDepth + mmIdx];
           break;
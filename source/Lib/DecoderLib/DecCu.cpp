@@ -876,7 +876,7 @@ void DecCu::xDeriveCUMV( CodingUnit &cu )
             mrgCtx.subPuMvpMiBuf  = MotionBuf(m_SubPuMiBuf, bufSize);
             affineMergeCtx.mrgCtx = &mrgCtx;
           }
-          PU::getAffineMergeCand(pu, affineMergeCtx, m_pcInterPred->getMVReprojection(), pu.mergeIdx);
+          PU::getAffineMergeCand(pu, affineMergeCtx, m_pcInterPred->getMVReprojection(), m_pcInterPred->getMVReprojectionContext(), pu.mergeIdx);
           pu.interDir       = affineMergeCtx.interDirNeighbours[pu.mergeIdx];
           pu.cu->affineType = affineMergeCtx.affineType[pu.mergeIdx];
           pu.cu->bcwIdx     = affineMergeCtx.bcwIdx[pu.mergeIdx];
@@ -938,7 +938,7 @@ void DecCu::xDeriveCUMV( CodingUnit &cu )
             if ( pu.cs->slice->getNumRefIdx( eRefList ) > 0 && ( pu.interDir & ( 1 << uiRefListIdx ) ) )
             {
               AffineAMVPInfo affineAMVPInfo;
-              PU::fillAffineMvpCand( pu, eRefList, pu.refIdx[eRefList], affineAMVPInfo, m_pcInterPred->getMVReprojection() );
+              PU::fillAffineMvpCand( pu, eRefList, pu.refIdx[eRefList], affineAMVPInfo, m_pcInterPred->getMVReprojection(), m_pcInterPred->getMVReprojectionContext() );
 
               const unsigned mvpIdx = pu.mvpIdx[eRefList];
 
@@ -997,7 +997,7 @@ void DecCu::xDeriveCUMV( CodingUnit &cu )
             if ((pu.cs->slice->getNumRefIdx(eRefList) > 0 || (eRefList == REF_PIC_LIST_0 && CU::isIBC(*pu.cu))) && (pu.interDir & (1 << uiRefListIdx)))
             {
               AMVPInfo amvpInfo;
-              PU::fillMvpCand(pu, eRefList, pu.refIdx[eRefList], amvpInfo, m_pcInterPred->getMVReprojection());
+              PU::fillMvpCand(pu, eRefList, pu.refIdx[eRefList], amvpInfo, m_pcInterPred->getMVReprojection(), m_pcInterPred->getMVReprojectionContext());
               pu.mvpNum [eRefList] = amvpInfo.numCand;
               if (!cu.cs->pcv->isEncoder)
               {
@@ -41,6 +41,7 @@
 #include "CommonLib/dtrace_next.h"
 #include "CommonLib/dtrace_buffer.h"
 #include "CommonLib/Buffer.h"
+#include "CommonLib/Coordinate.h"
 #include "CommonLib/UnitTools.h"
 #include "CommonLib/ProfileLevelTier.h"
 
@@ -478,6 +479,9 @@ DecLib::DecLib()
 {
 #if ENABLE_SIMD_OPT_BUFFER
   g_pelBufOP.initPelBufOpsX86();
+#endif
+#if ENABLE_SIMD_OPT_COORDINATE
+  g_coordOP.initCoordinateOpsX86();
 #endif
   memset(m_prevEOS, false, sizeof(m_prevEOS));
   memset(m_accessUnitEos, false, sizeof(m_accessUnitEos));
@@ -792,6 +796,8 @@ void DecLib::finishPicture(int &poc, PicList *&rpcListPic, MsgLevel msgl, bool a
 
   Slice*  pcSlice = m_pcPic->cs->slice;
   m_prevPicPOC = pcSlice->getPOC();
+  g_mmProfiler.countSelected(*m_pcPic->cs);
+  g_mmProfiler.finishFrame(pcSlice->getPOC());
 
   char c = (pcSlice->isIntra() ? 'I' : pcSlice->isInterP() ? 'P' : 'B');
   if (!m_pcPic->referenced)
@@ -2061,6 +2067,15 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
     m_deblockingFilter.create(maxDepth);
     m_cIntraPred.init( sps->getChromaFormatIdc(), sps->getBitDepth( CHANNEL_TYPE_LUMA ) );
     m_cInterPred.init( &m_cRdCost, sps->getChromaFormatIdc(), sps->getMaxCUHeight(), &m_mvReprojection );
+    if (sps->getUseMultiModel())
+    {
+      MVReprojectionContext &context = m_cInterPred.getMVReprojectionContext();
+      if (!context.conversionCache.isInitialized())
+      {
+        context.enableConversionCache();
+      }
+      context.resetConversionCache();
+    }
     if (sps->getUseLmcs())
     {
       m_cReshaper.createDec(sps->getBitDepth(CHANNEL_TYPE_LUMA));
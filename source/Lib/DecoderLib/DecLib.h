@@ -54,6 +54,7 @@
 #include "CommonLib/SEI.h"
 #include "CommonLib/Unit.h"
 #include "CommonLib/Reshape.h"
+#include "CommonLib/MMProfiler.h"
 
 class InputNALUnit;
 
@@ -334,6 +335,8 @@ public:
   // Multi-model
   void setMMCodingDepth(int value) { m_CABACDecoder.setMMCodingDepth(0, value); }
   void setMMPredType(int value) { m_CABACDecoder.setMMPredType(0, value); }
+  void printConversionCacheStatistics() const { m_cInterPred.getMVReprojectionContext().printConversionCacheStatistics(); }
+  void setMMProfileFile(const std::string &fileName) { g_mmProfiler.open(fileName); }
 
 protected:
   void  xUpdateRasInit(Slice* slice);
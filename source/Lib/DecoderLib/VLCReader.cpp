@@ -2183,8 +2183,8 @@ void HLSyntaxReader::parseSPS(SPS* pcSPS)
   {
 #if ENABLE_TRACING || RExt__DECODER_DEBUG_BIT_STATISTICS
     static const char *syntaxStrings[] = {
-      "sps_range_extension_flag", "sps_extension_7bits[0]", "sps_extension_7bits[1]", "sps_extension_7bits[2]",
-      "sps_extension_7bits[3]",   "sps_extension_7bits[4]", "sps_extension_7bits[5]", "sps_extension_7bits[6]",
+      "sps_range_extension_flag", "sps_mm_extension_flag",  "sps_extension_6bits[0]", "sps_extension_6bits[1]",
+      "sps_extension_6bits[2]",   "sps_extension_6bits[3]", "sps_extension_6bits[4]", "sps_extension_6bits[5]",
     };
 #endif
     bool sps_extension_flags[NUM_SPS_EXTENSION_FLAGS];
@@ -2220,6 +2220,14 @@ void HLSyntaxReader::parseSPS(SPS* pcSPS)
             READ_FLAG( uiCode, "reverse_last_position_enabled_flag");       spsRangeExtension.setReverseLastSigCoeffEnabledFlag(uiCode != 0);
           }
           break;
+        case SPS_EXT__MM:
+          CHECK(bSkipTrailingExtensionBits, "Skipping trailing extension bits not supported");
+          CHECK(!pcSPS->getUseMultiModel(), "The value of sps_mm_extension_flag shall be 0 when no multi-model motion model is enabled");
+          READ_FLAG( uiCode, "sps_mm_fixed_point_flag");                    pcSPS->setUseMMFixedPoint(uiCode != 0);
+          CHECK(pcSPS->getUseMMFixedPoint() && (pcSPS->getUseMMMVP() || pcSPS->getUseMPA() || pcSPS->getUse3DT()),
+                "sps_mmmvp_enabled_flag, sps_mpa_enabled_flag and sps_3dt_enabled_flag shall be 0 when sps_mm_fixed_point_flag is 1");
+          READ_FLAG( uiCode, "sps_mm_dmvr_window_flag");                    pcSPS->setUseMMDMVRWindow(uiCode != 0);
+          break;
         default:
           bSkipTrailingExtensionBits=true;
           break;
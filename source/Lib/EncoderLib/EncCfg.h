@@ -382,6 +382,13 @@ protected:
   EpipoleList m_epipoleList;
   int       m_MMSizeConstraint;
   bool      m_MMMVP;
+  bool      m_MMFixedPoint;
+  bool      m_MMDMVRWindow;
+  bool      m_MMLinearizedSearch;
+  int       m_MMSearchThreads;
+  int       m_MMPreselectTopK;
+  double    m_MMPreselectThreshold;
+  std::string m_MMProfileFile;
   int       m_MMOffset4x4;
   int       m_projectionFct;
   unsigned  m_focalLengthPx;
@@ -1378,6 +1385,20 @@ public:
   int       getMMSizeConstraint() const { return m_MMSizeConstraint; }
   void      setUseMMMVP(bool b) { m_MMMVP = b; }
   bool      getUseMMMVP() const { return m_MMMVP; }
+  void      setUseMMFixedPoint(bool b) { m_MMFixedPoint = b; }
+  bool      getUseMMFixedPoint() const { return m_MMFixedPoint; }
+  void      setUseMMDMVRWindow(bool b) { m_MMDMVRWindow = b; }
+  bool      getUseMMDMVRWindow() const { return m_MMDMVRWindow; }
+  void      setUseMMLinearizedSearch(bool b) { m_MMLinearizedSearch = b; }
+  bool      getUseMMLinearizedSearch() const { return m_MMLinearizedSearch; }
+  void      setMMSearchThreads(int i) { m_MMSearchThreads = i; }
+  int       getMMSearchThreads() const { return m_MMSearchThreads; }
+  void      setMMPreselectTopK(int i) { m_MMPreselectTopK = i; }
+  int       getMMPreselectTopK() const { return m_MMPreselectTopK; }
+  void      setMMPreselectThreshold(double d) { m_MMPreselectThreshold = d; }
+  double    getMMPreselectThreshold() const { return m_MMPreselectThreshold; }
+  void      setMMProfileFile(const std::string &s) { m_MMProfileFile = s; }
+  const std::string &getMMProfileFile() const { return m_MMProfileFile; }
   void      setMMOffset4x4(int value) { m_MMOffset4x4 = value; }
   int       getMMOffset4x4() const { return m_MMOffset4x4; }
   void      setProjectionFct(int value) { m_projectionFct = value; }
@@ -772,33 +772,43 @@ void EncCu::xCompressCU( CodingStructure*& tempCS, CodingStructure*& bestCS, Par
         const bool skipAltHpelIF = ( int( ( currTestMode.opts & ETO_IMV ) >> ETO_IMV_SHIFT ) == 4 ) && ( bestIntPelCost > 1.25 * bestCS->cost );
         if (!skipAltHpelIF)
         {
-          for (auto motionModel : sps.getActiveMotionModels())
+          std::vector<MotionModelID> motionModels = sps.getActiveMotionModels();
+          for (size_t i = 0; i < motionModels.size(); i++)
           {
+            const MotionModelID motionModel = motionModels[i];
             if (motionModel != CLASSIC && tempCS->area.lumaSize().area() < m_pcEncCfg->getMMSizeConstraint())
             {
               continue;
             }
+            const auto start = std::chrono::steady_clock::now();
+            const double bestCost = bestCS->cost;
             tempCS->bestCS = bestCS;
             xCheckRDCostInterIMV(tempCS, bestCS, partitioner, currTestMode, bestIntPelCost, motionModel);
             tempCS->bestCS = nullptr;
             splitRdCostBest[CTU_LEVEL] = bestCS->cost;
             tempCS->splitRdCostBest = splitRdCostBest;
+            xUpdateMotionModelPreselection(*tempCS, motionModels, motionModel, start, bestCost < MAX_DOUBLE ? bestCost - bestCS->cost : 0.0);
           }
         }
       }
       else
       {
-        for (auto motionModel : sps.getActiveMotionModels())
+        std::vector<MotionModelID> motionModels = sps.getActiveMotionModels();
+        for (size_t i = 0; i < motionModels.size(); i++)
         {
+          const MotionModelID motionModel = motionModels[i];
           if (motionModel != CLASSIC && tempCS->area.lumaSize().area() < m_pcEncCfg->getMMSizeConstraint())
           {
             continue;
           }
+          const auto start = std::chrono::steady_clock::now();
+          const double bestCost = bestCS->cost;
           tempCS->bestCS = bestCS;
           xCheckRDCostInter( tempCS, bestCS, partitioner, currTestMode, motionModel );
           tempCS->bestCS = nullptr;
           splitRdCostBest[CTU_LEVEL] = bestCS->cost;
           tempCS->splitRdCostBest = splitRdCostBest;
+          xUpdateMotionModelPreselection(*tempCS, motionModels, motionModel, start, bestCost < MAX_DOUBLE ? bestCost - bestCS->cost : 0.0);
         }
       }
 
@@ -3381,7 +3391,7 @@ void EncCu::xCheckRDCostAffineMerge2Nx2N( CodingStructure *&tempCS, CodingStruct
     cs = pu.cs;
     isEncodeGdrClean = cs->sps->getGDREnabledFlag() && cs->pcv->isEncoder && ((cs->picHeader->getInGdrInterval() && cs->isClean(pu.Y().topRight(), CHANNEL_TYPE_LUMA)) || (cs->picHeader->getNumVerVirtualBoundaries() == 0));
 #endif
-    PU::getAffineMergeCand( pu, affineMergeCtx, m_pcInterSearch->getMVReprojection() );
+    PU::getAffineMergeCand( pu, affineMergeCtx, m_pcInterSearch->getMVReprojection(), m_pcInterSearch->getMVReprojectionContext() );
 
     if ( affineMergeCtx.numValidMergeCand <= 0 )
     {
@@ -4144,6 +4154,26 @@ void EncCu::xCheckRDCostIBCMode(CodingStructure *&tempCS, CodingStructure *&best
   // check ibc mode in encoder RD
   //////////////////////////////////////////////////////////////////////////////////////////////
 
+void EncCu::xUpdateMotionModelPreselection(const CodingStructure &cs, std::vector<MotionModelID> &motionModels,
+                                           const MotionModelID checkedModel,
+                                           const std::chrono::steady_clock::time_point &checkStart,
+                                           const double rdGain)
+{
+  if (m_pcEncCfg->getMMPreselectTopK() <= 0)
+  {
+    return;
+  }
+  if (checkedModel == CLASSIC)
+  {
+    // The classic check provides the motion vector that the other models are screened with
+    m_pcInterSearch->preselectMotionModels(cs, motionModels);
+  }
+  else
+  {
+    m_pcInterSearch->addMMModelCheck(checkedModel, std::chrono::duration<double>(std::chrono::steady_clock::now() - checkStart).count(), rdGain);
+  }
+}
+
 void EncCu::xCheckRDCostInter( CodingStructure *&tempCS, CodingStructure *&bestCS, Partitioner &partitioner, const EncTestMode& encTestMode, const MotionModelID motionModel)
 {
   tempCS->initStructData( encTestMode.qp );
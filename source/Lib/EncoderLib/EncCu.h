@@ -55,6 +55,9 @@
 #include "InterSearch.h"
 #include "RateCtrl.h"
 #include "EncModeCtrl.h"
+
+#include <chrono>
+
 //! \ingroup EncoderLib
 //! \{
 
@@ -258,6 +261,10 @@ protected:
   void xCheckRDCostAffineMerge2Nx2N
                               ( CodingStructure *&tempCS, CodingStructure *&bestCS, Partitioner &partitioner, const EncTestMode& encTestMode );
   void xCheckRDCostInter      ( CodingStructure *&tempCS, CodingStructure *&bestCS, Partitioner &pm, const EncTestMode& encTestMode, const MotionModelID motionModel);
+  /// Pre-select the remaining motion models after the classic check and account the time and RD gain of the other model checks
+  void xUpdateMotionModelPreselection(const CodingStructure &cs, std::vector<MotionModelID> &motionModels,
+                                      const MotionModelID checkedModel, const std::chrono::steady_clock::time_point &checkStart,
+                                      const double rdGain);
   bool xCheckRDCostInterIMV(CodingStructure *&tempCS, CodingStructure *&bestCS, Partitioner &pm, const EncTestMode& encTestMode, double &bestIntPelCost, const MotionModelID motionModel);
   void xEncodeDontSplit       ( CodingStructure &cs, Partitioner &partitioner);
 
@@ -56,6 +56,7 @@
 #include "CommonLib/dtrace_codingstruct.h"
 #include "CommonLib/dtrace_buffer.h"
 #include "CommonLib/ProfileLevelTier.h"
+#include "CommonLib/MMProfiler.h"
 
 #include "DecoderLib/DecLib.h"
 
@@ -4137,6 +4138,8 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
       double PSNR_Y;
       xCalculateAddPSNRs(isField, isTff, gopId, pcPic, accessUnit, rcListPic, encTime, snr_conversion, printFrameMSE,
                          printMSSSIM, &PSNR_Y, isEncodeLtRef);
+      g_mmProfiler.countSelected(*pcPic->cs);
+      g_mmProfiler.finishFrame(pcPic->getPOC());
 
       xWriteTrailingSEIMessages(trailingSeiMessages, accessUnit, pcSlice->getTLayer());
 
@@ -4253,6 +4256,9 @@ void EncGOP::printOutSummary( uint32_t uiNumAllPicCoded, bool isField, const boo
 #if WCG_WPSNR
   const bool    useLumaWPSNR = m_pcEncLib->getPrintWPSNR();
 #endif
+#if EXTENSION_360_VIDEO && SVIDEO_ASYNC_METRICS
+  m_ext360.waitForAsyncMetrics();
+#endif
 
   if( m_pcCfg->getDecodeBitstream(0).empty() && m_pcCfg->getDecodeBitstream(1).empty() && !m_pcCfg->useFastForwardToPOC() )
   {
@@ -43,8 +43,10 @@
 #include "CommonLib/Picture.h"
 #include "CommonLib/CommonDef.h"
 #include "CommonLib/ChromaFormat.h"
+#include "CommonLib/Coordinate.h"
 #include "EncLibCommon.h"
 #include "CommonLib/ProfileLevelTier.h"
+#include "CommonLib/MMProfiler.h"
 
 //! \ingroup EncoderLib
 //! \{
@@ -78,6 +80,9 @@ EncLib::EncLib( EncLibCommon* encLibCommon )
 #if ENABLE_SIMD_OPT_BUFFER
   g_pelBufOP.initPelBufOpsX86();
 #endif
+#if ENABLE_SIMD_OPT_COORDINATE
+  g_coordOP.initCoordinateOpsX86();
+#endif
 
 #if JVET_O0756_CALCULATE_HDRMETRICS
   m_metricTime = std::chrono::milliseconds(0);
@@ -324,6 +329,7 @@ void EncLib::init(AUWriterIf *auWriterIf)
   );
 
   // Multi-Model
+  g_mmProfiler.open(m_MMProfileFile);
   if (sps0.getUseMultiModel() && !m_mvReprojection.isInitialized())
   {
     Size         picSize(pps0.getPicWidthInLumaSamples(), pps0.getPicHeightInLumaSamples());
@@ -1339,6 +1345,8 @@ void EncLib::xInitSPS( SPS& sps )
   if (sps.getUseMultiModel()) {
     sps.setGEDFlavor(m_GEDFlavor);
     sps.setUseMMMVP(m_MMMVP);
+    sps.setUseMMFixedPoint(m_MMFixedPoint);
+    sps.setUseMMDMVRWindow(m_MMDMVRWindow);
     sps.setMMOffset4x4(m_MMOffset4x4);
     sps.setProjectionFct(m_projectionFct);
     sps.setFocalLengthPx(m_focalLengthPx);
@@ -234,6 +234,9 @@ public:
     m_cGOPEncoder.printOutSummary(m_codedPicCount, isField, m_printMSEBasedSequencePSNR, m_printSequenceMSE,
                                   m_printMSSSIM, m_printHexPsnr, m_resChangeInClvsEnabled,
                                   m_spsMap.getFirstPS()->getBitDepths(), m_layerId);
+    m_cInterSearch.printMMReprojectionCacheStatistics();
+    m_cInterSearch.getMVReprojectionContext().printConversionCacheStatistics();
+    m_cInterSearch.printMMPreselectionStatistics();
   }
 
   int getLayerId() const { return m_layerId; }
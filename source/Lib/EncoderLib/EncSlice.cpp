@@ -1576,6 +1576,10 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
   m_pcInterSearch->resetAffineMVList();
   m_pcInterSearch->resetUniMvList();
   ::memset(g_isReusedUniMVsFilled, 0, sizeof(g_isReusedUniMVsFilled));
+  if (pcSlice->getSPS()->getUseMultiModel())
+  {
+    m_pcInterSearch->getMVReprojectionContext().resetConversionCache();
+  }
 #if INTERPRED_PROFILING
   m_pcInterSearch->reset_profiling();
 #endif
@@ -1911,6 +1915,8 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
       pcPic->mctsInfo.init( &cs, ctuRsAddr );
     }
 
+    m_pcInterSearch->resetMMReprojectionCaches();
+
     if (pCfg->getSwitchPOC() != pcPic->poc || ctuRsAddr >= pCfg->getDebugCTU())
     {
       m_pcCuEncoder->compressCtu(cs, ctuArea, ctuRsAddr, prevQP, currQP);
@@ -46,12 +46,14 @@
 #include "CommonLib/dtrace_next.h"
 #include "CommonLib/dtrace_buffer.h"
 #include "CommonLib/MCTS.h"
+#include "CommonLib/MMProfiler.h"
 
 #include "EncModeCtrl.h"
 #include "EncLib.h"
 
 #include <math.h>
 #include <limits>
+#include <chrono>
 
 
  //! \ingroup EncoderLib
@@ -97,6 +99,9 @@ InterSearch::InterSearch()
   , m_CtxCache(nullptr)
   , m_pTempPel(nullptr)
   , m_isInitialized(false)
+  , m_mmSearchWorkers(nullptr)
+  , m_mmSearchCollect(false)
+  , m_mmSearchNext(0)
 {
   for (int i=0; i<MAX_NUM_REF_LIST_ADAPT_SR; i++)
   {
@@ -119,6 +124,7 @@ InterSearch::InterSearch()
   m_uniMvListIdx = 0;
   m_histBestSbt    = MAX_UCHAR;
   m_histBestMtsIdx = MAX_UCHAR;
+  std::fill_n(m_mmPreselectionRank, NUM_MODELS, -1);
 }
 
 
@@ -179,6 +185,16 @@ void InterSearch::destroy()
   m_isInitialized = false;
 
   m_tmpMMStorage.destroy();
+  m_mmSearchPool.destroy();
+  if (m_mmSearchWorkers)
+  {
+    for (int i = 0; i < m_pcEncCfg->getMMSearchThreads(); i++)
+    {
+      m_mmSearchWorkers[i].pred.destroy();
+    }
+    delete[] m_mmSearchWorkers;
+    m_mmSearchWorkers = nullptr;
+  }
 }
 
 void InterSearch::setTempBuffers( CodingStructure ****pSplitCS, CodingStructure ****pFullCS, CodingStructure **pSaveCS )
@@ -255,6 +271,11 @@ void InterSearch::init( EncCfg *pcEncCfg,
 
   const ChromaFormat cform = pcEncCfg->getChromaFormatIdc();
   InterPrediction::init( pcRdCost, cform, maxCUHeight, mvReprojection );
+  if (mvReprojection && mvReprojection->isInitialized())
+  {
+    m_mvReprojectionContext.enableReprojectionCache();
+    m_mvReprojectionContext.enableConversionCache();
+  }
 
   for( uint32_t i = 0; i < NUM_REF_PIC_LIST_01; i++ )
   {
@@ -290,6 +311,17 @@ void InterSearch::init( EncCfg *pcEncCfg,
 
   // Multi-model
   m_tmpMMStorage.create(Size(MAX_CU_SIZE, MAX_CU_SIZE));
+  const int numSearchThreads = pcEncCfg->getMMSearchThreads();
+  if (numSearchThreads > 1 && mvReprojection && mvReprojection->isInitialized())
+  {
+    m_mmSearchWorkers = new MMSearchWorker[numSearchThreads];
+    for (int i = 0; i < numSearchThreads; i++)
+    {
+      m_mmSearchWorkers[i].context.enableReprojectionCache();
+      m_mmSearchWorkers[i].pred.create(Size(MAX_CU_SIZE, MAX_CU_SIZE));
+    }
+    m_mmSearchPool.create(numSearchThreads);
+  }
 }
 
 void InterSearch::resetSavedAffineMotion()
@@ -366,7 +398,16 @@ inline void InterSearch::xTZSearchHelp( IntTZSearchStruct& rcStruct, const int i
 
 //  CHECK(!( !( rcStruct.searchRange.left > iSearchX || rcStruct.searchRange.right < iSearchX || rcStruct.searchRange.top > iSearchY || rcStruct.searchRange.bottom < iSearchY )), "Unspecified error");
 
-  xApplyMvVA(rcStruct, Mv(iSearchX, iSearchY), MV_PRECISION_INT);
+  if (m_mmSearchCollect)
+  {
+    m_mmSearchCandidates.push_back(Mv(iSearchX, iSearchY));
+    return;
+  }
+  const bool prefetched = m_mmSearchNext < m_mmSearchCandidates.size() && m_mmSearchCandidates[m_mmSearchNext] == Mv(iSearchX, iSearchY);
+  if (!prefetched)
+  {
+    xApplyMvVA(rcStruct, Mv(iSearchX, iSearchY), MV_PRECISION_INT);
+  }
 
   if( 1 == rcStruct.subShiftMode )
   {
@@ -428,7 +469,7 @@ inline void InterSearch::xTZSearchHelp( IntTZSearchStruct& rcStruct, const int i
   }
   else
   {
-    uiSad = m_cDistParam.distFunc( m_cDistParam );
+    uiSad = prefetched ? m_mmSearchDistortions[m_mmSearchNext++] : m_cDistParam.distFunc( m_cDistParam );
 
     // only add motion cost if uiSad is smaller than best. Otherwise pointless
     // to add motion cost.
@@ -2142,11 +2183,11 @@ bool InterSearch::xRectHashInterEstimation(PredictionUnit& pu, RefPicList& bestR
 #endif
 
         pu.cu->imv = 2;
-        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfo4Pel, m_mvReprojection);
+        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfo4Pel, m_mvReprojection, m_mvReprojectionContext);
         pu.cu->imv = 1;
-        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfoPel, m_mvReprojection);
+        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfoPel, m_mvReprojection, m_mvReprojectionContext);
         pu.cu->imv = 0;
-        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfoQPel, m_mvReprojection);
+        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfoQPel, m_mvReprojection, m_mvReprojectionContext);
         for (int mvpIdxTemp = 0; mvpIdxTemp < 2; mvpIdxTemp++)
         {
           currAMVPInfoQPel.mvCand[mvpIdxTemp].changePrecision(MV_PRECISION_INTERNAL, MV_PRECISION_QUARTER);
@@ -2429,7 +2470,7 @@ bool InterSearch::xHashInterEstimation(PredictionUnit& pu, RefPicList& bestRefPi
         }
 #endif
         pu.cu->imv = 2;
-        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfo4Pel, m_mvReprojection);
+        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfo4Pel, m_mvReprojection, m_mvReprojectionContext);
 
 #if GDR_ENABLED
         if (isEncodeGdrClean)
@@ -2443,7 +2484,7 @@ bool InterSearch::xHashInterEstimation(PredictionUnit& pu, RefPicList& bestRefPi
         }
 #endif
         pu.cu->imv = 1;
-        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfoPel, m_mvReprojection);
+        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfoPel, m_mvReprojection, m_mvReprojectionContext);
         AMVPInfo currAMVPInfoQPel;
 #if GDR_ENABLED
         if (isEncodeGdrClean)
@@ -2457,7 +2498,7 @@ bool InterSearch::xHashInterEstimation(PredictionUnit& pu, RefPicList& bestRefPi
         }
 #endif
         pu.cu->imv = 0;
-        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfoQPel, m_mvReprojection);
+        PU::fillMvpCand(pu, eRefPicList, refIdx, currAMVPInfoQPel, m_mvReprojection, m_mvReprojectionContext);
         CHECK(currAMVPInfoPel.numCand <= 1, "Wrong")
         for (int mvpIdxTemp = 0; mvpIdxTemp < 2; mvpIdxTemp++)
         {
@@ -3237,6 +3278,16 @@ void InterSearch::predInterSearch(CodingUnit& cu, Partitioner& partitioner, cons
       if (cu.imv == 0 && (!cu.slice->getSPS()->getUseBcw() || bcwIdx == BCW_DEFAULT))
       {
         insertUniMvCands(pu.Y(), cMvTemp);
+        if (motionModel == CLASSIC)
+        {
+          const int bestList = (iNumPredDir == 2 && uiCost[1] < uiCost[0]) ? 1 : 0;
+          m_mmScreeningMotion.valid   = true;
+          m_mmScreeningMotion.area    = pu.Y();
+          m_mmScreeningMotion.poc     = cs.slice->getPOC();
+          m_mmScreeningMotion.refList = RefPicList(bestList);
+          m_mmScreeningMotion.refIdx  = refIdx[bestList];
+          m_mmScreeningMotion.mv      = cMv[bestList];
+        }
 
         unsigned idx1, idx2, idx3, idx4;
         getAreaIdx(cu.Y(), *cu.slice->getPPS()->pcv, idx1, idx2, idx3, idx4);
@@ -4629,7 +4680,7 @@ void InterSearch::xEstimateMvPredAMVP(PredictionUnit &pu, PelUnitBuf &origBuf, R
   // Fill the MV Candidates
   if (!bFilled)
   {
-    PU::fillMvpCand( pu, eRefPicList, refIdx, *pcAMVPInfo, m_mvReprojection );
+    PU::fillMvpCand( pu, eRefPicList, refIdx, *pcAMVPInfo, m_mvReprojection, m_mvReprojectionContext );
   }
 
   // initialize Mvp index & Mvp
@@ -5549,11 +5600,11 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
   {
     if ( bFirstSearchDiamond == 1 )
     {
-      xTZ8PointDiamondSearch ( cStruct, iStartX, iStartY, iDist, bFirstCornersForDiamondDist1 );
+      xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ8PointDiamondSearch( s, iStartX, iStartY, iDist, bFirstCornersForDiamondDist1 ); });
     }
     else
     {
-      xTZ8PointSquareSearch  ( cStruct, iStartX, iStartY, iDist );
+      xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ8PointSquareSearch( s, iStartX, iStartY, iDist ); });
     }
 
     if ( bFirstSearchStop && ( cStruct.uiBestRound >= uiFirstSearchRounds ) ) // stop criterion
@@ -5573,7 +5624,7 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
         // test its neighborhood
         for (iDist = 1; iDist <= searchRange; iDist *= 2)
         {
-          xTZ8PointDiamondSearch( cStruct, 0, 0, iDist, false );
+          xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ8PointDiamondSearch( s, 0, 0, iDist, false ); });
           if ( bTestZeroVectorStop && (cStruct.uiBestRound > 0) ) // stop criterion
           {
             break;
@@ -5592,7 +5643,7 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
     {
       for (iDist = 1; iDist <= (searchRange >> 1); iDist *= 2)
       {
-        xTZ8PointDiamondSearch( cStruct, 0, 0, iDist, false );
+        xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ8PointDiamondSearch( s, 0, 0, iDist, false ); });
         if ( bTestZeroVectorStop && (cStruct.uiBestRound > 2) ) // stop criterion
         {
           break;
@@ -5605,7 +5656,7 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
   if ( cStruct.uiBestDistance == 1 )
   {
     cStruct.uiBestDistance = 0;
-    xTZ2PointSearch( cStruct );
+    xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ2PointSearch( s ); });
   }
 
   // raster search if distance is too big
@@ -5623,26 +5674,30 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
       localsr.bottom /= 2;
     }
     cStruct.uiBestDistance = iWindowSize;
-    for ( iStartY = localsr.top; iStartY <= localsr.bottom; iStartY += iWindowSize )
-    {
-      for ( iStartX = localsr.left; iStartX <= localsr.right; iStartX += iWindowSize )
+    xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) {
+      for ( int y = localsr.top; y <= localsr.bottom; y += iWindowSize )
       {
-        xTZSearchHelp( cStruct, iStartX, iStartY, 0, iWindowSize );
+        for ( int x = localsr.left; x <= localsr.right; x += iWindowSize )
+        {
+          xTZSearchHelp( s, x, y, 0, iWindowSize );
+        }
       }
-    }
+    });
   }
   else
   {
     if ( bEnableRasterSearch && ( ((int)(cStruct.uiBestDistance) >= iRaster) || bAlwaysRasterSearch ) )
     {
       cStruct.uiBestDistance = iRaster;
-      for ( iStartY = sr.top; iStartY <= sr.bottom; iStartY += iRaster )
-      {
-        for ( iStartX = sr.left; iStartX <= sr.right; iStartX += iRaster )
+      xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) {
+        for ( int y = sr.top; y <= sr.bottom; y += iRaster )
         {
-          xTZSearchHelp( cStruct, iStartX, iStartY, 0, iRaster );
+          for ( int x = sr.left; x <= sr.right; x += iRaster )
+          {
+            xTZSearchHelp( s, x, y, 0, iRaster );
+          }
         }
-      }
+      });
     }
   }
 
@@ -5659,11 +5714,11 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
         iDist = cStruct.uiBestDistance >>= 1;
         if ( bRasterRefinementDiamond == 1 )
         {
-          xTZ8PointDiamondSearch ( cStruct, iStartX, iStartY, iDist, bRasterRefinementCornersForDiamondDist1 );
+          xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ8PointDiamondSearch( s, iStartX, iStartY, iDist, bRasterRefinementCornersForDiamondDist1 ); });
         }
         else
         {
-          xTZ8PointSquareSearch  ( cStruct, iStartX, iStartY, iDist );
+          xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ8PointSquareSearch( s, iStartX, iStartY, iDist ); });
         }
       }
 
@@ -5673,7 +5728,7 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
         cStruct.uiBestDistance = 0;
         if ( cStruct.ucPointNr != 0 )
         {
-          xTZ2PointSearch( cStruct );
+          xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ2PointSearch( s ); });
         }
       }
     }
@@ -5692,11 +5747,11 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
       {
         if ( bStarRefinementDiamond == 1 )
         {
-          xTZ8PointDiamondSearch ( cStruct, iStartX, iStartY, iDist, bStarRefinementCornersForDiamondDist1 );
+          xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ8PointDiamondSearch( s, iStartX, iStartY, iDist, bStarRefinementCornersForDiamondDist1 ); });
         }
         else
         {
-          xTZ8PointSquareSearch  ( cStruct, iStartX, iStartY, iDist );
+          xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ8PointSquareSearch( s, iStartX, iStartY, iDist ); });
         }
         if ( bStarRefinementStop && (cStruct.uiBestRound >= uiStarRefinementRounds) ) // stop criterion
         {
@@ -5710,7 +5765,7 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
         cStruct.uiBestDistance = 0;
         if ( cStruct.ucPointNr != 0 )
         {
-          xTZ2PointSearch( cStruct );
+          xTZSearchStep(cStruct, [&](IntTZSearchStruct &s) { xTZ2PointSearch( s ); });
         }
       }
     }
@@ -6268,12 +6323,311 @@ inline void InterSearch::xApplyMvVA(const IntTZSearchStruct &rcStruct, const Mv
     const Pel* const piRefSrch = rcStruct.pcRefBuf->buf + rMv.ver * rcStruct.pcRefBuf->stride + rMv.hor;
     m_cDistParam.cur.buf = piRefSrch;
   }
+  else if (m_pcEncCfg->getUseMMLinearizedSearch() && xIsLinearizableMotionModel(rcStruct.motionModel)
+           && xLinearizedSubblockPositions(rcStruct, rMv))
+  {
+    xSubblockInterpolation(rcStruct.blkSize, m_subblockPositions, *rcStruct.pcRefBuf, m_tmpMMStorage, rcStruct.motionModel,
+                           m_lumaClpRng, true);
+  }
   else
   {
     xMVReprojectionInterpolation(rcStruct.blkPos, rcStruct.blkSize, *rcStruct.pcRefBuf, rMv, mvPrec, m_tmpMMStorage, rcStruct.motionModel, m_lumaClpRng, rcStruct.curPOC, rcStruct.refPOC);
   }
 }
 
+void InterSearch::xTZSearchStep(IntTZSearchStruct &rcStruct, const std::function<void(IntTZSearchStruct &)> &step)
+{
+  if (!m_mmSearchWorkers || rcStruct.motionModel == CLASSIC
+      || (m_pcEncCfg->getUseMMLinearizedSearch() && xIsLinearizableMotionModel(rcStruct.motionModel)))
+  {
+    step(rcStruct);
+    return;
+  }
+
+  // Dry run on a copy, as the search steps update the round counter of the search structure
+  IntTZSearchStruct probe = rcStruct;
+  m_mmSearchCollect = true;
+  step(probe);
+  m_mmSearchCollect = false;
+
+  // The early exit threshold of the batch start is never below the best cost when a candidate is consumed, so
+  // candidates that exit early would have been rejected by the serial search as well.
+  const DistParam distParam = m_cDistParam;
+  m_mmSearchDistortions.resize(m_mmSearchCandidates.size());
+  m_mmSearchPool.parallelFor(int(m_mmSearchCandidates.size()), [&](int i, int worker) {
+    m_mmSearchDistortions[i] = xMMSearchDistortion(rcStruct, m_mmSearchCandidates[i], m_mmSearchWorkers[worker], distParam);
+  });
+
+  m_mmSearchNext = 0;
+  step(rcStruct);
+  m_mmSearchCandidates.clear();
+  m_mmSearchNext = 0;
+}
+
+Distortion InterSearch::xMMSearchDistortion(const IntTZSearchStruct &rcStruct, const Mv &mv, MMSearchWorker &worker,
+                                            DistParam distParam)
+{
+  Mv mvInternal(mv);
+  mvInternal.changePrecision(MV_PRECISION_INT, MV_PRECISION_INTERNAL);
+  ChromaFormat tmpChFmt = CHROMA_400; // Dummy chroma format for MVReprojection -> Only luma is of interest.
+  m_mvReprojection->reprojectMotionVectorSubblocks(rcStruct.blkPos, rcStruct.blkSize, mvInternal, rcStruct.motionModel,
+                                                   COMPONENT_Y, tmpChFmt, rcStruct.curPOC, rcStruct.refPOC,
+                                                   worker.positions, worker.context);
+  xSubblockInterpolation(rcStruct.blkSize, worker.positions, *rcStruct.pcRefBuf, worker.pred, rcStruct.motionModel,
+                         m_lumaClpRng, true);
+  distParam.cur.buf = worker.pred.buf;
+  distParam.cur.stride = worker.pred.stride;
+  return distParam.distFunc(distParam);
+}
+
+void InterSearch::preselectMotionModels(const CodingStructure &cs, std::vector<MotionModelID> &motionModels)
+{
+  const int topK = m_pcEncCfg->getMMPreselectTopK();
+  std::fill_n(m_mmPreselectionRank, NUM_MODELS, -1);
+  if (topK <= 0 || cs.area.lumaSize().area() < m_pcEncCfg->getMMSizeConstraint())
+  {
+    // The non-classic models are not checked for blocks below the size constraint
+    return;
+  }
+  const size_t numCandidates = std::count_if(motionModels.begin(), motionModels.end(), [](MotionModelID m) { return m != CLASSIC; });
+  m_mmPreselectionStats.numCandidates += numCandidates;
+
+  const Slice &slice = *cs.slice;
+  const MMScreeningMotion &screening = m_mmScreeningMotion;
+  if (!screening.valid || screening.area != cs.area.Y() || screening.poc != slice.getPOC() || numCandidates == 0)
+  {
+    return;
+  }
+  const auto start = std::chrono::steady_clock::now();
+
+  // Co-located majority model, as voted for the motion model prediction of the CABAC coder
+  MotionModelID colModel = INVALID;
+  const Picture *const pColPic = slice.getRefPic(RefPicList(slice.isInterB() ? 1 - slice.getColFromL0Flag() : 0), int(slice.getColRefIdx()));
+  if (pColPic && pColPic->cs)
+  {
+    const RefPicList eColRefPicList = slice.getCheckLDC() ? REF_PIC_LIST_0 : RefPicList(slice.getColFromL0Flag());
+    int votes[NUM_MODELS + 1];
+    pColPic->countMotionModels(cs.area.Y(), eColRefPicList, votes);
+    int maxVotes = 0;
+    for (int i = 1; i <= NUM_MODELS; i++)
+    {
+      if (votes[i] > maxVotes)
+      {
+        maxVotes = votes[i];
+        colModel = MotionModelID(i - 1);
+      }
+    }
+  }
+
+  // Screening distortion of the best classic motion vector in each model
+  const Picture *refPic = slice.getRefPic(screening.refList, screening.refIdx);
+  const CPelBuf refBuf  = refPic->getRecoBuf(COMPONENT_Y, refPic->isWrapAroundEnabled(cs.pps));
+  const CPelBuf orgBuf  = cs.getOrgBuf(cs.area.Y());
+  const ClpRng &clpRng  = slice.clpRng(COMPONENT_Y);
+  const Position blkPos = cs.area.lumaPos();
+  const Size blkSize    = cs.area.lumaSize();
+  const Position center = blkPos.offset(int(blkSize.width / 2), int(blkSize.height / 2));
+  const int curPOC      = slice.getPOC();
+  const int refPOC      = refPic->getPOC();
+  std::vector<std::pair<Distortion, MotionModelID>> ranking;
+  for (const MotionModelID motionModel: motionModels)
+  {
+    if (motionModel == CLASSIC)
+    {
+      continue;
+    }
+    const Mv mv = m_mvReprojection->motionVectorInDesiredMotionModel(center, screening.mv, CLASSIC, motionModel,
+                                                                     MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
+                                                                     curPOC, refPOC, curPOC, refPOC, blkPos, blkSize, blkPos, blkSize,
+                                                                     m_mvReprojectionContext);
+    xMVReprojectionInterpolation(blkPos, blkSize, refBuf, mv, MV_PRECISION_INTERNAL, m_tmpMMStorage, motionModel, clpRng, curPOC, refPOC);
+    const CPelBuf predBuf(m_tmpMMStorage.buf, m_tmpMMStorage.stride, blkSize);
+    ranking.emplace_back(m_pcRdCost->getDistPart(orgBuf, predBuf, cs.sps->getBitDepth(CHANNEL_TYPE_LUMA), COMPONENT_Y, DF_SAD), motionModel);
+  }
+  std::stable_sort(ranking.begin(), ranking.end(),
+                   [](const std::pair<Distortion, MotionModelID> &lhs, const std::pair<Distortion, MotionModelID> &rhs) { return lhs.first < rhs.first; });
+
+  // Keep the top-K within the threshold and the co-located model, in the original model order
+  const double threshold = m_pcEncCfg->getMMPreselectThreshold();
+  std::vector<MotionModelID> kept;
+  for (int i = 0; i < int(ranking.size()); i++)
+  {
+    m_mmPreselectionRank[ranking[i].second] = i;
+    if ((i < topK && (threshold == 0.0 || double(ranking[i].first) <= threshold * double(ranking[0].first))) || ranking[i].second == colModel)
+    {
+      kept.push_back(ranking[i].second);
+    }
+    else
+    {
+      g_mmProfiler.addRank(i, MMProfiler::RANK_SKIPS);
+    }
+  }
+  motionModels.erase(std::remove_if(motionModels.begin(), motionModels.end(),
+                                    [&kept](MotionModelID m) { return m != CLASSIC && std::find(kept.begin(), kept.end(), m) == kept.end(); }),
+                     motionModels.end());
+  m_mmPreselectionStats.numSkipped += ranking.size() - kept.size();
+  m_mmPreselectionStats.screeningTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void InterSearch::addMMModelCheck(MotionModelID motionModel, double seconds, double rdGain)
+{
+  m_mmPreselectionStats.searchTime += seconds;
+  m_mmPreselectionStats.numSearched++;
+
+  const int rank = m_mmPreselectionRank[motionModel];
+  if (rank >= 0)
+  {
+    g_mmProfiler.addRank(rank, MMProfiler::RANK_CHECKS);
+    g_mmProfiler.addRank(rank, MMProfiler::RANK_CHECK_TIME, uint64_t(seconds * 1e9));
+    g_mmProfiler.addRank(rank, MMProfiler::RANK_RD_GAIN, uint64_t(std::llround(std::max(rdGain, 0.0))));
+  }
+}
+
+void InterSearch::printMMPreselectionStatistics() const
+{
+  if (m_pcEncCfg->getMMPreselectTopK() <= 0)
+  {
+    return;
+  }
+  const MMPreselectionStats &stats = m_mmPreselectionStats;
+  const double skipped = stats.numCandidates ? 100.0 * double(stats.numSkipped) / double(stats.numCandidates) : 0.0;
+  const double timePerCheck = stats.numSearched ? stats.searchTime / double(stats.numSearched) : 0.0;
+  msg(INFO, "\nMM pre-selection: %llu of %llu model checks skipped (%.2f %%), screening %.2f s, model checks %.2f s, est. %.2f s saved\n",
+      (unsigned long long) stats.numSkipped, (unsigned long long) stats.numCandidates, skipped, stats.screeningTime,
+      stats.searchTime, timePerCheck * double(stats.numSkipped) - stats.screeningTime);
+}
+
+void InterSearch::resetMMReprojectionCaches()
+{
+  m_mvReprojectionContext.resetReprojectionCache();
+  if (m_mmSearchWorkers)
+  {
+    for (int i = 0; i < m_pcEncCfg->getMMSearchThreads(); i++)
+    {
+      m_mmSearchWorkers[i].context.resetReprojectionCache();
+    }
+  }
+}
+
+void InterSearch::printMMReprojectionCacheStatistics() const
+{
+  ReprojectionCache::Statistics stats = m_mvReprojectionContext.reprojectionCache.getStatistics();
+  if (m_mmSearchWorkers)
+  {
+    for (int i = 0; i < m_pcEncCfg->getMMSearchThreads(); i++)
+    {
+      stats += m_mmSearchWorkers[i].context.reprojectionCache.getStatistics();
+    }
+  }
+  stats.print();
+}
+
+bool InterSearch::xIsLinearizableMotionModel(MotionModelID motionModel)
+{
+  // Models whose moved positions are smooth in the motion vector. MPA switches projection planes and 3DT is left exact.
+  return motionModel == TANGENTIAL || motionModel == ROTATIONAL || motionModel == GEODESIC_X || motionModel == GEODESIC_Y
+         || motionModel == GEODESIC_Z || motionModel == GEODESIC_CAMPOSE;
+}
+
+void InterSearch::xLinearizeMVReprojection(const IntTZSearchStruct &rcStruct, const Mv &center)
+{
+  MMLinearization &lin = m_mmLinearization;
+  const int range = MMLinearization::RANGE;
+  ChromaFormat tmpChFmt = CHROMA_400; // Dummy chroma format for MVReprojection -> Only luma is of interest.
+  lin.valid = true;
+  lin.blkPos = rcStruct.blkPos;
+  lin.blkSize = rcStruct.blkSize;
+  lin.motionModel = rcStruct.motionModel;
+  lin.curPOC = rcStruct.curPOC;
+  lin.refPOC = rcStruct.refPOC;
+  lin.center = center;
+
+  // The reprojected positions wrap around the horizontal seam of ERP. Blocks within the linearization range of the seam
+  // are reprojected exactly.
+  const int picWidth = int(m_mvReprojection->getResolution().width);
+  lin.exact = rcStruct.blkPos.x < range || rcStruct.blkPos.x + int(rcStruct.blkSize.width) + range > picWidth;
+  if (lin.exact)
+  {
+    return;
+  }
+
+  const Mv samples[5] = { center, center + Mv(range, 0), center - Mv(range, 0), center + Mv(0, range), center - Mv(0, range) };
+  for (int s = 0; s < 5; s++)
+  {
+    Mv mv = samples[s];
+    mv.changePrecision(MV_PRECISION_INT, MV_PRECISION_INTERNAL);
+    m_mvReprojection->reprojectMotionVectorSubblocks(rcStruct.blkPos, rcStruct.blkSize, mv, rcStruct.motionModel, COMPONENT_Y,
+                                                     tmpChFmt, rcStruct.curPOC, rcStruct.refPOC, m_subblockPositions,
+                                                     m_mvReprojectionContext);
+    const int num = m_subblockPositions.rows * m_subblockPositions.cols;
+    for (int i = 0; i < num; i++)
+    {
+      lin.sampled[s][0][i] = (m_subblockPositions.xPos[i] << MV_FRACTIONAL_BITS_INTERNAL) + m_subblockPositions.xFrac[i];
+      lin.sampled[s][1][i] = (m_subblockPositions.yPos[i] << MV_FRACTIONAL_BITS_INTERNAL) + m_subblockPositions.yFrac[i];
+    }
+  }
+
+  // Central differences over the linearization range keep the rounding error of the sampled positions small
+  lin.rows = m_subblockPositions.rows;
+  lin.cols = m_subblockPositions.cols;
+  const int num = lin.rows * lin.cols;
+  // A jump of more than half the picture width between the samples is a wrap around the seam
+  const int maxJump = (picWidth << MV_FRACTIONAL_BITS_INTERNAL) / 2;
+  for (int s = 1; s < 5; s++)
+  {
+    for (int i = 0; i < num; i++)
+    {
+      if (std::abs(lin.sampled[s][0][i] - lin.sampled[0][0][i]) > maxJump)
+      {
+        lin.exact = true;
+        return;
+      }
+    }
+  }
+  const float scale = 1.0f / float(2 * range);
+  for (int c = 0; c < 2; c++)
+  {
+    for (int i = 0; i < num; i++)
+    {
+      lin.base[c][i] = lin.sampled[0][c][i];
+      lin.jacHor[c][i] = float(lin.sampled[1][c][i] - lin.sampled[2][c][i]) * scale;
+      lin.jacVer[c][i] = float(lin.sampled[3][c][i] - lin.sampled[4][c][i]) * scale;
+    }
+  }
+}
+
+bool InterSearch::xLinearizedSubblockPositions(const IntTZSearchStruct &rcStruct, const Mv &mv)
+{
+  MMLinearization &lin = m_mmLinearization;
+  if (!lin.valid || lin.blkPos != rcStruct.blkPos || lin.blkSize != rcStruct.blkSize
+      || lin.motionModel != rcStruct.motionModel || lin.curPOC != rcStruct.curPOC || lin.refPOC != rcStruct.refPOC
+      || std::abs(mv.hor - lin.center.hor) > MMLinearization::RANGE || std::abs(mv.ver - lin.center.ver) > MMLinearization::RANGE)
+  {
+    xLinearizeMVReprojection(rcStruct, mv);
+  }
+  if (lin.exact)
+  {
+    return false;
+  }
+
+  const float dx = float(mv.hor - lin.center.hor);
+  const float dy = float(mv.ver - lin.center.ver);
+  const int fracMask = (1 << MV_FRACTIONAL_BITS_INTERNAL) - 1;
+  m_subblockPositions.rows = lin.rows;
+  m_subblockPositions.cols = lin.cols;
+  const int num = lin.rows * lin.cols;
+  for (int i = 0; i < num; i++)
+  {
+    const int fixedX = int(std::lround(float(lin.base[0][i]) + lin.jacHor[0][i] * dx + lin.jacVer[0][i] * dy));
+    const int fixedY = int(std::lround(float(lin.base[1][i]) + lin.jacHor[1][i] * dx + lin.jacVer[1][i] * dy));
+    m_subblockPositions.xPos[i] = fixedX >> MV_FRACTIONAL_BITS_INTERNAL;
+    m_subblockPositions.yPos[i] = fixedY >> MV_FRACTIONAL_BITS_INTERNAL;
+    m_subblockPositions.xFrac[i] = fixedX & fracMask;
+    m_subblockPositions.yFrac[i] = fixedY & fracMask;
+  }
+  return true;
+}
+
 void InterSearch::xMVReprojectionInterpolation(const Position &cuPosition,
                                                const Size &cuSize,
                                                const CPelBuf &refBuf,
@@ -6297,90 +6651,38 @@ void InterSearch::xMVReprojectionInterpolation(const Position &cuPosition,
   auto start_mvReprojTime = std::chrono::high_resolution_clock::now();
 #endif
   ChromaFormat tmpChFmt = CHROMA_400; // Dummy chroma format for MVReprojection -> Only luma is of interest.
-  ArrayXXFixedPtrPair cart2DProjMovedFixed4x4 = m_mvReprojection->reprojectMotionVectorSubblocks(
-    cuPosition, cuSize, mv, motionModel, COMPONENT_Y, tmpChFmt, curPOC, refPOC);
+  m_mvReprojection->reprojectMotionVectorSubblocks(cuPosition, cuSize, mv, motionModel, COMPONENT_Y, tmpChFmt, curPOC, refPOC,
+                                                   m_subblockPositions, m_mvReprojectionContext);
 #if INTERPRED_PROFILING
   auto end_mvReprojTime = std::chrono::high_resolution_clock::now();
   dbg_mvReprojTime += std::chrono::duration<double>(end_mvReprojTime - start_mvReprojTime).count();
 #endif
 
+  xSubblockInterpolation(cuSize, m_subblockPositions, refBuf, dstBuf, motionModel, clpRng, rndRes);
 #if INTERPRED_PROFILING
-  auto start_fracCalcTime = std::chrono::high_resolution_clock::now();
-#endif
-  ArrayXXFixed xPos, yPos;  // Integer pixel coordinates
-  ArrayXXFixed xFrac, yFrac; // Fractional pixel coordinates
-  xPos = std::get<0>(cart2DProjMovedFixed4x4)->unaryExpr([](int val){ return val >> MV_FRACTIONAL_BITS_INTERNAL; });
-  yPos = std::get<1>(cart2DProjMovedFixed4x4)->unaryExpr([](int val){ return val >> MV_FRACTIONAL_BITS_INTERNAL; });
-  xFrac = std::get<0>(cart2DProjMovedFixed4x4)->unaryExpr([](int val){ return val & ((1 << MV_FRACTIONAL_BITS_INTERNAL) - 1); });
-  yFrac = std::get<1>(cart2DProjMovedFixed4x4)->unaryExpr([](int val){ return val & ((1 << MV_FRACTIONAL_BITS_INTERNAL) - 1); });
-#if INTERPRED_PROFILING
-  auto end_fracCalcTime = std::chrono::high_resolution_clock::now();
-  dbg_fracCalcTime += std::chrono::duration<double>(end_fracCalcTime - start_fracCalcTime).count();
+  auto end_predBlkTime = std::chrono::high_resolution_clock::now();
+  dbg_predBlkTime += std::chrono::duration<double>(end_predBlkTime - start_predBlkTime).count();
 #endif
+}
 
-  bool useAltHpelIf = false;  // imv == IMV_HPEL; (Probably makes no sense for VA)
-  bool biMCForDMVR = false;  // DMVR not adapted for VA just yet.
-  const int filterIdx = biMCForDMVR ? InterpolationFilter::FILTER_DMVR : InterpolationFilter::FILTER_DEFAULT;
-
-  // Loop through all 4x4 blocks as every 4x4 block has an individual shift.
+void InterSearch::xSubblockInterpolation(const Size &cuSize, const SubblockPositions &positions, const CPelBuf &refBuf,
+                                         PelBuf &dstBuf, MotionModelID motionModel, const ClpRng &clpRng, bool rndRes)
+{
+  g_mmProfiler.add(motionModel, MMProfiler::PREDICTIONS);
+  MMProfiler::ScopedTimer timer(motionModel, MMProfiler::INTERPOLATION_TIME);
+  // All 4x4 blocks in one call, every 4x4 block has an individual shift.
 #if INTERPRED_PROFILING
   auto start_interpolTime = std::chrono::high_resolution_clock::now();
 #endif
   int maxCUWidth = 0; // int(m_pcEncCfg->getMaxCUWidth());
-  for (int col = 0; col < cuSize.width / 4; ++col) {
-    for (int row = 0; row < cuSize.height / 4; ++row) {
-      if (xPos(row, col) < -maxCUWidth or yPos(row, col) < -maxCUWidth or xPos(row, col) >= refBuf.width + maxCUWidth - 4 or yPos(row, col) >= refBuf.height + maxCUWidth - 4)
-      {
-        dstBuf.subBuf(col * 4, row * 4, 4, 4).memset(0);
-        continue;
-      }
-
-      if (yFrac(row, col) == 0)
-      {
-        m_if.filterHor(COMPONENT_Y,
-                       (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col),
-                       refBuf.stride,
-                       dstBuf.buf + row * 4 * dstBuf.stride + col * 4,
-                       dstBuf.stride,
-                       4, 4, xFrac(row, col), rndRes, clpRng, filterIdx, useAltHpelIf);
-      }
-      else if (xFrac(row, col) == 0)
-      {
-        m_if.filterVer(COMPONENT_Y,
-                       (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col),
-                       refBuf.stride,
-                       dstBuf.buf + row * 4 * dstBuf.stride + col * 4,
-                       dstBuf.stride,
-                       4, 4, yFrac(row, col), true, rndRes, clpRng, filterIdx, useAltHpelIf);
-      }
-      else
-      {
-        PelBuf tmpBuf = PelBuf(m_filteredBlockTmp[0][COMPONENT_Y], Size(4, 4));
-
-        int vFilterSize = NTAPS_LUMA;
-        if (biMCForDMVR)
-        {
-          vFilterSize = NTAPS_BILINEAR;
-        }
-        m_if.filterHor(COMPONENT_Y, (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col) - ((vFilterSize >> 1) - 1) * refBuf.stride,
-                       refBuf.stride,
-                       tmpBuf.buf,
-                       tmpBuf.stride,
-                       4, 4 + vFilterSize - 1, xFrac(row, col), false, clpRng, filterIdx, useAltHpelIf);
-        m_if.filterVer(COMPONENT_Y,
-                       (Pel *) tmpBuf.buf + ((vFilterSize >> 1) - 1) * tmpBuf.stride,
-                       tmpBuf.stride,
-                       dstBuf.buf + row * 4 * dstBuf.stride + col * 4,
-                       dstBuf.stride,
-                       4, 4, yFrac(row, col), false, rndRes, clpRng, filterIdx, useAltHpelIf);
-      }
-    }
-  }
+  const Position minPos(-maxCUWidth, -maxCUWidth);
+  const Position maxPos(refBuf.width + maxCUWidth - 4, refBuf.height + maxCUWidth - 4);
+  m_if.filterSubblocks(COMPONENT_Y, refBuf.buf, refBuf.stride, dstBuf.buf, dstBuf.stride, Size(4, 4), cuSize.height / 4,
+                       cuSize.width / 4, positions.xPos, positions.yPos, positions.xFrac, positions.yFrac, minPos,
+                       maxPos, rndRes, clpRng);
 #if INTERPRED_PROFILING
   auto end_interpolTime = std::chrono::high_resolution_clock::now();
   dbg_interpolTime += std::chrono::duration<double>(end_interpolTime - start_interpolTime).count();
-  auto end_predBlkTime = std::chrono::high_resolution_clock::now();
-  dbg_predBlkTime += std::chrono::duration<double>(end_predBlkTime - start_predBlkTime).count();
 #endif
 }
 
@@ -9234,7 +9536,7 @@ void InterSearch::xEstimateAffineAMVP(PredictionUnit &pu, AffineAMVPInfo &affine
 #endif
 
   // Fill the MV Candidates
-  PU::fillAffineMvpCand( pu, eRefPicList, refIdx, affineAMVPInfo, m_mvReprojection );
+  PU::fillAffineMvpCand( pu, eRefPicList, refIdx, affineAMVPInfo, m_mvReprojection, m_mvReprojectionContext );
   CHECK( affineAMVPInfo.numCand == 0, "Assertion failed." );
 
   PelUnitBuf predBuf = m_tmpStorageLCU.getBuf( UnitAreaRelative(*pu.cu, pu) );
@@ -52,6 +52,8 @@
 #include "CommonLib/AffineGradientSearch.h"
 #include "CommonLib/IbcHashMap.h"
 #include "CommonLib/Hash.h"
+#include "CommonLib/WorkerPool.h"
+#include <functional>
 #include <unordered_map>
 #include <vector>
 #include "EncReshape.h"
@@ -193,6 +195,66 @@ protected:
   // Multi-model inter prediction
   CompStorage m_tmpMMStorage;  // Buffer for interpolated reprojected pixel data during multi-model motion estimation
 
+  /// First-order model of the reprojected subblock positions (1/16 luma sample units) around an integer search center.
+  /// Used by the integer motion search if MMLinearizedSearch is enabled; fractional refinement remains exact.
+  struct MMLinearization
+  {
+    static const int RANGE = 8;  ///< Maximum integer motion vector distance from the center before re-linearization
+
+    bool          valid{false};
+    bool          exact{false};  ///< The positions are not smooth around the center (ERP seam), reproject exactly
+    Position      blkPos;
+    Size          blkSize;
+    MotionModelID motionModel{CLASSIC};
+    int           curPOC{0};
+    int           refPOC{0};
+    Mv            center;
+    int           rows{0};
+    int           cols{0};
+    int           base[2][SubblockPositions::MAX_NUM_SUBBLOCKS];
+    float         jacHor[2][SubblockPositions::MAX_NUM_SUBBLOCKS];
+    float         jacVer[2][SubblockPositions::MAX_NUM_SUBBLOCKS];
+    int           sampled[5][2][SubblockPositions::MAX_NUM_SUBBLOCKS];  ///< Scratch for the sampled fixed positions
+  };
+  MMLinearization m_mmLinearization;
+
+  /// Scratch of one thread evaluating integer motion search candidates of a non-classic motion model
+  struct MMSearchWorker
+  {
+    MVReprojectionContext context;
+    SubblockPositions     positions;
+    CompStorage           pred;
+  };
+  WorkerPool              m_mmSearchPool;
+  MMSearchWorker         *m_mmSearchWorkers;
+  bool                    m_mmSearchCollect;  ///< xTZSearchHelp only records the candidates it is called with
+  std::vector<Mv>         m_mmSearchCandidates;  ///< Candidates of the current batch in search order
+  std::vector<Distortion> m_mmSearchDistortions;  ///< Distortions of the batch candidates, computed in parallel
+  size_t                  m_mmSearchNext;  ///< Next batch candidate expected by xTZSearchHelp
+
+  /// Best uni-prediction of the last classic search without IMV, used to screen the other motion models of the CU
+  struct MMScreeningMotion
+  {
+    bool       valid{false};
+    Area       area;
+    int        poc{0};
+    RefPicList refList{REF_PIC_LIST_0};
+    int        refIdx{0};
+    Mv         mv;
+  };
+  MMScreeningMotion m_mmScreeningMotion;
+
+  struct MMPreselectionStats
+  {
+    uint64_t numCandidates{0};  ///< Non-classic model checks requested before pre-selection
+    uint64_t numSkipped{0};
+    uint64_t numSearched{0};
+    double   screeningTime{0.0};  ///< Seconds spent screening
+    double   searchTime{0.0};  ///< Seconds spent in the non-classic model checks that were run
+  };
+  MMPreselectionStats m_mmPreselectionStats;
+  int                 m_mmPreselectionRank[NUM_MODELS];  ///< Screening rank of the models of the current CU, -1 if not screened
+
 public:
   InterSearch();
   virtual ~InterSearch();
@@ -359,6 +421,17 @@ public:
 #endif
   bool searchBv(PredictionUnit& pu, int xPos, int yPos, int width, int height, int picWidth, int picHeight, int xBv, int yBv, int ctuSize);
   void setClipMvInSubPic(bool flag) { m_clipMvInSubPic = flag; }
+
+  /// Reduce the non-classic motion models of the CU to the MMPreselectTopK models whose prediction with the best classic
+  /// motion vector, reprojected into the model, has the lowest SAD. The model voted by the co-located picture is kept.
+  void preselectMotionModels(const CodingStructure &cs, std::vector<MotionModelID> &motionModels);
+  /// Account a non-classic model check of the current CU, rdGain is the decrease of the best RD cost by the check
+  void addMMModelCheck(MotionModelID motionModel, double seconds, double rdGain);
+  void printMMPreselectionStatistics() const;
+  /// Clear the reprojection caches of the main context and of the motion search threads, e.g. at the start of a CTU
+  void resetMMReprojectionCaches();
+  /// Print the reprojection cache statistics summed over the main context and the motion search threads
+  void printMMReprojectionCacheStatistics() const;
 protected:
 
    typedef struct
@@ -553,6 +626,26 @@ protected:
 
   inline void xApplyMvVA(const IntTZSearchStruct &rcStruct, const Mv &rMv, MvPrecision mvPrec);
 
+  static bool xIsLinearizableMotionModel(MotionModelID motionModel);
+  /// Linearize the reprojected subblock positions of the search block around the integer motion vector center
+  void xLinearizeMVReprojection(const IntTZSearchStruct &rcStruct, const Mv &center);
+  /// Predict the subblock positions for an integer motion vector from the linearization, re-linearizing if out of range.
+  /// Returns false if the positions have to be reprojected exactly, because the block or the sampled positions cross the
+  /// horizontal seam of the picture.
+  bool xLinearizedSubblockPositions(const IntTZSearchStruct &rcStruct, const Mv &mv);
+  /// Interpolate all 4x4 luma subblocks at the given positions.
+  void xSubblockInterpolation(const Size &cuSize, const SubblockPositions &positions, const CPelBuf &refBuf, PelBuf &dstBuf,
+                              MotionModelID motionModel, const ClpRng &clpRng, bool rndRes);
+
+  /// Run a TZ search step. If MMSearchThreads > 1 and the model is not classic, the candidates the step visits are first
+  /// collected in a dry run on a copy of rcStruct and their distortions computed on the worker pool. The step itself
+  /// then consumes them in the serial order, so the result is identical to the serial search. Models searched with
+  /// MMLinearizedSearch are always searched serially: the linearization is re-centered in the order the candidates are
+  /// visited, so evaluating them out of order would change the result.
+  void xTZSearchStep(IntTZSearchStruct &rcStruct, const std::function<void(IntTZSearchStruct &)> &step);
+  Distortion xMMSearchDistortion(const IntTZSearchStruct &rcStruct, const Mv &mv, MMSearchWorker &worker,
+                                 DistParam distParam);
+
   void xMVReprojectionInterpolation ( const Position&  cuPosition,
                                       const Size&      cuSize,
                                       const CPelBuf&   refBuf,
@@ -1292,6 +1292,7 @@ void HLSWriter::codeSPS( const SPS* pcSPS )
   bool sps_extension_flags[NUM_SPS_EXTENSION_FLAGS]={false};
 
   sps_extension_flags[SPS_EXT__REXT] = pcSPS->getSpsRangeExtension().settingsDifferFromDefaults();
+  sps_extension_flags[SPS_EXT__MM]   = pcSPS->getUseMultiModel() && (pcSPS->getUseMMFixedPoint() || pcSPS->getUseMMDMVRWindow());
 
   // Other SPS extension flags checked here.
 
@@ -1306,13 +1307,13 @@ void HLSWriter::codeSPS( const SPS* pcSPS )
   {
 #if ENABLE_TRACING /*|| RExt__DECODER_DEBUG_BIT_STATISTICS*/
     static const char *syntaxStrings[]={ "sps_range_extension_flag",
-      "sps_extension_7bits[0]",
-      "sps_extension_7bits[1]",
-      "sps_extension_7bits[2]",
-      "sps_extension_7bits[3]",
-      "sps_extension_7bits[4]",
-      "sps_extension_7bits[5]",
-      "sps_extension_7bits[6]" };
+      "sps_mm_extension_flag",
+      "sps_extension_6bits[0]",
+      "sps_extension_6bits[1]",
+      "sps_extension_6bits[2]",
+      "sps_extension_6bits[3]",
+      "sps_extension_6bits[4]",
+      "sps_extension_6bits[5]" };
 #endif
 
     if (pcSPS->getBitDepth(CHANNEL_TYPE_LUMA) <= 10)
@@ -1344,6 +1345,10 @@ void HLSWriter::codeSPS( const SPS* pcSPS )
           WRITE_FLAG( (spsRangeExtension.getReverseLastSigCoeffEnabledFlag() ? 1 : 0),        "reverse_last_sig_coeff_enabled_flag" );
           break;
         }
+        case SPS_EXT__MM:
+          WRITE_FLAG( (pcSPS->getUseMMFixedPoint() ? 1 : 0),                                  "sps_mm_fixed_point_flag" );
+          WRITE_FLAG( (pcSPS->getUseMMDMVRWindow() ? 1 : 0),                                  "sps_mm_dmvr_window_flag" );
+          break;
         default:
           CHECK(sps_extension_flags[i]!=false, "Unknown PPS extension signalled"); // Should never get here with an active SPS extension flag.
           break;
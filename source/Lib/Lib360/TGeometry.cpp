@@ -81,6 +81,11 @@
 #if SVIDEO_GENERALIZED_CUBEMAP
 #include "TGeneralizedCubeMap.h"
 #endif
+#if SVIDEO_GEOMAP_CACHE
+#include "TMappedFile.h"
+#include "TSphPointSet.h"
+#include <random>
+#endif
 
 #if EXTENSION_360_VIDEO
 
@@ -191,6 +196,9 @@ TGeometry::TGeometry()
   m_bGeometryMapping          = false;
   m_WeightMap_NumOfBits4Faces = 0;
   memset(m_pPixelWeight, 0, sizeof(m_pPixelWeight));
+#if SVIDEO_GEOMAP_CACHE
+  m_pGeoMapFile = nullptr;
+#endif
   m_interpolateWeight[0] = m_interpolateWeight[1] = nullptr;
   m_iLanczosParamA[0] = m_iLanczosParamA[1] = 0;
   m_pfLanczosFltCoefLut[0] = m_pfLanczosFltCoefLut[1] = nullptr;
@@ -306,6 +314,9 @@ TGeometry::~TGeometry()
     xFree(m_pUpsTempBuf);
     m_pUpsTempBuf = nullptr;
   }
+#if SVIDEO_GEOMAP_CACHE
+  xReleaseGeoMapFile();
+#endif
   for (Int i = 0; i < SV_MAX_NUM_FACES; i++)
   {
     if (m_pPixelWeight[i])
@@ -932,6 +943,26 @@ Void TGeometry::geometryMapping(TGeometry *pGeoSrc)
   }
 #endif
 
+#if SVIDEO_GEOMAP_CACHE
+  // maps loaded from a cache file are read only, a new mapping is generated into its own buffers;
+  xReleaseGeoMapFile();
+  std::string geoMapFile;
+  uint64_t    uiGeoMapKey = 0;
+  if (!m_geoMapCacheDir.empty() && m_sVideoInfo.geoType != SVIDEO_VIEWPORT)
+  {
+#if SVIDEO_ROT_FIX
+    geoMapFile = xGetGeoMapCacheFile(pGeoSrc, pRot, bRec, iNumMaps, uiGeoMapKey);
+#else
+    geoMapFile = xGetGeoMapCacheFile(pGeoSrc, pRot, false, iNumMaps, uiGeoMapKey);
+#endif
+    if (xLoadGeoMaps(geoMapFile, uiGeoMapKey, iNumMaps))
+    {
+      m_bGeometryMapping = true;
+      return;
+    }
+  }
+#endif
+
   for (Int fIdx = 0; fIdx < m_sVideoInfo.iNumFaces; fIdx++)
   {
 #if SVIDEO_GENERALIZED_CUBEMAP
@@ -952,7 +983,12 @@ Void TGeometry::geometryMapping(TGeometry *pGeoSrc)
 
       if (!m_pPixelWeight[fIdx][ch])
       {
+#if SVIDEO_GEOMAP_CACHE
+        // value initialized, so that the samples skipped outside the faces are stored deterministically;
+        m_pPixelWeight[fIdx][ch] = new PxlFltLut[iWidthPW * iHeightPW]();
+#else
         m_pPixelWeight[fIdx][ch] = new PxlFltLut[iWidthPW * iHeightPW];
+#endif
       }
     }
   }
@@ -964,6 +1000,17 @@ Void TGeometry::geometryMapping(TGeometry *pGeoSrc)
     ((TViewPort *) this)->setInvK();
   }
   // generate the map;
+#if SVIDEO_PARALLEL_GEOCONVERT
+  std::vector<GeoMappingTile> tiles;
+  xGetMappingTiles(tiles, iNumMaps);
+  m_geoConvertPool.parallelFor(Int(tiles.size()), [&](Int iTile, Int iWorker) {
+    xGeometryMappingTile(pGeoSrc, tiles[iTile]
+#if SVIDEO_ROT_FIX
+                         , pfuncRotation
+#endif
+                         , pRot);
+  });
+#else
   for (Int fIdx = 0; fIdx < m_sVideoInfo.iNumFaces; fIdx++)
   {
 #if SVIDEO_GENERALIZED_CUBEMAP
@@ -1060,6 +1107,13 @@ Void TGeometry::geometryMapping(TGeometry *pGeoSrc)
         }
     }
   }
+#endif
+#if SVIDEO_GEOMAP_CACHE
+  if (!geoMapFile.empty())
+  {
+    xStoreGeoMaps(geoMapFile, uiGeoMapKey, iNumMaps);
+  }
+#endif
   m_bGeometryMapping = true;
 }
 
@@ -1083,6 +1137,13 @@ Void TGeometry::geoConvert(TGeometry *pGeoDst
     pGeoDst->geometryMapping(this);
 #endif
 
+#if SVIDEO_PARALLEL_GEOCONVERT
+  std::vector<GeoMappingTile> tiles;
+  pGeoDst->xGetMappingTiles(tiles, pGeoDst->getNumChannels());
+  pGeoDst->m_geoConvertPool.parallelFor(Int(tiles.size()), [&](Int iTile, Int iWorker) {
+    xGeoConvertTile(pGeoDst, tiles[iTile]);
+  });
+#else
   Int nFaces             = pGeoDst->m_sVideoInfo.iNumFaces;
   Int iBDPrecision       = S_INTERPOLATE_PrecisionBD;
   Int iWeightMapFaceMask = (1 << m_WeightMap_NumOfBits4Faces) - 1;
@@ -1178,10 +1239,455 @@ Void TGeometry::geoConvert(TGeometry *pGeoDst
         }
     }
   }
+#endif
 
   pGeoDst->setPaddingFlag(pGeoDst->m_bConvOutputPaddingNeeded ? true : false);
 }
 
+#if SVIDEO_PARALLEL_GEOCONVERT
+/***************************************************
+//split the faces of this geometry into tiles of SVIDEO_GEOCONVERT_TILE_ROWS rows per channel, margins included;
+//every sample of the mapping is computed independently, so the tiles can be processed in any order;
+****************************************************/
+Void TGeometry::xGetMappingTiles(std::vector<GeoMappingTile> &tiles, Int iNumChannels)
+{
+  tiles.clear();
+  for (Int fIdx = 0; fIdx < m_sVideoInfo.iNumFaces; fIdx++)
+  {
+#if SVIDEO_GENERALIZED_CUBEMAP
+    if (m_sVideoInfo.geoType == SVIDEO_GENERALIZEDCUBEMAP
+        && (m_sVideoInfo.iGCMPPackingType == 4 || m_sVideoInfo.iGCMPPackingType == 5))
+    {
+      Int virtualFaceIdx = m_sVideoInfo.iGCMPPackingType == 4 ? m_sVideoInfo.framePackStruct.faces[0][5].id
+                                                              : m_sVideoInfo.framePackStruct.faces[5][0].id;
+      if (fIdx == virtualFaceIdx)
+        continue;
+    }
+#endif
+    for (Int ch = 0; ch < iNumChannels; ch++)
+    {
+      ComponentID chId     = (ComponentID) ch;
+      Int         iHeight  = m_sVideoInfo.iFaceHeight >> getComponentScaleY(chId);
+      Int         nMarginY = m_iMarginY >> getComponentScaleY(chId);
+      for (Int j = -nMarginY; j < iHeight + nMarginY; j += SVIDEO_GEOCONVERT_TILE_ROWS)
+      {
+        GeoMappingTile tile;
+        tile.fIdx      = fIdx;
+        tile.ch        = ch;
+        tile.iRowStart = j;
+        tile.iRowEnd   = std::min(j + SVIDEO_GEOCONVERT_TILE_ROWS, iHeight + nMarginY);
+        tiles.push_back(tile);
+      }
+    }
+  }
+}
+
+Void TGeometry::xGeometryMappingTile(TGeometry *pGeoSrc, const GeoMappingTile &tile
+#if SVIDEO_ROT_FIX
+                                     , Void (TGeometry::*pfuncRotation)(SPos &sPos, Int iRoll, Int iPitch, Int iYaw)
+#endif
+                                     , const Int *pRot)
+{
+  Int         fIdx      = tile.fIdx;
+  Int         ch        = tile.ch;
+  ComponentID chId      = (ComponentID) ch;
+  Int         iStridePW = getStride(chId);
+  Int         iWidth    = m_sVideoInfo.iFaceWidth >> getComponentScaleX(chId);
+  Int         nMarginX  = m_iMarginX >> getComponentScaleX(chId);
+  Int         nMarginY  = m_iMarginY >> getComponentScaleY(chId);
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+  Double chromaOffsetSrc[2] = { 0.0, 0.0 };   //[0: X; 1: Y];
+  Double chromaOffsetDst[2] = { 0.0, 0.0 };   //[0: X; 1: Y];
+  getFaceChromaOffset(chromaOffsetDst, fIdx, chId);
+#endif
+  for (Int j = tile.iRowStart; j < tile.iRowEnd; j++)
+    for (Int i = -nMarginX; i < iWidth + nMarginX; i++)
+    {
+      if (!m_bConvOutputPaddingNeeded
+          && !insideFace(fIdx, (i << getComponentScaleX(chId)), (j << getComponentScaleY(chId)), COMPONENT_Y, chId))
+        continue;
+
+      Int xOrg = (i + nMarginX);
+      Int yOrg = (j + nMarginY);
+      PxlFltLut &wList = m_pPixelWeight[fIdx][ch][yOrg * iStridePW + xOrg];
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+      POSType x = i * (1 << getComponentScaleX(chId)) + chromaOffsetDst[0];
+      POSType y = j * (1 << getComponentScaleY(chId)) + chromaOffsetDst[1];
+#else
+      POSType x = i * (1 << getComponentScaleX(chId));
+      POSType y = j * (1 << getComponentScaleY(chId));
+#endif
+      SPos in(fIdx, x, y, 0), pos3D;
+
+#if SVIDEO_FISHEYE
+      Double cnt_x = m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_x;
+      Double cnt_y = m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_y;
+      Double dist  = ssqrt((x + 0.5 - cnt_x) * (x + 0.5 - cnt_x) + (y + 0.5 - cnt_y) * (y + 0.5 - cnt_y));
+
+      if (m_sVideoInfo.geoType != SVIDEO_FISHEYE_CIRCULAR
+          || dist < (Double)(m_sVideoInfo.sFisheyeInfo.fCircularRegionRadius) - 0.5)
+      {
+#endif
+        map2DTo3D(in, &pos3D);
+#if SVIDEO_ROT_FIX
+        (this->*pfuncRotation)(pos3D, pRot[0], pRot[1], pRot[2]);
+#else
+        rotate3D(pos3D, pRot[0], pRot[1], pRot[2]);
+#endif
+        pGeoSrc->map3DTo2D(&pos3D, &pos3D);
+#if SVIDEO_HEMI_PROJECTIONS
+        if (((Int)(pGeoSrc->getType()) == SVIDEO_HCMP || (Int)(pGeoSrc->getType()) == SVIDEO_HEAC)
+            && pos3D.faceIdx == 7)
+        {
+          pos3D.faceIdx = 0;
+          pos3D.x       = 0;
+          pos3D.y       = 0;
+        }
+#endif
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+        pGeoSrc->getFaceChromaOffset(chromaOffsetSrc, pos3D.faceIdx, chId);
+        pos3D.x = (pos3D.x - chromaOffsetSrc[0]) / POSType(1 << getComponentScaleX(chId));
+        pos3D.y = (pos3D.y - chromaOffsetSrc[1]) / POSType(1 << getComponentScaleY(chId));
+#else
+        pos3D.x = pos3D.x / POSType(1 << getComponentScaleX(chId));
+        pos3D.y = pos3D.y / POSType(1 << getComponentScaleY(chId));
+#endif
+        (pGeoSrc->*pGeoSrc->m_interpolateWeight[toChannelType(chId)])(chId, &pos3D, wList);
+#if SVIDEO_FISHEYE
+      }
+      else if (m_sVideoInfo.geoType == SVIDEO_FISHEYE_CIRCULAR)
+      {
+        pos3D.faceIdx = 0;
+        pos3D.x       = 0;
+        pos3D.y       = 0;
+        (pGeoSrc->*pGeoSrc->m_interpolateWeight[toChannelType(chId)])(chId, &pos3D, wList);
+      }
+#endif
+    }
+}
+
+Void TGeometry::xGeoConvertTile(TGeometry *pGeoDst, const GeoMappingTile &tile)
+{
+  Int         iBDPrecision       = S_INTERPOLATE_PrecisionBD;
+  Int         iWeightMapFaceMask = (1 << m_WeightMap_NumOfBits4Faces) - 1;
+  Int         iOffset            = 1 << (iBDPrecision - 1);
+  Int         fIdx               = tile.fIdx;
+  Int         ch                 = tile.ch;
+  ComponentID chId               = (ComponentID) ch;
+  Int         nWidth             = pGeoDst->m_sVideoInfo.iFaceWidth >> pGeoDst->getComponentScaleX(chId);
+  Int         nMarginX           = pGeoDst->m_iMarginX >> pGeoDst->getComponentScaleX(chId);
+  Int         nMarginY           = pGeoDst->m_iMarginY >> pGeoDst->getComponentScaleY(chId);
+  Int         iWidthPW           = pGeoDst->getStride(chId);
+  Int         mapIdx =
+    (pGeoDst->m_chromaFormatIDC == CHROMA_444
+     && pGeoDst->m_InterpolationType[CHANNEL_TYPE_LUMA] == pGeoDst->m_InterpolationType[CHANNEL_TYPE_CHROMA])
+      ? 0
+      : (ch > 0 ? 1 : 0);
+  ChannelType chType   = toChannelType(chId);
+  Int         iWLutIdx = (m_chromaFormatIDC == CHROMA_400 || (m_InterpolationType[0] == m_InterpolationType[1])) ? 0 : chType;
+  Int         iStrideSrc = getStride(chId);
+  Int         iTapsX     = m_iInterpFilterTaps[chType][0];
+  Int         iTapsY     = m_iInterpFilterTaps[chType][1];
+  Int         iTLOffset  = ((iTapsY - 1) >> 1) * iStrideSrc + ((iTapsX - 1) >> 1);
+
+  for (Int j = tile.iRowStart; j < tile.iRowEnd; j++)
+  {
+    Pel *pDstLine = pGeoDst->m_pFacesOrig[fIdx][ch] + j * pGeoDst->getStride(chId);
+    for (Int i = -nMarginX; i < nWidth + nMarginX; i++)
+    {
+      if (!pGeoDst->m_bConvOutputPaddingNeeded
+          && !pGeoDst->insideFace(fIdx, (i << pGeoDst->getComponentScaleX(chId)),
+                                  (j << pGeoDst->getComponentScaleY(chId)), COMPONENT_Y, chId))
+        continue;
+
+#if SVIDEO_FISHEYE
+      if (pGeoDst->m_sVideoInfo.geoType == SVIDEO_FISHEYE_CIRCULAR)
+      {
+        Int    xx    = i << pGeoDst->getComponentScaleX(chId);
+        Int    yy    = j << pGeoDst->getComponentScaleY(chId);
+        Double cnt_x = pGeoDst->m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_x;
+        Double cnt_y = pGeoDst->m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_y;
+        Double dist  = ssqrt((xx + 0.5 - cnt_x) * (xx + 0.5 - cnt_x) + (yy + 0.5 - cnt_y) * (yy + 0.5 - cnt_y));
+        if (dist >= (Double)(pGeoDst->m_sVideoInfo.sFisheyeInfo.fCircularRegionRadius) - 0.5)
+        {
+          pDstLine[i] = 1 << (m_nBitDepth - 1);
+          continue;
+        }
+      }
+#endif
+      PxlFltLut *pPelWeight = pGeoDst->m_pPixelWeight[fIdx][mapIdx] + (j + nMarginY) * iWidthPW + (i + nMarginX);
+      Int        face       = (pPelWeight->facePos) & iWeightMapFaceMask;
+      Int        iTLPos     = (pPelWeight->facePos) >> m_WeightMap_NumOfBits4Faces;
+      Int       *pWLut      = m_pWeightLut[iWLutIdx][pPelWeight->weightIdx];
+      Pel       *pPelLine   = m_pFacesOrig[face][ch] + iTLPos - iTLOffset;
+      Int        sum        = 0;
+      for (Int m = 0; m < iTapsY; m++)
+      {
+        for (Int n = 0; n < iTapsX; n++)
+          sum += pPelLine[n] * pWLut[n];
+        pPelLine += iStrideSrc;
+        pWLut += iTapsX;
+      }
+#if SVIDEO_GEOCONVERT_CLIP
+      pDstLine[i] = ClipBD((sum + iOffset) >> iBDPrecision, m_nBitDepth);
+#else
+      pDstLine[i] = (sum + iOffset) >> iBDPrecision;
+#endif
+    }
+  }
+}
+#endif
+
+#if SVIDEO_BINARY_SPHERE_POINTS
+//appends everything the sample positions of this geometry depend on: the geometry with its face size, frame packing and rotation, and the chroma format;
+Void TGeometry::getCacheKey(std::vector<Int> &key)
+{
+  auto addFloat = [&key](Float f) { Int i; memcpy(&i, &f, sizeof(i)); key.push_back(i); };
+
+  key.push_back(m_sVideoInfo.geoType);
+  key.push_back(m_sVideoInfo.iFaceWidth);
+  key.push_back(m_sVideoInfo.iFaceHeight);
+  key.push_back(m_sVideoInfo.iNumFaces);
+  key.push_back(m_sVideoInfo.iCompactFPStructure);
+  key.push_back(m_sVideoInfo.framePackStruct.chromaFormatIDC);
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+  key.push_back(m_sVideoInfo.framePackStruct.chromaSampleLocType);
+#endif
+  key.push_back(getComponentScaleX(COMPONENT_Cb));
+  key.push_back(getComponentScaleY(COMPONENT_Cb));
+  key.push_back(m_sVideoInfo.framePackStruct.rows);
+  key.push_back(m_sVideoInfo.framePackStruct.cols);
+  for (Int r = 0; r < m_sVideoInfo.framePackStruct.rows; r++)
+  {
+    for (Int c = 0; c < m_sVideoInfo.framePackStruct.cols; c++)
+    {
+      const FaceProperty &face = m_sVideoInfo.framePackStruct.faces[r][c];
+      key.push_back(face.id);
+      key.push_back(face.rot);
+      key.push_back(face.width);
+      key.push_back(face.height);
+    }
+  }
+  for (Int i = 0; i < 3; i++)
+  {
+    key.push_back(m_sVideoInfo.sVideoRotation.degree[i]);
+  }
+  addFloat(m_sVideoInfo.viewPort.hFOV);
+  addFloat(m_sVideoInfo.viewPort.vFOV);
+  addFloat(m_sVideoInfo.viewPort.fYaw);
+  addFloat(m_sVideoInfo.viewPort.fPitch);
+#if SVIDEO_HEMI_PROJECTIONS
+  key.push_back(m_sVideoInfo.hemiFlag);
+  key.push_back(m_sVideoInfo.bPCMP);
+#endif
+#if SVIDEO_SUB_SPHERE
+  key.push_back(m_sVideoInfo.subSphere.bPresent);
+  key.push_back(m_sVideoInfo.subSphere.iCenterYaw);
+  key.push_back(m_sVideoInfo.subSphere.iCenterPitch);
+  key.push_back(m_sVideoInfo.subSphere.iYawRange);
+  key.push_back(m_sVideoInfo.subSphere.iPitchRange);
+#endif
+#if SVIDEO_ERP_PADDING
+  key.push_back(m_sVideoInfo.bPERP);
+#endif
+#if SVIDEO_FISHEYE
+  addFloat(m_sVideoInfo.sFisheyeInfo.fCentreAzimuth);
+  addFloat(m_sVideoInfo.sFisheyeInfo.fCentreElevation);
+  addFloat(m_sVideoInfo.sFisheyeInfo.fCentreTilt);
+  addFloat(m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_x);
+  addFloat(m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_y);
+  addFloat(m_sVideoInfo.sFisheyeInfo.fCircularRegionRadius);
+  addFloat(m_sVideoInfo.sFisheyeInfo.fFOV);
+  key.push_back(m_sVideoInfo.sFisheyeInfo.iRectTop);
+  key.push_back(m_sVideoInfo.sFisheyeInfo.iRectLeft);
+  key.push_back(m_sVideoInfo.sFisheyeInfo.iRectWidth);
+  key.push_back(m_sVideoInfo.sFisheyeInfo.iRectHeight);
+#endif
+#if SVIDEO_GENERALIZED_CUBEMAP
+  key.push_back(m_sVideoInfo.iGCMPPackingType);
+  key.push_back(m_sVideoInfo.iGCMPMappingType);
+  for (Int i = 0; i < 6; i++)
+  {
+    addFloat(m_sVideoInfo.GCMPSettings.fCoeffU[i]);
+    addFloat(m_sVideoInfo.GCMPSettings.fCoeffV[i]);
+    key.push_back(m_sVideoInfo.GCMPSettings.bUAffectedByV[i]);
+    key.push_back(m_sVideoInfo.GCMPSettings.bVAffectedByU[i]);
+  }
+  key.push_back(m_sVideoInfo.bPGCMP);
+#if SVIDEO_GCMP_PADDING_TYPE
+  key.push_back(m_sVideoInfo.iPGCMPPaddingType);
+#endif
+  key.push_back(m_sVideoInfo.bPGCMPBoundary);
+  key.push_back(m_sVideoInfo.iPGCMPSize);
+#endif
+}
+#endif
+
+#if SVIDEO_GEOMAP_CACHE
+//cached map file: header followed by the maps of all faces and channels in the order they are generated;
+struct GeoMapFileHeader
+{
+  TChar    magic[8];
+  UInt     version;
+  UInt     numMaps;
+  UInt     numEntries;
+  UInt     reserved;
+  uint64_t key;
+};
+
+static const TChar S_GEOMAP_MAGIC[8] = { 'G', 'E', 'O', 'M', 'A', 'P', '\0', '\0' };
+static const UInt  S_GEOMAP_VERSION  = 1;
+
+Bool TGeometry::xIsVirtualFace(Int fIdx)
+{
+#if SVIDEO_GENERALIZED_CUBEMAP
+  if (m_sVideoInfo.geoType == SVIDEO_GENERALIZEDCUBEMAP
+      && (m_sVideoInfo.iGCMPPackingType == 4 || m_sVideoInfo.iGCMPPackingType == 5))
+  {
+    Int virtualFaceIdx = m_sVideoInfo.iGCMPPackingType == 4 ? m_sVideoInfo.framePackStruct.faces[0][5].id
+                                                            : m_sVideoInfo.framePackStruct.faces[5][0].id;
+    return fIdx == virtualFaceIdx;
+  }
+#endif
+  return false;
+}
+
+//the key covers both geometries, their buffers and interpolation filters, and the rotation between them;
+std::string TGeometry::xGetGeoMapCacheFile(TGeometry *pGeoSrc, const Int *pRot, Bool bInvRotation, Int iNumMaps, uint64_t &ruiKey)
+{
+  std::vector<Int> key;
+  key.push_back(S_GEOMAP_VERSION);
+  key.push_back((Int) sizeof(PxlFltLut));
+  key.push_back(iNumMaps);
+  key.push_back(m_bConvOutputPaddingNeeded);
+  key.push_back(pRot[0]);
+  key.push_back(pRot[1]);
+  key.push_back(pRot[2]);
+  key.push_back(bInvRotation);
+  TGeometry *pGeo[2] = { this, pGeoSrc };
+  for (Int i = 0; i < 2; i++)
+  {
+    pGeo[i]->getCacheKey(key);
+    key.push_back(pGeo[i]->m_chromaFormatIDC);
+    key.push_back(pGeo[i]->m_iMarginX);
+    key.push_back(pGeo[i]->m_iMarginY);
+    key.push_back(pGeo[i]->m_InterpolationType[CHANNEL_TYPE_LUMA]);
+    key.push_back(pGeo[i]->m_InterpolationType[CHANNEL_TYPE_CHROMA]);
+    key.push_back(pGeo[i]->m_iChromaSampleLocType);
+    key.push_back(pGeo[i]->m_WeightMap_NumOfBits4Faces);
+  }
+  ruiKey = TSphPointSet::hash(key.data(), key.size() * sizeof(Int));
+
+  TChar fileName[160];
+  snprintf(fileName, sizeof(fileName), "geomap_geo%d_%dx%d_to_geo%d_%dx%d_%016llx.bin", pGeoSrc->m_sVideoInfo.geoType,
+           pGeoSrc->m_sVideoInfo.iFaceWidth, pGeoSrc->m_sVideoInfo.iFaceHeight, m_sVideoInfo.geoType,
+           m_sVideoInfo.iFaceWidth, m_sVideoInfo.iFaceHeight, (unsigned long long) ruiKey);
+  return m_geoMapCacheDir + "/" + fileName;
+}
+
+Bool TGeometry::xLoadGeoMaps(const std::string &fileName, uint64_t uiKey, Int iNumMaps)
+{
+  TMappedFile *pFile = new TMappedFile;
+  if (!pFile->open(fileName))
+  {
+    delete pFile;
+    return false;
+  }
+
+  size_t uiNumEntries = 0;
+  for (Int fIdx = 0; fIdx < m_sVideoInfo.iNumFaces; fIdx++)
+  {
+    for (Int ch = 0; ch < iNumMaps && !xIsVirtualFace(fIdx); ch++)
+    {
+      uiNumEntries += (size_t) getStride((ComponentID) ch)
+                      * ((m_sVideoInfo.iFaceHeight + (m_iMarginY << 1)) >> getComponentScaleY((ComponentID) ch));
+    }
+  }
+  const GeoMapFileHeader *pHeader = (const GeoMapFileHeader *) pFile->getData();
+  if (pFile->getSize() != sizeof(GeoMapFileHeader) + uiNumEntries * sizeof(PxlFltLut)
+      || memcmp(pHeader->magic, S_GEOMAP_MAGIC, sizeof(pHeader->magic)) || pHeader->version != S_GEOMAP_VERSION
+      || pHeader->numMaps != (UInt) iNumMaps || pHeader->numEntries != (UInt) uiNumEntries || pHeader->key != uiKey)
+  {
+    printf("Warning: the geometry mapping cache file %s does not match and is recreated\n", fileName.c_str());
+    delete pFile;
+    return false;
+  }
+
+  //the maps are only read after they have been generated, so they can point into the read only file;
+  PxlFltLut *pMap = (PxlFltLut *) (pFile->getData() + sizeof(GeoMapFileHeader));
+  for (Int fIdx = 0; fIdx < m_sVideoInfo.iNumFaces; fIdx++)
+  {
+    for (Int ch = 0; ch < iNumMaps && !xIsVirtualFace(fIdx); ch++)
+    {
+      delete[] m_pPixelWeight[fIdx][ch];
+      m_pPixelWeight[fIdx][ch] = pMap;
+      pMap += (size_t) getStride((ComponentID) ch)
+              * ((m_sVideoInfo.iFaceHeight + (m_iMarginY << 1)) >> getComponentScaleY((ComponentID) ch));
+    }
+  }
+  m_pGeoMapFile = pFile;
+  return true;
+}
+
+//the maps are written to a temporary file and renamed, so that concurrent processes only see complete files;
+Void TGeometry::xStoreGeoMaps(const std::string &fileName, uint64_t uiKey, Int iNumMaps)
+{
+  size_t uiNumEntries = 0;
+  for (Int fIdx = 0; fIdx < m_sVideoInfo.iNumFaces; fIdx++)
+  {
+    for (Int ch = 0; ch < iNumMaps && !xIsVirtualFace(fIdx); ch++)
+    {
+      uiNumEntries += (size_t) getStride((ComponentID) ch)
+                      * ((m_sVideoInfo.iFaceHeight + (m_iMarginY << 1)) >> getComponentScaleY((ComponentID) ch));
+    }
+  }
+  GeoMapFileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, S_GEOMAP_MAGIC, sizeof(header.magic));
+  header.version    = S_GEOMAP_VERSION;
+  header.numMaps    = (UInt) iNumMaps;
+  header.numEntries = (UInt) uiNumEntries;
+  header.key        = uiKey;
+
+  const std::string tmpFileName = fileName + "." + std::to_string(std::random_device()()) + ".tmp";
+  FILE *fp = fopen(tmpFileName.c_str(), "wb");
+  Bool bOk = fp != nullptr;
+  if (fp)
+  {
+    bOk = fwrite(&header, sizeof(header), 1, fp) == 1;
+    for (Int fIdx = 0; fIdx < m_sVideoInfo.iNumFaces; fIdx++)
+    {
+      for (Int ch = 0; ch < iNumMaps && !xIsVirtualFace(fIdx); ch++)
+      {
+        size_t uiSize = (size_t) getStride((ComponentID) ch)
+                        * ((m_sVideoInfo.iFaceHeight + (m_iMarginY << 1)) >> getComponentScaleY((ComponentID) ch));
+        bOk = bOk && fwrite(m_pPixelWeight[fIdx][ch], sizeof(PxlFltLut), uiSize, fp) == uiSize;
+      }
+    }
+    bOk = !fclose(fp) && bOk;
+  }
+  if (!bOk || rename(tmpFileName.c_str(), fileName.c_str()))
+  {
+    printf("Warning: the geometry mapping cache file %s cannot be written\n", fileName.c_str());
+    remove(tmpFileName.c_str());
+  }
+}
+
+Void TGeometry::xReleaseGeoMapFile()
+{
+  if (!m_pGeoMapFile)
+  {
+    return;
+  }
+  for (Int fIdx = 0; fIdx < SV_MAX_NUM_FACES; fIdx++)
+  {
+    m_pPixelWeight[fIdx][0] = m_pPixelWeight[fIdx][1] = nullptr;
+  }
+  delete m_pGeoMapFile;
+  m_pGeoMapFile = nullptr;
+}
+#endif
+
 Void TGeometry::geoToFramePack(IPos *posIn, IPos2D *posOut)
 {
   Int xoffset = m_facePos[posIn->faceIdx][1] * m_sVideoInfo.iFaceWidth;
@@ -203,6 +203,19 @@
 #endif
 // 360Lib-12.0;
 #define SVIDEO_GCMP_BLENDING                             1      //JVET-T0118
+// multi-model extension;
+#define SVIDEO_ASYNC_METRICS                             1      // optional computation of the 360 metrics of the encoder on a background thread
+#define SVIDEO_WSPSNR_SIMD                               1      // row based WS-PSNR distortion with the SIMD kernels of the pel buffer operations; ERP weights the exact integer SSD of each row, which may differ from 0 in the last digits
+#define SVIDEO_BINARY_SPHERE_POINTS                      1      // memory mapped binary sphere points and cached S-PSNR sampling position tables
+#define SVIDEO_PARALLEL_GEOCONVERT                       1      // generate and apply the geometry mapping in face row tiles on a worker pool
+#if SVIDEO_PARALLEL_GEOCONVERT
+#define SVIDEO_GEOCONVERT_TILE_ROWS                      16     // rows of one face channel per tile
+#include "../CommonLib/WorkerPool.h"
+#include <vector>
+#endif
+#if SVIDEO_BINARY_SPHERE_POINTS
+#define SVIDEO_GEOMAP_CACHE                              1      // persistent memory mapped cache of the geometry mapping tables; depends on SVIDEO_BINARY_SPHERE_POINTS;
+#endif
 
 //#define SV_MAX_NUM_SAMPLING          64
 #define SV_MAX_NUM_FACES             20
@@ -549,6 +562,20 @@ struct InputGeoParam
 #endif
 };
 
+#if SVIDEO_PARALLEL_GEOCONVERT
+struct GeoMappingTile
+{
+  Int fIdx;
+  Int ch;
+  Int iRowStart;   //first row of the tile, relative to the face origin in the channel resolution (negative inside the top margin);
+  Int iRowEnd;     //one past the last row;
+};
+
+#endif
+#if SVIDEO_GEOMAP_CACHE
+class TMappedFile;
+
+#endif
 struct SpherePoints
 {
   Int iNumOfPoints;
@@ -616,6 +643,27 @@ protected:
   Bool m_bConvOutputPaddingNeeded;
 
   Void geometryMapping4SpherePadding();
+#if SVIDEO_PARALLEL_GEOCONVERT
+  WorkerPool m_geoConvertPool;      //workers generating and applying the mapping of this geometry as the conversion destination;
+
+  Void xGetMappingTiles(std::vector<GeoMappingTile> &tiles, Int iNumChannels);
+  Void xGeometryMappingTile(TGeometry *pGeoSrc, const GeoMappingTile &tile
+#if SVIDEO_ROT_FIX
+    , Void (TGeometry::*pfuncRotation)(SPos &sPos, Int iRoll, Int iPitch, Int iYaw)
+#endif
+    , const Int *pRot);
+  Void xGeoConvertTile(TGeometry *pGeoDst, const GeoMappingTile &tile);
+#endif
+#if SVIDEO_GEOMAP_CACHE
+  std::string  m_geoMapCacheDir;
+  TMappedFile *m_pGeoMapFile;       //cache file holding m_pPixelWeight if the maps were loaded from it;
+
+  Bool        xIsVirtualFace(Int fIdx);
+  std::string xGetGeoMapCacheFile(TGeometry *pGeoSrc, const Int *pRot, Bool bInvRotation, Int iNumMaps, uint64_t &ruiKey);
+  Bool        xLoadGeoMaps(const std::string &fileName, uint64_t uiKey, Int iNumMaps);
+  Void        xStoreGeoMaps(const std::string &fileName, uint64_t uiKey, Int iNumMaps);
+  Void        xReleaseGeoMapFile();
+#endif
   Void getSPLutIdx(Int ch, Int x, Int y, Int& iIdx);
 
   Void initInterpolation(Int *pInterpolateType);
@@ -749,6 +797,15 @@ public:
 #if SVIDEO_DYNAMIC_VIEWPORT_PSNR
   Void setGeometryMapping(Bool b)   {m_bGeometryMapping = b;};
 #endif
+#if SVIDEO_BINARY_SPHERE_POINTS
+  Void getCacheKey(std::vector<Int> &key);
+#endif
+#if SVIDEO_GEOMAP_CACHE
+  Void setGeoMapCacheDir(const std::string &dir) { m_geoMapCacheDir = dir; }
+#endif
+#if SVIDEO_PARALLEL_GEOCONVERT
+  Void setNumGeoConvertThreads(Int iNumThreads) { m_geoConvertPool.destroy(); m_geoConvertPool.create(iNumThreads); }
+#endif
   
 #if SVIDEO_CHROMA_TYPES_SUPPORT
   Void getFaceChromaOffset(Double dChromaOffset[2], Int iFaceIdx, ComponentID chId);
@@ -0,0 +1,134 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TMappedFile.cpp
+    \brief    TMappedFile class
+*/
+
+#include "TMappedFile.h"
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if SVIDEO_BINARY_SPHERE_POINTS
+
+TMappedFile::TMappedFile()
+: m_pData(nullptr)
+, m_size(0)
+, m_bMapped(false)
+{
+}
+
+TMappedFile::~TMappedFile()
+{
+  close();
+}
+
+Bool TMappedFile::open(const std::string &fileName)
+{
+  close();
+#if !defined(_WIN32)
+  Int fd = ::open(fileName.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    return false;
+  }
+  struct stat sb;
+  if(fstat(fd, &sb) || sb.st_size <= 0)
+  {
+    ::close(fd);
+    return false;
+  }
+  Void *pData = mmap(nullptr, (size_t)sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if(pData == MAP_FAILED)
+  {
+    return false;
+  }
+  m_pData = (const UChar*)pData;
+  m_size = (size_t)sb.st_size;
+  m_bMapped = true;
+#else
+  FILE *fp = fopen(fileName.c_str(), "rb");
+  if(!fp)
+  {
+    return false;
+  }
+  fseek(fp, 0, SEEK_END);
+  long iSize = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+  if(iSize <= 0)
+  {
+    fclose(fp);
+    return false;
+  }
+  UChar *pData = (UChar*)malloc(iSize);
+  if(fread(pData, 1, iSize, fp) != (size_t)iSize)
+  {
+    free(pData);
+    fclose(fp);
+    return false;
+  }
+  fclose(fp);
+  m_pData = pData;
+  m_size = (size_t)iSize;
+  m_bMapped = false;
+#endif
+  return true;
+}
+
+Void TMappedFile::close()
+{
+  if(!m_pData)
+  {
+    return;
+  }
+#if !defined(_WIN32)
+  if(m_bMapped)
+  {
+    munmap((Void*)m_pData, m_size);
+  }
+  else
+#endif
+  {
+    free((Void*)m_pData);
+  }
+  m_pData = nullptr;
+  m_size = 0;
+  m_bMapped = false;
+}
+
+#endif
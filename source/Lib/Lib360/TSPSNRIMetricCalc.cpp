@@ -50,10 +50,12 @@ TSPSNRIMetric::TSPSNRIMetric()
 
 TSPSNRIMetric::~TSPSNRIMetric()
 {
+#if !SVIDEO_BINARY_SPHERE_POINTS
   if(m_pCart2D)
   {
     free(m_pCart2D); m_pCart2D = nullptr;
   }
+#endif
   if(m_fpDTable)
   {
     free(m_fpDTable); m_fpDTable = nullptr;
@@ -114,6 +116,16 @@ Void TSPSNRIMetric::sphSampoints(const std::string &cSphDataFile)
     return;
   }
 
+#if SVIDEO_BINARY_SPHERE_POINTS
+  if(!m_cSphPoints.load(cSphDataFile))
+  {
+    printf("SPSNR-I is disabled because metadata file (%s) cannot be opened!\n", cSphDataFile.c_str());
+    m_bSPSNRIEnabled = false;
+    return;
+  }
+  m_iSphNumPoints = m_cSphPoints.getNumPoints();
+  m_pCart2D = m_cSphPoints.getPoints();
+#else
   // read data
   FILE *fp = fopen(cSphDataFile.c_str(),"r");
   if(!fp)
@@ -142,6 +154,7 @@ Void TSPSNRIMetric::sphSampoints(const std::string &cSphDataFile)
     }
   }
   fclose(fp);
+#endif
 }
 
 void TSPSNRIMetric::sphToCart(CPos2D* sph, CPos3D* out)
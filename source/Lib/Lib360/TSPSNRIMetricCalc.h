@@ -38,6 +38,9 @@
 #ifndef __TSPSNRICALC__
 #define __TSPSNRICALC__
 #include "TGeometry.h"
+#if SVIDEO_BINARY_SPHERE_POINTS
+#include "TSphPointSet.h"
+#endif
 
 // ====================================================================================================================
 // Class definition
@@ -50,7 +53,12 @@ private:
   Bool      m_bSPSNRIEnabled;
   Double    m_dSPSNRI[3];
   
+#if SVIDEO_BINARY_SPHERE_POINTS
+  TSphPointSet  m_cSphPoints;
+  const CPos2D* m_pCart2D;
+#else
   CPos2D*   m_pCart2D;
+#endif
   SPos*   m_fpDTable;
   IPos2D*   m_fpTable;
   
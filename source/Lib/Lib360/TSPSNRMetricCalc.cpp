@@ -36,6 +36,9 @@
 */
 
 #include "TSPSNRMetricCalc.h"
+#if SVIDEO_BINARY_SPHERE_POINTS
+#include <random>
+#endif
 
 #if SVIDEO_SPSNR_NN
 
@@ -60,6 +63,20 @@ TSPSNRMetric::TSPSNRMetric()
 
 TSPSNRMetric::~TSPSNRMetric()
 {
+#if SVIDEO_BINARY_SPHERE_POINTS
+  //the points are owned by m_cSphPoints; the tables are owned by m_cTableFile if it is open;
+  if(!m_cTableFile.isOpen())
+  {
+    free((Void*)m_fpTable);
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+    free((Void*)m_fpTableC);
+#endif
+  }
+  m_fpTable = nullptr;
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+  m_fpTableC = nullptr;
+#endif
+#else
   if(m_pCart2D)
   {
     free(m_pCart2D); m_pCart2D = nullptr;
@@ -74,6 +91,7 @@ TSPSNRMetric::~TSPSNRMetric()
     free(m_fpTableC); m_fpTableC = nullptr;
   }
 #endif
+#endif
 #if SVIDEO_CF_SPSNR_NN
   if(m_pSamplePosTable)
   {
@@ -128,6 +146,16 @@ Void TSPSNRMetric::sphSampoints(const std::string &cSphDataFile)
     return;
   }
 
+#if SVIDEO_BINARY_SPHERE_POINTS
+  if(!m_cSphPoints.load(cSphDataFile))
+  {
+    printf("SPSNR-NN is disabled because metadata file (%s) cannot be opened!\n", cSphDataFile.c_str());
+    m_bSPSNREnabled = false;
+    return;
+  }
+  m_iSphNumPoints = m_cSphPoints.getNumPoints();
+  m_pCart2D = m_cSphPoints.getPoints();
+#else
   // read data
   FILE *fp = fopen(cSphDataFile.c_str(),"r");
   if(!fp)
@@ -156,6 +184,7 @@ Void TSPSNRMetric::sphSampoints(const std::string &cSphDataFile)
     }
   }
   fclose(fp);
+#endif
 }
 
 void TSPSNRMetric::sphToCart(CPos2D* sph, CPos3D* out)
@@ -175,13 +204,28 @@ void TSPSNRMetric::createTable(TGeometry *pcCodingGeomtry)
     return;
   }
 
+#if SVIDEO_BINARY_SPHERE_POINTS
+  std::string tableFile;
+  uint64_t uiTableKey = 0;
+  if(!m_tableCacheDir.empty())
+  {
+    tableFile = xGetTableCacheFile(pcCodingGeomtry, uiTableKey);
+    if(xLoadTable(tableFile, uiTableKey))
+    {
+      return;
+    }
+  }
+#endif
+
   Int iNumPoints = m_iSphNumPoints;
   CPos2D In2d;
   CPos3D Out3d;
   SPos posIn, posOut;
-  m_fpTable = (IPos2D*)malloc(iNumPoints * sizeof(IPos2D));
+  IPos2D *pfpTable = (IPos2D*)malloc(iNumPoints * sizeof(IPos2D));
+  m_fpTable = pfpTable;
 #if SVIDEO_CHROMA_TYPES_SUPPORT
-  m_fpTableC = (IPos2D*)malloc(iNumPoints * sizeof(IPos2D));
+  IPos2D *pfpTableC = (IPos2D*)malloc(iNumPoints * sizeof(IPos2D));
+  m_fpTableC = pfpTableC;
   Double chromaOffset[2] = { 0.0, 0.0 }; //[0: X; 1: Y];
 #endif
     for (Int np = 0; np < iNumPoints; np++)
@@ -208,20 +252,115 @@ void TSPSNRMetric::createTable(TGeometry *pcCodingGeomtry)
       tmpPos.v = (Int)(posOut.y);
 #endif
       pcCodingGeomtry->clamp(&tmpPos);
-      pcCodingGeomtry->geoToFramePack(&tmpPos, &m_fpTable[np]);
+      pcCodingGeomtry->geoToFramePack(&tmpPos, &pfpTable[np]);
 
 #if SVIDEO_CHROMA_TYPES_SUPPORT
       pcCodingGeomtry->getFaceChromaOffset(chromaOffset, posOut.faceIdx, COMPONENT_Cb);
       tmpPos.u = (Int)(TGeometry::round((posOut.x - chromaOffset[0]) / (1 << pcCodingGeomtry->getComponentScaleX(COMPONENT_Cb)))) * (1 << pcCodingGeomtry->getComponentScaleX(COMPONENT_Cb));
       tmpPos.v = (Int)(TGeometry::round((posOut.y - chromaOffset[1]) / (1 << pcCodingGeomtry->getComponentScaleY(COMPONENT_Cb)))) * (1 << pcCodingGeomtry->getComponentScaleY(COMPONENT_Cb));
       pcCodingGeomtry->clamp(&tmpPos);
-      pcCodingGeomtry->geoToFramePack(&tmpPos, &m_fpTableC[np]);
-      m_fpTableC[np].x >>= pcCodingGeomtry->getComponentScaleX(COMPONENT_Cb);
-      m_fpTableC[np].y >>= pcCodingGeomtry->getComponentScaleY(COMPONENT_Cb);
+      pcCodingGeomtry->geoToFramePack(&tmpPos, &pfpTableC[np]);
+      pfpTableC[np].x >>= pcCodingGeomtry->getComponentScaleX(COMPONENT_Cb);
+      pfpTableC[np].y >>= pcCodingGeomtry->getComponentScaleY(COMPONENT_Cb);
 #endif
     }
+#if SVIDEO_BINARY_SPHERE_POINTS
+  if(!tableFile.empty())
+  {
+    xStoreTable(tableFile, uiTableKey);
+  }
+#endif
+}
+
+#if SVIDEO_BINARY_SPHERE_POINTS
+//cached table file: header followed by the luma table and, with SVIDEO_CHROMA_TYPES_SUPPORT, the chroma table;
+struct SphTableFileHeader
+{
+  TChar    magic[8];
+  UInt     version;
+  UInt     numPoints;
+  UInt     numTables;
+  UInt     reserved;
+  uint64_t key;
+};
+
+static const TChar S_SPH_TABLE_MAGIC[8] = { 'S', 'P', 'H', 'T', 'A', 'B', '\0', '\0' };
+static const UInt  S_SPH_TABLE_VERSION  = 1;
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+static const UInt  S_SPH_TABLE_NUM      = 2;
+#else
+static const UInt  S_SPH_TABLE_NUM      = 1;
+#endif
+
+//the key covers everything the sampling positions depend on: the point set, the geometry with its face size, frame packing and rotation, and the chroma format;
+std::string TSPSNRMetric::xGetTableCacheFile(TGeometry *pcCodingGeomtry, uint64_t &ruiKey)
+{
+  const SVideoInfo *pInfo = pcCodingGeomtry->getSVideoInfo();
+  std::vector<Int> key;
+
+  key.push_back(S_SPH_TABLE_VERSION);
+  key.push_back(S_SPH_TABLE_NUM);
+  pcCodingGeomtry->getCacheKey(key);
+  ruiKey = TSphPointSet::hash(key.data(), key.size() * sizeof(Int), m_cSphPoints.getHash());
+
+  TChar fileName[128];
+  snprintf(fileName, sizeof(fileName), "spsnr_geo%d_%dx%d_cf%d_%016llx.bin", pInfo->geoType, pInfo->iFaceWidth, pInfo->iFaceHeight, (Int)pInfo->framePackStruct.chromaFormatIDC, (unsigned long long)ruiKey);
+  return m_tableCacheDir + "/" + fileName;
 }
 
+Bool TSPSNRMetric::xLoadTable(const std::string &fileName, uint64_t uiKey)
+{
+  if(!m_cTableFile.open(fileName))
+  {
+    return false;
+  }
+  const SphTableFileHeader *pHeader = (const SphTableFileHeader*)m_cTableFile.getData();
+  if(m_cTableFile.getSize() != sizeof(SphTableFileHeader) + (size_t)S_SPH_TABLE_NUM * m_iSphNumPoints * sizeof(IPos2D)
+    || memcmp(pHeader->magic, S_SPH_TABLE_MAGIC, sizeof(pHeader->magic)) || pHeader->version != S_SPH_TABLE_VERSION
+    || pHeader->numPoints != (UInt)m_iSphNumPoints || pHeader->numTables != S_SPH_TABLE_NUM || pHeader->key != uiKey)
+  {
+    printf("Warning: the S-PSNR table cache file %s does not match and is recreated\n", fileName.c_str());
+    m_cTableFile.close();
+    return false;
+  }
+  m_fpTable = (const IPos2D*)(m_cTableFile.getData() + sizeof(SphTableFileHeader));
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+  m_fpTableC = m_fpTable + m_iSphNumPoints;
+#endif
+  return true;
+}
+
+//the table is written to a temporary file and renamed, so that concurrent processes only see complete files;
+Void TSPSNRMetric::xStoreTable(const std::string &fileName, uint64_t uiKey)
+{
+  SphTableFileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, S_SPH_TABLE_MAGIC, sizeof(header.magic));
+  header.version = S_SPH_TABLE_VERSION;
+  header.numPoints = (UInt)m_iSphNumPoints;
+  header.numTables = S_SPH_TABLE_NUM;
+  header.key = uiKey;
+
+  const std::string tmpFileName = fileName + "." + std::to_string(std::random_device()()) + ".tmp";
+  FILE *fp = fopen(tmpFileName.c_str(), "wb");
+  Bool bOk = fp != nullptr;
+  if(fp)
+  {
+    bOk = fwrite(&header, sizeof(header), 1, fp) == 1
+       && fwrite(m_fpTable, sizeof(IPos2D), m_iSphNumPoints, fp) == (size_t)m_iSphNumPoints;
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+    bOk = bOk && fwrite(m_fpTableC, sizeof(IPos2D), m_iSphNumPoints, fp) == (size_t)m_iSphNumPoints;
+#endif
+    bOk = !fclose(fp) && bOk;
+  }
+  if(!bOk || rename(tmpFileName.c_str(), fileName.c_str()))
+  {
+    printf("Warning: the S-PSNR table cache file %s cannot be written\n", fileName.c_str());
+    remove(tmpFileName.c_str());
+  }
+}
+#endif
+
 Void TSPSNRMetric::xCalculateSPSNR(PelUnitBuf& cOrgPicYuv, PelUnitBuf& cPicD)
 {
   Int iNumPoints = m_iSphNumPoints;
@@ -38,6 +38,9 @@
 #ifndef __TSPSNRCALC__
 #define __TSPSNRCALC__
 #include "TGeometry.h"
+#if SVIDEO_BINARY_SPHERE_POINTS
+#include "TSphPointSet.h"
+#endif
 
 // ====================================================================================================================
 // Class definition
@@ -51,10 +54,21 @@ private:
   Bool      m_bSPSNREnabled;
   Double    m_dSPSNR[3];
   
+#if SVIDEO_BINARY_SPHERE_POINTS
+  TSphPointSet  m_cSphPoints;
+  const CPos2D* m_pCart2D;
+  const IPos2D* m_fpTable;
+#if SVIDEO_CHROMA_TYPES_SUPPORT
+  const IPos2D* m_fpTableC;
+#endif
+  std::string   m_tableCacheDir;
+  TMappedFile   m_cTableFile;                           ///< cached sampling position table; m_fpTable points into it if it is open
+#else
   CPos2D*   m_pCart2D;
   IPos2D*   m_fpTable;
 #if SVIDEO_CHROMA_TYPES_SUPPORT
   IPos2D*   m_fpTableC;
+#endif
 #endif
   Int       m_iSphNumPoints;
 
@@ -79,6 +93,11 @@ private:
   IPos*       m_pSamplePosCRecTable;
 #endif
 #endif
+#if SVIDEO_BINARY_SPHERE_POINTS
+  std::string xGetTableCacheFile(TGeometry *pcCodingGeomtry, uint64_t &ruiKey);
+  Bool    xLoadTable(const std::string &fileName, uint64_t uiKey);
+  Void    xStoreTable(const std::string &fileName, uint64_t uiKey);
+#endif
 public:
   TSPSNRMetric();
   virtual ~TSPSNRMetric();
@@ -87,6 +106,9 @@ public:
   Void    setOutputBitDepth(Int iOutputBitDepth[MAX_NUM_CHANNEL_TYPE]);
   Void    setReferenceBitDepth(Int iReferenceBitDepth[MAX_NUM_CHANNEL_TYPE]);
   Double* getSPSNR() {return m_dSPSNR;}
+#if SVIDEO_BINARY_SPHERE_POINTS
+  Void    setTableCacheDir(const std::string &dir) { m_tableCacheDir = dir; }
+#endif
   Void    sphSampoints(const std::string &cSphDataFile);
   Void    sphToCart(CPos2D*, CPos3D*);
   Void    createTable(TGeometry *pcCodingGeomtry);
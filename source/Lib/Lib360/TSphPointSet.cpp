@@ -0,0 +1,153 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TSphPointSet.cpp
+    \brief    TSphPointSet class
+*/
+
+#include "TSphPointSet.h"
+
+#if SVIDEO_BINARY_SPHERE_POINTS
+
+TSphPointSet::TSphPointSet()
+: m_pPoints(nullptr)
+, m_iNumPoints(0)
+, m_hash(0)
+{
+}
+
+//returns false if the file cannot be opened; a file with format errors terminates the application as before;
+Bool TSphPointSet::load(const std::string &fileName)
+{
+  m_cFile.close();
+  m_textPoints.clear();
+  m_pPoints = nullptr;
+  m_iNumPoints = 0;
+  m_hash = 0;
+
+  if(isBinaryFile(fileName))
+  {
+    if(!m_cFile.open(fileName))
+    {
+      return false;
+    }
+    const SphPointsFileHeader *pHeader = (const SphPointsFileHeader*)m_cFile.getData();
+    if(m_cFile.getSize() < sizeof(SphPointsFileHeader) || pHeader->version != S_SPH_POINTS_VERSION
+      || m_cFile.getSize() != sizeof(SphPointsFileHeader) + (size_t)pHeader->numPoints * sizeof(CPos2D))
+    {
+      printf("Format error SphData in %s.\n", fileName.c_str());
+      exit(EXIT_FAILURE);
+    }
+    m_iNumPoints = (Int)pHeader->numPoints;
+    m_pPoints = (const CPos2D*)(m_cFile.getData() + sizeof(SphPointsFileHeader));
+    return true;
+  }
+
+  FILE *fp = fopen(fileName.c_str(), "r");
+  if(!fp)
+  {
+    return false;
+  }
+  if(fscanf(fp, "%d ", &m_iNumPoints) != 1)
+  {
+    printf("SphData file does not exist.\n");
+    exit(EXIT_FAILURE);
+  }
+  m_textPoints.resize(m_iNumPoints);
+  for(Int z = 0; z < m_iNumPoints; z++)
+  {
+    if(fscanf(fp, "%lf %lf", &m_textPoints[z].x, &m_textPoints[z].y) != 2)
+    {
+      printf("Format error SphData in sphSampoints().\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  fclose(fp);
+  m_pPoints = m_textPoints.data();
+  return true;
+}
+
+//identifies the point set in the keys of the cached tables;
+uint64_t TSphPointSet::getHash()
+{
+  if(!m_hash && m_pPoints)
+  {
+    m_hash = hash(m_pPoints, (size_t)m_iNumPoints * sizeof(CPos2D), hash(&m_iNumPoints, sizeof(m_iNumPoints)));
+  }
+  return m_hash;
+}
+
+Bool TSphPointSet::isBinaryFile(const std::string &fileName)
+{
+  FILE *fp = fopen(fileName.c_str(), "rb");
+  if(!fp)
+  {
+    return false;
+  }
+  TChar magic[sizeof(S_SPH_POINTS_MAGIC)];
+  Bool bBinary = fread(magic, 1, sizeof(magic), fp) == sizeof(magic) && !memcmp(magic, S_SPH_POINTS_MAGIC, sizeof(magic));
+  fclose(fp);
+  return bBinary;
+}
+
+Bool TSphPointSet::writeBinaryFile(const std::string &fileName, const CPos2D *pPoints, Int iNumPoints)
+{
+  FILE *fp = fopen(fileName.c_str(), "wb");
+  if(!fp)
+  {
+    return false;
+  }
+  SphPointsFileHeader header;
+  memcpy(header.magic, S_SPH_POINTS_MAGIC, sizeof(header.magic));
+  header.version = S_SPH_POINTS_VERSION;
+  header.numPoints = (UInt)iNumPoints;
+  Bool bOk = fwrite(&header, sizeof(header), 1, fp) == 1
+          && fwrite(pPoints, sizeof(CPos2D), iNumPoints, fp) == (size_t)iNumPoints;
+  bOk = !fclose(fp) && bOk;
+  return bOk;
+}
+
+//64 bit FNV-1a;
+uint64_t TSphPointSet::hash(const Void *pData, size_t size, uint64_t seed)
+{
+  const UChar *p = (const UChar*)pData;
+  uint64_t h = seed;
+  for(size_t i = 0; i < size; i++)
+  {
+    h ^= p[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+#endif
@@ -0,0 +1,83 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2018, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TSphPointSet.h
+    \brief    TSphPointSet class (header)
+*/
+
+#ifndef __TSPHPOINTSET__
+#define __TSPHPOINTSET__
+#include "TMappedFile.h"
+
+// ====================================================================================================================
+// Class definition
+// ====================================================================================================================
+
+#if SVIDEO_BINARY_SPHERE_POINTS
+
+//binary sphere points file: header followed by the points as CPos2D [latitude, longitude] in degrees, native byte order;
+struct SphPointsFileHeader
+{
+  TChar  magic[8];
+  UInt   version;
+  UInt   numPoints;
+};
+
+static const TChar S_SPH_POINTS_MAGIC[8]  = { 'S', 'P', 'H', 'P', 'T', 'S', '\0', '\0' };
+static const UInt  S_SPH_POINTS_VERSION    = 1;
+
+//sampling points on the sphere for the S-PSNR metrics; read from the text format "N lat0 lon0 lat1 lon1 ..." or mapped from the binary format;
+class TSphPointSet
+{
+private:
+  TMappedFile          m_cFile;
+  std::vector<CPos2D>  m_textPoints;
+  const CPos2D*        m_pPoints;
+  Int                  m_iNumPoints;
+  uint64_t             m_hash;
+
+public:
+  TSphPointSet();
+
+  Bool           load(const std::string &fileName);
+  Int            getNumPoints() const   { return m_iNumPoints; }
+  const CPos2D*  getPoints() const      { return m_pPoints; }
+  uint64_t       getHash();
+
+  static Bool    isBinaryFile(const std::string &fileName);
+  static Bool    writeBinaryFile(const std::string &fileName, const CPos2D *pPoints, Int iNumPoints);
+  static uint64_t hash(const Void *pData, size_t size, uint64_t seed = 14695981039346656037ULL);
+};
+
+#endif
+#endif // __TSPHPOINTSET__
@@ -370,20 +370,20 @@ Void TViewPortPSNR::calculateCombinedValues(Int vpIdx, UInt uiNumPics, Double &P
 }
 
 #if SVIDEO_E2E_METRICS
-Void TViewPortPSNR::xCalculatePSNR( Picture* pcPic, PelUnitBuf *pcOrgPicYuv)
+Void TViewPortPSNR::xCalculatePSNR( Int iPOC, PelUnitBuf &recPicYuv, PelUnitBuf *pcOrgPicYuv)
 #else
-Void TViewPortPSNR::xCalculatePSNR( Picture* pcPic)
+Void TViewPortPSNR::xCalculatePSNR( Int iPOC, PelUnitBuf &recPicYuv)
 #endif
 {
   if(!m_viewPortPSNRParam.bViewPortPSNREnabled)
     return;
 #if !SVIDEO_E2E_METRICS
-  Int iDeltaFrames = pcPic->getPOC()*m_temporalSubsampleRatio - m_iLastFrmPOC;
+  Int iDeltaFrames = iPOC*m_temporalSubsampleRatio - m_iLastFrmPOC;
   Int aiPad[2]={0,0};
   m_pcTVideoIOYuvInputFile->skipFrames(iDeltaFrames, m_iInputWidth, m_iInputHeight, m_inputChromaFomat);
   PelUnitBuf tmp;
   m_pcTVideoIOYuvInputFile->read(tmp, m_pcOrgPicYuv, IPCOLOURSPACE_UNCHANGED, aiPad, m_inputChromaFomat, false );
-  m_iLastFrmPOC = pcPic->getPOC()*m_temporalSubsampleRatio+1;
+  m_iLastFrmPOC = iPOC*m_temporalSubsampleRatio+1;
 #endif
   Int iNumOfViewPorts = (Int)m_viewPortPSNRParam.viewPortSettingsList.size(); 
 #if SVIDEO_E2E_METRICS
@@ -397,7 +397,7 @@ Void TViewPortPSNR::xCalculatePSNR( Picture* pcPic)
   else
     m_pRefGeometry->convertYuv(m_pcOrgPicYuv);
 #endif
-  PelUnitBuf pRecPicYuv = pcPic->getRecoBuf();
+  PelUnitBuf pRecPicYuv = recPicYuv;
   if((m_pRecGeometry->getType() == SVIDEO_OCTAHEDRON || m_pRecGeometry->getType() == SVIDEO_ICOSAHEDRON) && m_pRecGeometry->getSVideoInfo()->iCompactFPStructure) 
     m_pRecGeometry->compactFramePackConvertYuv(&pRecPicYuv);
   else
@@ -439,17 +439,17 @@ Void TViewPortPSNR::xCalculatePSNR( Picture* pcPic)
     BitDepths bd;
     bd.recon[CHANNEL_TYPE_LUMA] =bd.recon[CHANNEL_TYPE_CHROMA] = m_iRefBitDepth;
     sprintf(fileName, "ref_viewport%d_%dx%d_BD%d.yuv", i, m_viewPortPSNRParam.iViewPortWidth, m_viewPortPSNRParam.iViewPortHeight, m_iRefBitDepth);
-    m_pRefViewPortYuv->dump(fileName, bd, pcPic->getPOC()!=0);
+    m_pRefViewPortYuv->dump(fileName, bd, iPOC!=0);
     
     bd.recon[CHANNEL_TYPE_LUMA] =bd.recon[CHANNEL_TYPE_CHROMA] = m_iViewPortBitDepth;
     sprintf(fileName, "rec_viewport%d_%dx%d_BD%d.yuv", i, m_viewPortPSNRParam.iViewPortWidth, m_viewPortPSNRParam.iViewPortHeight, m_iViewPortBitDepth);
-    m_pRecViewPortYuv->dump(fileName, bd, pcPic->getPOC()!=0);
+    m_pRecViewPortYuv->dump(fileName, bd, iPOC!=0);
 #endif
   }
 }
 
 #if SVIDEO_DYNAMIC_VIEWPORT_PSNR
-Void TViewPortPSNR::xCalculateDynamicViewPSNR( Picture* pcPic, PelUnitBuf *pcOrgPicYuv)
+Void TViewPortPSNR::xCalculateDynamicViewPSNR( Int iPOC, PelUnitBuf &recPicYuv, PelUnitBuf *pcOrgPicYuv)
 {
   if(!m_dynamicViewPortPSNRParam.bViewPortPSNREnabled)
     return;
@@ -459,7 +459,7 @@ Void TViewPortPSNR::xCalculateDynamicViewPSNR( Picture* pcPic, PelUnitBuf *pcOrg
   else
     m_pRefGeometry->convertYuv(pcOrgPicYuv);
 
-  PelUnitBuf pRecPicYuv = pcPic->getRecoBuf();
+  PelUnitBuf pRecPicYuv = recPicYuv;
   if((m_pRecGeometry->getType() == SVIDEO_OCTAHEDRON || m_pRecGeometry->getType() == SVIDEO_ICOSAHEDRON) && m_pRecGeometry->getSVideoInfo()->iCompactFPStructure) 
     m_pRecGeometry->compactFramePackConvertYuv(&pRecPicYuv);
   else
@@ -473,7 +473,7 @@ Void TViewPortPSNR::xCalculateDynamicViewPSNR( Picture* pcPic, PelUnitBuf *pcOrg
     Float dStartYaw   = dynViewPort.fYaw[0];
     Float dEndYaw     = dynViewPort.fYaw[1];
     Int   iTotalNumFrame = (m_dynamicViewPortPSNRParam.viewPortSettingsList[i].iPOC[1]  - m_dynamicViewPortPSNRParam.viewPortSettingsList[i].iPOC[0])*m_temporalSubsampleRatio;
-    Int   iCurPOC        = m_iNumFrameSkipped + pcPic->getPOC()*m_temporalSubsampleRatio;
+    Int   iCurPOC        = m_iNumFrameSkipped + iPOC*m_temporalSubsampleRatio;
 
     Float dCurrPitch  = (iTotalNumFrame) ? ( dStartPitch + (dEndPitch - dStartPitch)/Float(iTotalNumFrame)*Float(iCurPOC) ) : dStartPitch;
     Float dCurrYaw    = (iTotalNumFrame) ? ( dStartYaw + (dEndYaw - dStartYaw)/Float(iTotalNumFrame)*Float(iCurPOC) ) : dStartYaw;
@@ -519,11 +519,11 @@ Void TViewPortPSNR::xCalculateDynamicViewPSNR( Picture* pcPic, PelUnitBuf *pcOrg
       BitDepths bd;
       bd.recon[CHANNEL_TYPE_LUMA] =bd.recon[CHANNEL_TYPE_CHROMA] = m_iRefBitDepth;
       sprintf(fileName, "ref_dynamic_viewport%d_%dx%d_BD%d.yuv", i, m_dynamicViewPortPSNRParam.iViewPortWidth, m_dynamicViewPortPSNRParam.iViewPortHeight, m_iRefBitDepth);
-      m_pRefViewPortYuv->dump(fileName, bd, pcPic->getPOC()!=0);
+      m_pRefViewPortYuv->dump(fileName, bd, iPOC!=0);
 
       bd.recon[CHANNEL_TYPE_LUMA] =bd.recon[CHANNEL_TYPE_CHROMA] = m_iViewPortBitDepth;
       sprintf(fileName, "rec_dynamic_viewport%d_%dx%d_BD%d.yuv", i, m_dynamicViewPortPSNRParam.iViewPortWidth, m_dynamicViewPortPSNRParam.iViewPortHeight, m_iViewPortBitDepth);
-      m_pRecViewPortYuv->dump(fileName, bd, pcPic->getPOC()!=0);
+      m_pRecViewPortYuv->dump(fileName, bd, iPOC!=0);
 #endif
   }
 }
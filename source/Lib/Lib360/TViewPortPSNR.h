@@ -101,9 +101,9 @@ public:
   Int getNumOfViewPorts() { return (Int)(m_viewPortPSNRParam.viewPortSettingsList.size());}
 #endif
 #if SVIDEO_E2E_METRICS
-  Void xCalculatePSNR( Picture* pcPic, PelUnitBuf *pcOrgPicYuv);
+  Void xCalculatePSNR( Int iPOC, PelUnitBuf &recPicYuv, PelUnitBuf *pcOrgPicYuv);
 #else
-  Void xCalculatePSNR( TComPic* pcPic);
+  Void xCalculatePSNR( Int iPOC, PelUnitBuf &recPicYuv);
 #endif
   Double* getPSNR(Int iVPIdx) {return m_pdPSNR[iVPIdx];}
 #if SVIDEO_DYNAMIC_VIEWPORT_PSNR
@@ -114,7 +114,7 @@ public:
   Void printSummary(UInt uiNumPics);
 #if SVIDEO_DYNAMIC_VIEWPORT_PSNR
   Void initDynamicViewPort(SVideoInfo& sRefVideoInfo, SVideoInfo& sRecVideoInfo, InputGeoParam *pInGeoParam, DynamicViewPortPSNRParam& param, UInt numFrameSkipped, UInt tempSubsampleRatio);
-  Void xCalculateDynamicViewPSNR( Picture* pcPic, PelUnitBuf *pcOrgPicYuv);
+  Void xCalculateDynamicViewPSNR( Int iPOC, PelUnitBuf &recPicYuv, PelUnitBuf *pcOrgPicYuv);
 #endif
 };
 
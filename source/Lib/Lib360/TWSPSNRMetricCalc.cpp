@@ -77,6 +77,9 @@ TWSPSNRMetric::TWSPSNRMetric()
 #if SVIDEO_HEMI_PROJECTIONS || SVIDEO_FISHEYE
 , m_recGeoType(0)
 #endif
+#if SVIDEO_ERP_PADDING
+, m_bPERP(false)
+#endif
 #if SVIDEO_WSPSNR_E2E
 #if !SVIDEO_E2E_METRICS
 , m_pcTVideoIOYuvInputFile(nullptr)
@@ -90,6 +93,9 @@ TWSPSNRMetric::TWSPSNRMetric()
 #endif
 {
   m_dWSPSNR[0] = m_dWSPSNR[1] = m_dWSPSNR[2] = 0;
+#if SVIDEO_WSPSNR_SIMD
+  xResetWeightSums();
+#endif
 }
 
 TWSPSNRMetric::~TWSPSNRMetric()
@@ -302,6 +308,9 @@ void TWSPSNRMetric::createTable(PelUnitBuf* pcPicD, TGeometry *pcCodingGeomtry)
   {
     return;
   }
+#if SVIDEO_WSPSNR_SIMD
+  xResetWeightSums();
+#endif
 
   SVideoInfo *pCodingSVideoInfo = pcCodingGeomtry->getSVideoInfo();
   Int iFaceWidth = pCodingSVideoInfo->iFaceWidth;
@@ -2936,6 +2945,13 @@ Void TWSPSNRMetric::xCalculateWSPSNR( PelUnitBuf* pcOrgPicYuv, PelUnitBuf* pcPic
     Double SSDwpsnr=0;
       
       
+#if SVIDEO_WSPSNR_SIMD
+#if SVIDEO_HEMI_PROJECTIONS
+    if(!xCalculateRowBasedSSD(ch, pcPicD->chromaFormat, pOrg, iOrgStride, pRec, iRecStride, iWidth, iHeight, Width_from, Width_to, iReferenceBitShift[toChannelType(ch)], iOutputBitShift[toChannelType(ch)], SSDwpsnr, fWeightSum))
+#else
+    if(!xCalculateRowBasedSSD(ch, pcPicD->chromaFormat, pOrg, iOrgStride, pRec, iRecStride, iWidth, iHeight, 0, iWidth, iReferenceBitShift[toChannelType(ch)], iOutputBitShift[toChannelType(ch)], SSDwpsnr, fWeightSum))
+#endif
+#endif
     //WS-PSNR
     for(Int y = 0; y < iHeight; y++ )
     {
@@ -3195,6 +3211,147 @@ Void TWSPSNRMetric::xCalculateWSPSNR( PelUnitBuf* pcOrgPicYuv, PelUnitBuf* pcPic
 }
 }
 
+#if SVIDEO_WSPSNR_SIMD
+Void TWSPSNRMetric::xResetWeightSums()
+{
+  for(Int i = 0; i < MAX_NUM_COMPONENT; i++)
+  {
+    m_dWeightSum[i] = 0;
+    m_iWeightSumWidth[i] = 0;
+    m_iWeightSumHeight[i] = 0;
+  }
+}
+
+//returns the picture sized weight table of the coding geometry; nullptr if the weight depends on the face layout;
+const Double* TWSPSNRMetric::xGetWeightPlane(Int chan)
+{
+  switch(m_codingGeoType)
+  {
+#if SVIDEO_ADJUSTED_EQUALAREA
+  case SVIDEO_ADJUSTEDEQUALAREA:
+#else
+  case SVIDEO_EQUALAREA:
+#endif
+    return chan ? m_fEapWeight_C : m_fEapWeight_Y;
+  case SVIDEO_OCTAHEDRON:
+    return chan ? m_fOctaWeight_C : m_fOctaWeight_Y;
+  case SVIDEO_ICOSAHEDRON:
+    return chan ? m_fIcoWeight_C : m_fIcoWeight_Y;
+#if SVIDEO_WSPSNR_SSP
+  case SVIDEO_SEGMENTEDSPHERE:
+    return chan ? m_fSspWeight_C : m_fSspWeight_Y;
+#endif
+#if SVIDEO_ROTATED_SPHERE
+  case SVIDEO_ROTATEDSPHERE:
+    return chan ? m_fRspWeight_C : m_fRspWeight_Y;
+#endif
+#if SVIDEO_ECP_WSPSNR_FIX_TICKET56
+  case SVIDEO_EQUATORIALCYLINDRICAL:
+    return chan ? m_fEcpWeight_C : m_fEcpWeight_Y;
+#endif
+#if SVIDEO_HYBRID_EQUIANGULAR_CUBEMAP
+  case SVIDEO_HYBRIDEQUIANGULARCUBEMAP:
+    return chan ? m_fHecWeight_C : m_fHecWeight_Y;
+#endif
+#if SVIDEO_GENERALIZED_CUBEMAP
+  case SVIDEO_GENERALIZEDCUBEMAP:
+    return chan ? m_fGcmpWeight_C : m_fGcmpWeight_Y;
+#endif
+  default:
+    return nullptr;
+  }
+}
+
+//weighted SSD of the columns [iFrom, iTo) with the row kernels of g_pelBufOP;
+//ERP uses the weight of the row for all samples of the row: the exact integer SSD of the row is multiplied by the weight once, the result is identical for the C and SIMD kernels;
+//the other geometries with a picture sized weight table use the per sample weighted kernel, which adds the weighted squared differences in the order of xCalculateWSPSNR(), the result is bit exact;
+//the padded columns of ERP with weight 0 are skipped;
+//returns false for the geometries which need the per sample weight derivation of xCalculateWSPSNR();
+Bool TWSPSNRMetric::xCalculateRowBasedSSD(ComponentID ch, ChromaFormat fmt, const Pel* pOrg, Int iOrgStride, const Pel* pRec, Int iRecStride, Int iWidth, Int iHeight, Int iFrom, Int iTo, Int iOrgShift, Int iRecShift, Double &rdSSD, Double &rdWeightSum)
+{
+  const Int chan = (Int)ch;
+  const Double *pRowWeight = nullptr;
+  const Double *pWeightPlane = nullptr;
+
+  if(m_codingGeoType == SVIDEO_EQUIRECT)
+  {
+#if SVIDEO_FISHEYE
+    if(m_recGeoType == SVIDEO_FISHEYE_CIRCULAR)
+    {
+      return false;
+    }
+#endif
+    pRowWeight = chan ? m_fErpWeight_C : m_fErpWeight_Y;
+#if SVIDEO_ERP_PADDING
+    if(m_bPERP)
+    {
+      //the padded columns have weight 0;
+      iFrom = std::max(iFrom, SVIDEO_ERP_PAD_L >> getComponentScaleX(ch, fmt));
+      iTo = std::min(iTo, iWidth - (SVIDEO_ERP_PAD_R >> getComponentScaleX(ch, fmt)));
+    }
+#endif
+  }
+  else
+  {
+    pWeightPlane = xGetWeightPlane(chan);
+    if(!pWeightPlane)
+    {
+      return false;
+    }
+  }
+
+  //the weights do not change from picture to picture; the sum is accumulated once in the order of xCalculateWSPSNR();
+  const Bool bWeightSumValid = (m_iWeightSumWidth[chan] == iWidth && m_iWeightSumHeight[chan] == iHeight);
+  Double dWeightSum = bWeightSumValid ? m_dWeightSum[chan] : 0;
+  Double dSSD = 0;
+
+  if(iTo > iFrom)
+  {
+    for(Int y = 0; y < iHeight; y++)
+    {
+      if(pRowWeight)
+      {
+        dSSD += pRowWeight[y] * (Double)g_pelBufOP.calcRowSSD(pOrg + iFrom, pRec + iFrom, iTo - iFrom, iOrgShift, iRecShift);
+        if(!bWeightSumValid && pRowWeight[y] > 0)
+        {
+          for(Int x = iFrom; x < iTo; x++)
+          {
+            dWeightSum += pRowWeight[y];
+          }
+        }
+      }
+      else
+      {
+        const Double *pWeight = pWeightPlane + y*iWidth;
+        dSSD = g_pelBufOP.calcRowWeightedSSD(pOrg + iFrom, pRec + iFrom, pWeight + iFrom, iTo - iFrom, iOrgShift, iRecShift, dSSD);
+        if(!bWeightSumValid)
+        {
+          for(Int x = iFrom; x < iTo; x++)
+          {
+            if(pWeight[x] > 0)
+            {
+              dWeightSum += pWeight[x];
+            }
+          }
+        }
+      }
+      pOrg += iOrgStride;
+      pRec += iRecStride;
+    }
+  }
+
+  if(!bWeightSumValid)
+  {
+    m_dWeightSum[chan] = dWeightSum;
+    m_iWeightSumWidth[chan] = iWidth;
+    m_iWeightSumHeight[chan] = iHeight;
+  }
+  rdSSD = dSSD;
+  rdWeightSum = dWeightSum;
+  return true;
+}
+#endif
+
 #if SVIDEO_WSPSNR_E2E
 #if SVIDEO_E2E_METRICS
 Void TWSPSNRMetric::setCodingGeoInfo2(SVideoInfo& sRefVideoInfo, SVideoInfo& sRecVideoInfo, InputGeoParam *pInGeoParam)
@@ -117,6 +117,15 @@ private:
 #if SVIDEO_FISHEYE
   FisheyeInfo m_fisheyeInfo;
 #endif
+#if SVIDEO_WSPSNR_SIMD
+  Double  m_dWeightSum[MAX_NUM_COMPONENT];         ///< sum of the sample weights, computed with the first picture
+  Int     m_iWeightSumWidth[MAX_NUM_COMPONENT];    ///< component size of the weight sum; 0: not computed
+  Int     m_iWeightSumHeight[MAX_NUM_COMPONENT];
+
+  Void    xResetWeightSums();
+  const Double* xGetWeightPlane(Int chan);
+  Bool    xCalculateRowBasedSSD(ComponentID ch, ChromaFormat fmt, const Pel* pOrg, Int iOrgStride, const Pel* pRec, Int iRecStride, Int iWidth, Int iHeight, Int iFrom, Int iTo, Int iOrgShift, Int iRecShift, Double &rdSSD, Double &rdWeightSum);
+#endif
 public:
   TWSPSNRMetric();
   virtual ~TWSPSNRMetric();
@@ -141,8 +150,12 @@ public:
 #endif
   }
 #if SVIDEO_ERP_PADDING
+#if SVIDEO_WSPSNR_SIMD
+  Void    setPERPFlag(Bool bPERP) { if(bPERP != m_bPERP) xResetWeightSums(); m_bPERP = bPERP; }
+#else
   Void    setPERPFlag(Bool bPERP) { m_bPERP = bPERP; }
 #endif
+#endif
 
 #if SVIDEO_WSPSNR_E2E
 #if SVIDEO_E2E_METRICS